@@ -97,6 +97,9 @@
 #if !defined(DISPLAY_DRV_TASK_STACK_SIZE)
   #define DISPLAY_DRV_TASK_STACK_SIZE (1024u)
 #endif
+#if !defined(DISPLAY_TRANSFER_TASK_STACK_SIZE)
+  #define DISPLAY_TRANSFER_TASK_STACK_SIZE (RTOS_MINIMAL_STACK_SIZE * 2u)
+#endif
 #if !defined(BUTTON_DRV_TASK_STACK_SIZE)
   #define BUTTON_DRV_TASK_STACK_SIZE RTOS_MINIMAL_STACK_SIZE
 #endif
@@ -110,6 +113,9 @@
 #if !defined(DISPLAY_DRV_TASK_PRIORITY)
   #define DISPLAY_DRV_TASK_PRIORITY (RTOS_IDLE_TASK_PRIORITY + 1u)
 #endif
+#if !defined(DISPLAY_TRANSFER_TASK_PRIORITY)
+  #define DISPLAY_TRANSFER_TASK_PRIORITY (RTOS_IDLE_TASK_PRIORITY + 2u)
+#endif
 #if !defined(BUTTON_DRV_TASK_PRIORITY)
   #define BUTTON_DRV_TASK_PRIORITY (RTOS_IDLE_TASK_PRIORITY + 2u)
 #endif
@@ -138,16 +144,170 @@
 #define DISPLAY_MAX_BUF_LEN 320
 #endif
 
+// Number of lines rendered into one buffer and sent to display in one transfer.
+// Each of two display buffers takes DISPLAY_MAX_BUF_LEN * DISPLAY_BAND_LINES
+// pixels, so bigger band trades RAM for fewer DMA transfers and less overhead
+// per frame. Value 1 means classic line by line update. Band is sent by one
+// transfer, so its size in bytes(display may need more than one byte per
+// pixel) can't be bigger than 65535 too, DisplayDrv::InitTask() checks it.
+#if !defined(DISPLAY_BAND_LINES)
+#define DISPLAY_BAND_LINES 1
+#endif
+#if ((DISPLAY_MAX_BUF_LEN) * (DISPLAY_BAND_LINES) > 65535)
+  #error "Display band can't be bigger than 65535 pixels"
+#endif
+
+// Number of display buffers in ring. If display driver reports transfer
+// completion via callback(see DISPLAY_TRANSFER_CALLBACK), next buffer transfer
+// started right from interrupt
+// and display task can render few bands ahead while previous ones are sent.
+// Without callback only two buffers are in use at the same time.
+#if !defined(DISPLAY_BUF_CNT)
+#define DISPLAY_BUF_CNT 2
+#endif
+#if (DISPLAY_BUF_CNT < 2)
+  #error "Display driver needs at least two buffers"
+#endif
+
+// Number of pixels in pattern buffer that display drivers use to fill lines
+// and rectangles with one color. Buffer is allocated on stack of the caller
+// and sent repeatedly, so bigger buffer means less SPI transfers per fill.
+#if !defined(DISPLAY_FILL_BUF_PIXELS)
+#define DISPLAY_FILL_BUF_PIXELS 32
+#endif
+#if ((DISPLAY_FILL_BUF_PIXELS < 2) || (DISPLAY_FILL_BUF_PIXELS % 2))
+  #error "Display fill buffer should have even number of pixels"
+#endif
+
 // By default there only one update area, that merges all update requests
 // by making multiple areas, there can be multiple non-intersect areas(intersect
 // areas still will be merged into one).
 //#define MULTIPLE_UPDATE_AREAS 32
 
+// Cost of one update window in pixels: address window setup, transfer start
+// and per area processing in display driver. Two update areas merged only if
+// one window that covers both has less pixels than two areas plus this cost.
+// Overlapped areas that isn't worth merging are split into non-overlapping
+// parts.
+#if !defined(UPDATE_AREA_WINDOW_COST)
+#define UPDATE_AREA_WINDOW_COST 128
+#endif
+
+// Alternative to MULTIPLE_UPDATE_AREAS for many small scattered updates: screen
+// divided into tiles of given size and update areas mark tiles as dirty. Runs
+// of dirty tiles sent to display as update areas. Bitmap takes 8 bytes per
+// row of tiles regardless of number of updates.
+//#define UPDATE_AREA_TILES 16
+
+// By default display driver goes trough all objects in the list for every line.
+// With this option display driver collects objects that intersect update area
+// into array sorted by start line and for each line goes only trough objects
+// that present on this line. Value defines maximum number of objects in the
+// area. If area contains more objects, all objects will be processed as usual.
+//#define DISPLAY_AREA_MAX_OBJECTS 64
+
+// With this option display driver keeps hash of each line sent to display and
+// doesn't send lines that are the same as already shown. Address window is set
+// from first changed line and set again after skipped lines. Takes 8 bytes per
+// line for DISPLAY_MAX_BUF_LEN lines.
+//#define DISPLAY_LINE_HASH
+
+// With this option display driver uses transfer complete callback of display
+// driver: waits on semaphore instead of polling and starts next buffer transfer
+// right from interrupt. Define it only if application forwards transfer
+// complete interrupt to SPI driver, for example calls
+// spi.TransferCompleteHandler() from HAL_SPI_TxCpltCallback(). Without it each
+// transfer is detected only after timeout.
+//#define DISPLAY_TRANSFER_CALLBACK
+
+// With this option display driver task only renders bands and sends them via
+// queue to separate transfer task that owns display while frame is sent.
+// Buffers are taken from pool of DISPLAY_BUF_CNT buffers and returned back
+// after transfer complete, so display driver task waits only if all buffers
+// are in flight.
+//#define DISPLAY_TRANSFER_TASK
+
+// By default display driver starts new frame as soon as update requested. With
+// this option frames are started not more often than given frame rate and all
+// updates requested during frame period are drawn in one frame.
+//#define DISPLAY_TARGET_FPS 30
+#if defined(DISPLAY_TARGET_FPS) && ((DISPLAY_TARGET_FPS < 1) || (DISPLAY_TARGET_FPS > 1000))
+  #error "DISPLAY_TARGET_FPS should be in range from 1 to 1000"
+#endif
+
+// Collect per frame statistics in display driver: render time, time waiting
+// for transfers and line mutex, lines, pixels, windows and merged areas. Each
+// value has min/avg/max and histogram. Times are measured in CPU cycles by DWT
+// cycle counter if it present, otherwise in RTOS ticks. Timestamp source can be
+// overridden by defining DISPLAY_STATS_TIMESTAMP().
+//#define DISPLAY_STATS
+
+// Measure cumulative draw time for each VisObject. Adds timestamp read before
+// and after each object draw call.
+//#define DISPLAY_STATS_OBJECTS
+
+// If DISPLAY_STATS_OBJECTS defined, DISPLAY_STATS have to be defined too
+#if defined(DISPLAY_STATS_OBJECTS) && !defined(DISPLAY_STATS)
+#define DISPLAY_STATS
+#endif
+
 // If MULTIPLE_UPDATE_AREAS defined, UPDATE_AREA_ENABLED have to be defined too
 #if defined(MULTIPLE_UPDATE_AREAS) && !defined(UPDATE_AREA_ENABLED)
 #define UPDATE_AREA_ENABLED
 #endif
 
+// If UPDATE_AREA_TILES defined, UPDATE_AREA_ENABLED have to be defined too
+#if defined(UPDATE_AREA_TILES)
+  #if defined(MULTIPLE_UPDATE_AREAS)
+    #error "UPDATE_AREA_TILES and MULTIPLE_UPDATE_AREAS can't be used together"
+  #endif
+  #if ((DISPLAY_MAX_BUF_LEN) + (UPDATE_AREA_TILES) - 1) / (UPDATE_AREA_TILES) > 64
+    #error "UPDATE_AREA_TILES too small: bitmap can't have more than 64 tiles in a row"
+  #endif
+  #if !defined(UPDATE_AREA_ENABLED)
+    #define UPDATE_AREA_ENABLED
+  #endif
+#endif
+
+// Glyph line cache: lines of scaled characters drawn with opaque background are
+// kept expanded to pixels and copied instead of decoded from font bits. Value
+// is number of cached lines for each built-in font(multiple of 4), it can be
+// set for one font by FONT_<W>x<H>_CACHE_LINES, 0 disables cache for the font.
+// Each line takes FONT_CACHE_LINE_PIXELS pixels plus about 12 bytes, lines of
+// scaled characters wider than that aren't cached.
+//#define FONT_CACHE_LINES 64
+#if defined(FONT_CACHE_LINES)
+  #if !defined(FONT_4x6_CACHE_LINES)
+    #define FONT_4x6_CACHE_LINES FONT_CACHE_LINES
+  #endif
+  #if !defined(FONT_6x8_CACHE_LINES)
+    #define FONT_6x8_CACHE_LINES FONT_CACHE_LINES
+  #endif
+  #if !defined(FONT_8x8_CACHE_LINES)
+    #define FONT_8x8_CACHE_LINES FONT_CACHE_LINES
+  #endif
+  #if !defined(FONT_8x12_CACHE_LINES)
+    #define FONT_8x12_CACHE_LINES FONT_CACHE_LINES
+  #endif
+  #if !defined(FONT_10x18_CACHE_LINES)
+    #define FONT_10x18_CACHE_LINES FONT_CACHE_LINES
+  #endif
+  #if !defined(FONT_12x16_CACHE_LINES)
+    #define FONT_12x16_CACHE_LINES FONT_CACHE_LINES
+  #endif
+#endif
+#if !defined(FONT_CACHE_LINE_PIXELS)
+#define FONT_CACHE_LINE_PIXELS 24
+#endif
+
+// Text objects(String, StringAligned) invalidate only changed characters when
+// text changes. Printf() into the object's own buffer creates new text on
+// stack to compare it with old one: buffers longer than this size invalidate
+// whole text.
+#if !defined(STRING_DIFF_BUF_SIZE)
+#define STRING_DIFF_BUF_SIZE 64
+#endif
+
 // Color depth used by display
 #if !defined(COLOR_24BIT) && !defined(COLOR_16BIT) && !defined(COLOR_3BIT)
 #define COLOR_16BIT
@@ -268,7 +428,8 @@ enum Color
 
   // Color mapped to basic colors
   COLOR_DARKGREY = COLOR_BLACK,
-  COLOR_GREY = COLOR_WHITE
+  COLOR_GREY = COLOR_WHITE,
+  COLOR_LIGHTGREY = COLOR_WHITE
 };
 #else
   #error NO COLOR DEPTH DEFINED
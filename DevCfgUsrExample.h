@@ -43,6 +43,18 @@
 // times more memory
 #define DISPLAY_MAX_BUF_LEN 320u
 
+// Number of lines rendered and sent to display in one transfer. Each of two
+// display buffers takes DISPLAY_MAX_BUF_LEN * DISPLAY_BAND_LINES pixels.
+//#define DISPLAY_BAND_LINES 8u
+
+// Number of display buffers in ring. More than two buffers are useful only if
+// display driver can report transfer completion via callback.
+//#define DISPLAY_BUF_CNT 3u
+
+// Number of pixels in pattern buffer used by display drivers for solid fills.
+// Allocated on stack of the task that calls FillRect()/FillScreen().
+//#define DISPLAY_FILL_BUF_PIXELS 64u
+
 // Color depth used by display
 //#define COLOR_24BIT
 //#define COLOR_16BIT
@@ -58,6 +70,51 @@
 // overflow, code will merge areas to update everything that have to be updated.
 //#define MULTIPLE_UPDATE_AREAS 32
 
+// Overhead of one update window in pixels. Two update areas are merged only if
+// one window that covers both is cheaper than two separate ones.
+//#define UPDATE_AREA_WINDOW_COST 128
+
+// Instead of list of areas keep bitmap of dirty tiles with given size. Useful
+// when a lot of small updates are scattered across the screen. Can't be used
+// together with MULTIPLE_UPDATE_AREAS.
+//#define UPDATE_AREA_TILES 16
+
+// With a lot of objects on the screen it makes sense to process only objects
+// that intersect update area and present on current line. This option defines
+// maximum number of such objects in one update area.
+//#define DISPLAY_AREA_MAX_OBJECTS 64
+
+// Don't send lines that are the same as already shown on display. Useful for
+// slow SPI displays when updates often don't change anything.
+//#define DISPLAY_LINE_HASH
+
+// Use transfer complete callback of display driver. Define only if transfer
+// complete interrupt forwarded to SPI driver: spi.TransferCompleteHandler()
+// called from HAL_SPI_TxCpltCallback().
+//#define DISPLAY_TRANSFER_CALLBACK
+
+// Render and send display buffers in two separate tasks. Display task renders
+// bands while transfer task sends previous ones to display.
+//#define DISPLAY_TRANSFER_TASK
+
+// Limit display frame rate. Updates requested during frame period are drawn
+// in one frame.
+//#define DISPLAY_TARGET_FPS 30
+
+// Collect display statistics(render and wait times, lines, pixels, windows and
+// merges) and optionally draw time for each visual object.
+//#define DISPLAY_STATS
+//#define DISPLAY_STATS_OBJECTS
+
+// Cache expanded lines of characters drawn with opaque background. Number of
+// lines for all fonts, FONT_<W>x<H>_CACHE_LINES sets it for one font.
+//#define FONT_CACHE_LINES 64
+//#define FONT_8x12_CACHE_LINES 128
+
+// Longest text that Printf() of text objects can compare with old text to
+// invalidate only changed characters(stack used by Printf()).
+//#define STRING_DIFF_BUF_SIZE 64
+
 // Display FPS/Touch/Update Area debug options
 //#define DISPLAY_DEBUG_INFO
 //#define DISPLAY_DEBUG_AREA
@@ -80,14 +80,22 @@
 #include "Interfaces/IPwm.h"
 
 // ***   Display Headers   *****************************************************
+#include "Display/AlphaBlend.h"
 #include "Display/DisplayDrv.h"
+#include "Display/DisplayStats.h"
+#include "Display/DisplayTransfer.h"
 #include "Display/Font.h"
+#include "Display/FontPacked.h"
 #include "Display/FT6236.h"
 #include "Display/GC9A01.h"
+#include "Display/GlyphCache.h"
+#include "Display/NumFormat.h"
 #include "Display/ILI9341.h"
 #include "Display/ILI9488.h"
 #include "Display/Image.h"
+#include "Display/MemoryDisplay.h"
 #include "Display/MultiLineString.h"
+#include "Display/PixelConvert.h"
 #include "Display/Primitives.h"
 #include "Display/ST7789.h"
 #include "Display/StringAligned.h"
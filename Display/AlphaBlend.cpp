@@ -0,0 +1,158 @@
+// *****************************************************************************
+// @file AlphaBlend.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Alpha Blending, implementation
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "AlphaBlend.h"
+
+// *****************************************************************************
+// ***   Public: Blend color into buffer   *************************************
+// *****************************************************************************
+void AlphaBlend::BlendColor(color_t* buf, uint32_t n, color_t color, uint8_t alpha)
+{
+  uint32_t i = 0u;
+  // Transparent - nothing to do
+  if(alpha == 0u)
+  {
+    i = n;
+  }
+  // Opaque - just fill
+  else if(alpha == 255u)
+  {
+    for(; i < n; i++) buf[i] = color;
+  }
+#if defined(COLOR_24BIT)
+  // Half transparent - average of pixels
+  else if(alpha == 128u)
+  {
+    for(; i < n; i++) buf[i] = Average888(color, buf[i]);
+  }
+  else
+  {
+    // Foreground multiplied by alpha calculated once
+    uint32_t a = alpha + (alpha >> 7u);
+    uint32_t rb = (color & 0x00FF00FFu) * a;
+    uint32_t g  = (color & 0x0000FF00u) * a;
+    for(; i < n; i++)
+    {
+      color_t bg = buf[i];
+      buf[i] = (((rb + (bg & 0x00FF00FFu) * (256u - a)) >> 8u) & 0x00FF00FFu) |
+               (((g  + (bg & 0x0000FF00u) * (256u - a)) >> 8u) & 0x0000FF00u);
+    }
+  }
+#elif defined(COLOR_16BIT)
+  else
+  {
+    // Two pixels of color in RGB565
+    uint32_t c = Swap16x2(color | ((uint32_t)color << 16u));
+    // Half transparent - average of pixels, two pixels per word
+    if(alpha == 128u)
+    {
+      for(; i + 2u <= n; i += 2u)
+      {
+        Store32(&buf[i], Swap16x2(Average565x2(c, Swap16x2(Load32(&buf[i])))));
+      }
+    }
+    else
+    {
+      // Foreground multiplied by alpha calculated once
+      uint32_t a = (alpha + 4u) >> 3u;
+      uint32_t fa = (c & MASK_A) * a;
+      uint32_t fb = ((c >> 5u) & MASK_B) * a;
+      // Two pixels per word
+      for(; i + 2u <= n; i += 2u)
+      {
+        Store32(&buf[i], Swap16x2(Mix565x2(fa, fb, Swap16x2(Load32(&buf[i])), 32u - a)));
+      }
+    }
+  }
+#endif
+  // Remaining pixels
+  for(; i < n; i++)
+  {
+    buf[i] = Blend(color, buf[i], alpha);
+  }
+}
+
+// *****************************************************************************
+// ***   Public: Blend pixels into buffer   ************************************
+// *****************************************************************************
+void AlphaBlend::BlendPixels(color_t* buf, const color_t* src, uint32_t n, uint8_t alpha)
+{
+  uint32_t i = 0u;
+  // Transparent - nothing to do
+  if(alpha == 0u)
+  {
+    i = n;
+  }
+  // Opaque - just copy
+  else if(alpha == 255u)
+  {
+    memcpy(buf, src, n * sizeof(color_t));
+    i = n;
+  }
+#if defined(COLOR_24BIT)
+  // Half transparent - average of pixels
+  else if(alpha == 128u)
+  {
+    for(; i < n; i++) buf[i] = Average888(src[i], buf[i]);
+  }
+#elif defined(COLOR_16BIT)
+  // Half transparent - average of pixels, two pixels per word
+  else if(alpha == 128u)
+  {
+    for(; i + 2u <= n; i += 2u)
+    {
+      Store32(&buf[i], Swap16x2(Average565x2(Swap16x2(Load32(&src[i])), Swap16x2(Load32(&buf[i])))));
+    }
+  }
+  else
+  {
+    uint32_t a = (alpha + 4u) >> 3u;
+    // Two pixels per word
+    for(; i + 2u <= n; i += 2u)
+    {
+      uint32_t f = Swap16x2(Load32(&src[i]));
+      Store32(&buf[i], Swap16x2(Mix565x2((f & MASK_A) * a, ((f >> 5u) & MASK_B) * a, Swap16x2(Load32(&buf[i])), 32u - a)));
+    }
+  }
+#endif
+  // Remaining pixels
+  for(; i < n; i++)
+  {
+    buf[i] = Blend(src[i], buf[i], alpha);
+  }
+}
+
+// *****************************************************************************
+// ***   Public: Blend pixels into buffer using alpha map   ********************
+// *****************************************************************************
+void AlphaBlend::BlendPixels(color_t* buf, const color_t* src, const uint8_t* map, uint32_t n, uint8_t alpha)
+{
+  // Object is transparent - nothing to do
+  if(alpha != 0u)
+  {
+    for(uint32_t i = 0u; i < n; i++)
+    {
+      uint8_t a = Scale(map[i], alpha);
+      // Alpha maps are mostly fully transparent or opaque pixels
+      if(a == 255u)   buf[i] = src[i];
+      else if(a != 0u) buf[i] = Blend(src[i], buf[i], a);
+    }
+  }
+}
@@ -0,0 +1,173 @@
+// *****************************************************************************
+// @file AlphaBlend.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Alpha Blending, header
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+
+#ifndef AlphaBlend_h
+#define AlphaBlend_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <DevCfg.h>
+
+#include <cstring>
+
+// *****************************************************************************
+// ***   AlphaBlend   **********************************************************
+// *****************************************************************************
+// * Blending of pixels with alpha for translucent visual objects. Alpha is
+// * opacity of drawn pixels: 0 - buffer isn't changed, 255 - pixels are
+// * copied. For COLOR_16BIT two pixels are blended at a time in one 32-bit
+// * word with 5-bit alpha, for COLOR_24BIT channels of pixel are blended at
+// * once with 8-bit alpha. COLOR_3BIT has no intermediate colors, so pixel is
+// * drawn if alpha is 128 or more. Buffers don't have to be aligned.
+class AlphaBlend
+{
+  public:
+    // *************************************************************************
+    // ***   Public: Blend one pixel   *****************************************
+    // *************************************************************************
+    static inline color_t Blend(color_t fg, color_t bg, uint8_t alpha)
+    {
+#if defined(COLOR_24BIT)
+      uint32_t a = alpha + (alpha >> 7u);
+      uint32_t rb = (((fg & 0x00FF00FFu) * a + (bg & 0x00FF00FFu) * (256u - a)) >> 8u) & 0x00FF00FFu;
+      uint32_t g  = (((fg & 0x0000FF00u) * a + (bg & 0x0000FF00u) * (256u - a)) >> 8u) & 0x0000FF00u;
+      return rb | g;
+#elif defined(COLOR_16BIT)
+      uint32_t a = (alpha + 4u) >> 3u;
+      // Spread components of RGB565 pixel to have free bits above each
+      uint32_t f = Swap16x2(fg);
+      uint32_t b = Swap16x2(bg);
+      f = (f | (f << 16u)) & 0x07E0F81Fu;
+      b = (b | (b << 16u)) & 0x07E0F81Fu;
+      uint32_t r = ((f * a + b * (32u - a)) >> 5u) & 0x07E0F81Fu;
+      return Swap16x2((r | (r >> 16u)) & 0xFFFFu);
+#else
+      return (alpha >= 128u) ? fg : bg;
+#endif
+    }
+
+    // *************************************************************************
+    // ***   Public: Blend color into buffer   *********************************
+    // *************************************************************************
+    // * Draws color with alpha over n pixels of buffer.
+    static void BlendColor(color_t* buf, uint32_t n, color_t color, uint8_t alpha);
+
+    // *************************************************************************
+    // ***   Public: Blend pixels into buffer   ********************************
+    // *************************************************************************
+    // * Draws n pixels from src with alpha over pixels of buffer.
+    static void BlendPixels(color_t* buf, const color_t* src, uint32_t n, uint8_t alpha);
+
+    // *************************************************************************
+    // ***   Public: Blend pixels into buffer using alpha map   ****************
+    // *************************************************************************
+    // * Draws n pixels from src over pixels of buffer. Alpha for each pixel is
+    // * taken from map and scaled by alpha.
+    static void BlendPixels(color_t* buf, const color_t* src, const uint8_t* map, uint32_t n, uint8_t alpha);
+
+    // *************************************************************************
+    // ***   Public: Scale alpha   *********************************************
+    // *************************************************************************
+    // * Alpha from map scaled by object alpha. Keep map value if object alpha
+    // * is 255.
+    static inline uint8_t Scale(uint8_t map_alpha, uint8_t alpha) {return (map_alpha * (alpha + 1u)) >> 8u;}
+
+  private:
+    // *************************************************************************
+    // ***   Private: Swap bytes of both half words   **************************
+    // *************************************************************************
+    // * color_t for COLOR_16BIT holds RGB565 with high byte first in memory.
+    // * Swap converts it to RGB565 value and back.
+    static inline uint32_t Swap16x2(uint32_t w) {return ((w & 0x00FF00FFu) << 8u) | ((w >> 8u) & 0x00FF00FFu);}
+
+    // *************************************************************************
+    // ***   Private: Load word from unaligned address   ***********************
+    // *************************************************************************
+    static inline uint32_t Load32(const void* ptr) {uint32_t w; memcpy(&w, ptr, sizeof(w)); return w;}
+
+    // *************************************************************************
+    // ***   Private: Store word to unaligned address   ************************
+    // *************************************************************************
+    static inline void Store32(void* ptr, uint32_t w) {memcpy(ptr, &w, sizeof(w));}
+
+    // *************************************************************************
+    // ***   Private: Average of two pairs of RGB565 pixels   ******************
+    // *************************************************************************
+    // * Low bit of each component cleared before shift, so it doesn't move to
+    // * neighbor component.
+    static inline uint32_t Average565x2(uint32_t x, uint32_t y) {return (x & y) + (((x ^ y) & 0xF7DEF7DEu) >> 1u);}
+
+    // *************************************************************************
+    // ***   Private: Average of two RGB888 pixels   ***************************
+    // *************************************************************************
+    static inline uint32_t Average888(uint32_t x, uint32_t y) {return (x & y) + (((x ^ y) & 0x00FEFEFEu) >> 1u);}
+
+    // *************************************************************************
+    // ***   Private: Blend two pairs of RGB565 pixels   ***********************
+    // *************************************************************************
+    // * Components split in two groups with five free bits above each:
+    // * MASK_A - blue and red of first pixel and green of second one, MASK_B
+    // * after shift right by five - green of first pixel, blue and red of
+    // * second one. fa and fb are groups of foreground multiplied by alpha,
+    // * ia is 32 - alpha.
+    static inline uint32_t Mix565x2(uint32_t fa, uint32_t fb, uint32_t bg, uint32_t ia)
+    {
+      uint32_t ra = ((fa + (bg & MASK_A) * ia) >> 5u) & MASK_A;
+      uint32_t rb = ((fb + ((bg >> 5u) & MASK_B) * ia) >> 5u) & MASK_B;
+      return ra | (rb << 5u);
+    }
+
+    // Components group masks for two RGB565 pixels in word
+    static const uint32_t MASK_A = 0x07E0F81Fu;
+    static const uint32_t MASK_B = 0x07C0F83Fu;
+};
+
+#endif
@@ -41,8 +41,11 @@ Result DisplayDrv::InitTask(IDisplay& in_display)
   // Set width and height variables for screen
   width = display->GetWidth();
   height = display->GetHeight();
-  // Check if we have enough buffer size to draw display line in any orientation
-  if((display->GetPixelDataCnt(width) > (int32_t)sizeof(scr_buf[0u])) || display->GetPixelDataCnt(height) > (int32_t)sizeof(scr_buf[0u]))
+  // Bytes of display band in any orientation
+  int32_t band_bytes = display->GetPixelDataCnt(MAX(width, height)) * DISPLAY_BAND_LINES;
+  // Check if we have enough buffer size to draw display band and if band can
+  // be sent by one transfer
+  if((band_bytes > (int32_t)sizeof(scr_buf[0u])) || (band_bytes > MAX_TRANSFER_BYTES))
   {
     Break();
   }
@@ -63,8 +66,11 @@ Result DisplayDrv::InitTask(IDisplay& in_display, ITouchscreen& in_touch)
   // Set width and height variables for screen
   width = display->GetWidth();
   height = display->GetHeight();
-  // Check if we have enough buffer size to draw display line in any orientation
-  if((display->GetPixelDataCnt(width) > (int32_t)sizeof(scr_buf[0u])) || display->GetPixelDataCnt(height) > (int32_t)sizeof(scr_buf[0u]))
+  // Bytes of display band in any orientation
+  int32_t band_bytes = display->GetPixelDataCnt(MAX(width, height)) * DISPLAY_BAND_LINES;
+  // Check if we have enough buffer size to draw display band and if band can
+  // be sent by one transfer
+  if((band_bytes > (int32_t)sizeof(scr_buf[0u])) || (band_bytes > MAX_TRANSFER_BYTES))
   {
     Break();
   }
@@ -87,6 +93,22 @@ Result DisplayDrv::Setup()
   {
     // Init display driver
     display->Init();
+#if defined(DISPLAY_TRANSFER_TASK)
+    // Transfers done by transfer task, it also receives transfer complete
+    // notifications
+    transfer.InitTask(*display);
+#elif defined(DISPLAY_TRANSFER_CALLBACK)
+    // Use transfer complete notification if display driver supports it
+    is_transfer_callback = display->SetTransferCompleteCallback(this).IsGood();
+#endif
+#if defined(DISPLAY_LINE_HASH)
+    // Display content is unknown after init
+    ResetLineHash();
+#endif
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+    // Set storage for objects present in update area
+    list.SetAreaStorage(&area_objects);
+#endif
     // Set inversion
     InvertDisplay(inversion);
     // Set mode - mode can be set earlier than Display initialization
@@ -105,6 +127,8 @@ Result DisplayDrv::Setup()
     }
 
 #if defined(DISPLAY_DEBUG_INFO)
+    // Debug objects belong to this display, not to the default list
+    fps_str.SetList(list);
     // Set string parameters
     fps_str.SetParams(str, width/3, height - 12, COLOR_MAGENTA, Font_4x6::GetInstance());
     // Max Z
@@ -112,6 +136,8 @@ Result DisplayDrv::Setup()
 #endif
 
 #if defined(DISPLAY_DEBUG_TOUCH)
+    // Debug objects belong to this display, not to the default list
+    touch_cir.SetList(list);
     // Set circle parameters
     touch_cir.SetParams(0, 0, 3, COLOR_YELLOW, true);
     // Max Z
@@ -141,11 +167,44 @@ Result DisplayDrv::Loop()
   // even if display is not updated
   if(screen_update.Take(50U) == Result::RESULT_OK)
   {
+#if defined(DISPLAY_TARGET_FPS)
+    // Wait for next frame slot. All updates requested in the meantime are
+    // drawn in this frame.
+    WaitFrameSlot();
+#endif
+    // Start frame right after display starts vertical blanking
+    if(te != nullptr) WaitTearingEffect();
     // Set window for all screen and pointer to first pixel
     //if(is_dirty && (LockDisplay() == Result::RESULT_OK))
     if(LockDisplay() == Result::RESULT_OK)
     {
-#if defined(UPDATE_AREA_ENABLED) && defined(MULTIPLE_UPDATE_AREAS)
+      // Time when frame started
+      uint32_t frame_start_ms = RtosTick::GetTimeMs();
+      // Clear transfer counters for new frame
+      frame_transfers = 0u;
+      frame_bytes = 0u;
+      frame_pixels = 0u;
+      frame_lines = 0u;
+#if defined(DISPLAY_STATS)
+      // Clear statistics counters for new frame
+      uint32_t stat_start = DisplayStats::GetTimestamp();
+      stat_wait_time = 0u;
+      stat_lock_time = 0u;
+#endif
+      frame_windows = 0u;
+#if defined(DISPLAY_TRANSFER_TASK)
+      // Clear time counters for new frame
+      frame_wait_ms = 0u;
+      frame_max_in_flight = 0u;
+      transfer.ClearTransferTime();
+#endif
+      // Shift content of scroll area right before newly exposed lines drawn
+      if(is_scroll_changed)
+      {
+        display->SetScrollOffset(scroll_offset);
+        is_scroll_changed = false;
+      }
+#if defined(UPDATE_AREA_ENABLED) && (defined(MULTIPLE_UPDATE_AREAS) || defined(UPDATE_AREA_TILES))
       // Get current number of update areas
       uint32_t n = areas.GetItemsCnt();
       // To process touch we should not sit there forever if areas constantly adding
@@ -153,10 +212,10 @@ Result DisplayDrv::Loop()
 #endif
       {
         // Take line semaphore to copy area
-        line_mutex.Lock();
+        LockLine();
 #if defined(UPDATE_AREA_ENABLED)
         // Get update ares
-  #if defined(MULTIPLE_UPDATE_AREAS)
+  #if defined(MULTIPLE_UPDATE_AREAS) || defined(UPDATE_AREA_TILES)
         areas.Pop(area);
   #else
         // Clear flag to allow invalidate smaller area
@@ -174,74 +233,58 @@ Result DisplayDrv::Loop()
         uint16_t end_x = width - 1u;
         uint16_t end_y = height - 1u;
 #endif
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+        // Set area to collect objects to draw
+        list.SetDrawArea(start_x, start_y, end_x, end_y);
+#endif
+        // Area higher than wide is sent by fewer lines if drawn by columns
+        if(update_mode == UPDATE_AUTO)
+        {
+          bool is_column = (end_y - start_y) > (end_x - start_x);
+          if(is_column != is_column_order) SetScanOrder(is_column);
+        }
+        // Areas are stored in screen coordinates, convert area to display
+        // coordinates if it drawn by columns
+        if(is_column_order)
+        {
+          uint16_t tmp = start_x;
+          start_x = start_y;
+          start_y = width - 1 - end_x;
+          end_x = end_y;
+          end_y = width - 1 - tmp;
+        }
 
         // Give semaphore after changes
         line_mutex.Release();
 
-        // Set flag if data need preparation - call virtual function once per frame
-        bool is_data_need_preparation = display->IsDataNeedPreparation();
-        // Set address window for all screen
-        display->SetAddrWindow(start_x, start_y, end_x, end_y);
-        // Find number of pixels for given area
-        uint16_t pixels_cnt = end_x - start_x + 1u;
-        // For each line/row
-        for(int32_t i = start_y; i <= end_y; i++)
-        {
-          // Find current line in buffer
-          scr_line_idx = i % 2;
-          // Clear half of buffer
-          for(uint32_t i = 0u; i < DISPLAY_MAX_BUF_LEN; i++) scr_buf[scr_line_idx][i] = bkg_color;
-          // Take semaphore before draw line
-          line_mutex.Lock();
-          // Draw list to buf                  TODO: UPDATE_LEFT_RIGHT is not works correctly if area_x isn't centered on a display
-          if(update_mode == UPDATE_LEFT_RIGHT) list.DrawInBufH(scr_buf[scr_line_idx], pixels_cnt, end_y - i, start_x);
-          else                                 list.DrawInBufW(scr_buf[scr_line_idx], pixels_cnt, i, start_x);
-          // Give semaphore after changes
-          line_mutex.Release();
-#if defined(DISPLAY_DEBUG_AREA) // Show display area as needed. Allow to debug unnecessary display updates.
-          // Sequential colors will help to see updated area.
-          static color_t colors[] = {COLOR_WHITE, COLOR_RED, COLOR_GREEN, COLOR_BLUE, COLOR_YELLOW, COLOR_CYAN, COLOR_MAGENTA};
-          static uint32_t cidx = 0;
-          // Change color only at first line
-          if(i == start_y)
-          {
-            cidx++;
-            if(cidx >= NumberOf(colors)) cidx = 0u;
-          }
-
-          if((i == start_y) || (i == end_y))
-          {
-            for(uint32_t i = 0; i < pixels_cnt; i++)
-            {
-              scr_buf[scr_line_idx][i] = colors[cidx];
-            }
-          }
-          else
-          {
-            scr_buf[scr_line_idx][0] = colors[cidx];
-            scr_buf[scr_line_idx][pixels_cnt - 1] = colors[cidx];
-          }
-#endif
-          // Check display bits per color
-          if(is_data_need_preparation)
-          {
-            display->PrepareData(scr_buf[scr_line_idx], pixels_cnt);
-          }
-          // Wait until previous transfer complete
-          while(display->IsTransferComplete() == false) RtosTick::Yield();
-          // Write stream to LCD
-          display->WriteDataStream((uint8_t*)scr_buf[scr_line_idx], display->GetPixelDataCnt(pixels_cnt));
-          // DO NOT TRY "OPTIMIZE" CODE !!!
-          // Two "while" cycles used for generate next line when previous line
-          // transfer via SPI to display.
-        }
-        // Wait until last transfer complete
-        while(display->IsTransferComplete() == false) RtosTick::Yield();
-        // Pull up CS
-        display->StopTransfer();
+        // Draw visible part of area
+        DrawArea(start_x, start_y, end_x, end_y);
       }
+#if defined(DISPLAY_TRANSFER_TASK)
+      // Time spent for rendering is frame time without waiting for buffers
+      frame_render_ms = RtosTick::GetTimeMs() - frame_start_ms - frame_wait_ms;
+      // Wait until transfer task sends everything before unlock display
+      WaitTransferComplete();
+      // Save time spent for transfers
+      frame_transfer_ms = transfer.GetTransferTimeMs();
+#endif
+#if defined(DISPLAY_STATS)
+      // Add frame values to statistics
+      UpdateStats(stat_start);
+#endif
       // Give semaphore after draw frame
       UnlockDisplay();
+      // Frame time and frame rate from interval between frames
+      frame_time_ms = RtosTick::GetTimeMs() - frame_start_ms;
+      uint32_t interval_ms = frame_start_ms - last_frame_start_ms;
+      frame_rate_x10 = (interval_ms > 0u) ? ((1000u * 10u) / interval_ms) : 0u;
+      last_frame_start_ms = frame_start_ms;
+#if defined(DISPLAY_TARGET_FPS)
+      // Frame that took longer than frame period misses next frame slot
+      if(frame_time_ms > FRAME_PERIOD_MS) missed_frames++;
+      // Next frame can be started one period after this one
+      next_frame_ms = frame_start_ms + FRAME_PERIOD_MS;
+#endif
 #if defined(DISPLAY_DEBUG_INFO)
       // Calculate FPS in format XX.X
       fps_x10 = (1000 * 10) / (RtosTick::GetTimeMs() - time_ms);
@@ -317,6 +360,31 @@ Result DisplayDrv::Loop()
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   Public: Transfer complete callback(called from interrupt)   ***********
+// *****************************************************************************
+void DisplayDrv::Callback(void* ptr)
+{
+  // Process only transfers started by display driver(SPI can be shared with
+  // other devices) and only if completion of started transfer isn't consumed
+  // yet by WaitTransferNotification()
+  if((tx_cnt > 0u) && (tx_done_seq != tx_seq))
+  {
+    // Transfer of first buffer in queue is complete - remove it from queue
+    tx_idx = (tx_idx + 1u) % DISPLAY_BUF_CNT;
+    tx_cnt--;
+    tx_done_seq = tx_seq;
+    // Start transfer of next buffer in queue if any
+    if(tx_cnt > 0u)
+    {
+      tx_seq++;
+      display->WriteDataStream((uint8_t*)scr_buf[tx_idx], scr_buf_bytes[tx_idx]);
+    }
+  }
+  // Notify display task
+  transfer_complete.Give();
+}
+
 // *****************************************************************************
 // ***   Public: Set display driver   ******************************************
 // *****************************************************************************
@@ -364,14 +432,7 @@ Result DisplayDrv::InvalidateArea(int16_t start_x, int16_t start_y, int16_t end_
   // Set area only if it is valid
   if((start_x <= end_x) && (start_y <= end_y))
   {
-    if(update_mode == UPDATE_LEFT_RIGHT)
-    {
-      // Swap area X and Y it refreshing mode left to right
-      SwapData(start_x, start_y);
-      SwapData(end_x, end_y);
-    }
-
-#if defined(MULTIPLE_UPDATE_AREAS)
+#if defined(MULTIPLE_UPDATE_AREAS) || defined(UPDATE_AREA_TILES)
     // Add new area to existing one
     area.start_x = start_x;
     area.start_y = start_y;
@@ -387,6 +448,10 @@ Result DisplayDrv::InvalidateArea(int16_t start_x, int16_t start_y, int16_t end_
       if(start_y < area.start_y) area.start_y = start_y;
       if(end_x > area.end_x) area.end_x = end_x;
       if(end_y > area.end_y) area.end_y = end_y;
+#if defined(DISPLAY_STATS)
+      // Count merged areas
+      area_merges++;
+#endif
     }
     else
     {
@@ -421,7 +486,7 @@ void DisplayDrv::InvertDisplay(bool invert)
   // Lock display
   LockDisplay();
   // Wait while transfer complete before change settings
-  while(display->IsTransferComplete() == false);
+  WaitTransferComplete();
   // Set rotation
   display->InvertDisplay(invert);
   // Save inversion
@@ -438,14 +503,22 @@ void DisplayDrv::SetRotation(IDisplay::Rotation rot)
   // Lock display
   LockDisplay();
   // Wait while transfer complete before change settings
-  while(display->IsTransferComplete() == false);
+  WaitTransferComplete();
   // Set rotation
   display->SetRotation(rot);
+  // Scroll area is set for previous rotation
+  ClearScroll();
+  // Visible part of display can depend on rotation
+  mask = display->GetVisibleMask();
   // Set width and height variables for selected screen update mode
   width = display->GetWidth();
   height = display->GetHeight();
   // Save rotation
   rotation = rot;
+#if defined(DISPLAY_LINE_HASH)
+  // Lines are different after rotation
+  ResetLineHash();
+#endif
   // Update main list to match full screen
   list.SetParams(0, 0, width, height);
   // Unlock display
@@ -477,10 +550,202 @@ void DisplayDrv::SetUpdateMode(UpdateMode mode)
 {
   // Lock display
   LockDisplay();
+  // Scroll area is set for previous display orientation
+  ClearScroll();
+  // Change Update mode, auto mode starts from lines
+  SetScanOrder(mode == UPDATE_LEFT_RIGHT);
+  // Save Update mode
+  update_mode = mode;
+  // Unlock display
+  UnlockDisplay();  
+  // Set update adea to full screen
+  InvalidateArea(0, 0, width, height);
+}
+
+// *****************************************************************************
+// ***   Public: Set Scroll Area   *********************************************
+// *****************************************************************************
+Result DisplayDrv::SetScrollArea(int16_t start, int16_t end)
+{
+  // Hardware scroll can be used only in top to bottom update mode
+  Result result = Result::ERR_CANNOT_EXECUTE;
+  // Lock display
+  LockDisplay();
+  // Wait while transfer complete before change settings
+  WaitTransferComplete();
+  // Disable previous scroll area
+  ClearScroll();
+  // Set new scroll area
+  if((update_mode == UPDATE_TOP_BOTTOM) && (start <= end))
+  {
+    // Scroll axis depends on display orientation
+    scroll_along_x = display->IsScrollAlongX();
+    // Scroll area has to be inside the screen
+    int32_t len = scroll_along_x ? width : height;
+    if((start < 0) || (end >= len))
+    {
+      result = Result::ERR_BAD_PARAMETER;
+    }
+    else
+    {
+      // Set scroll area in display
+      result = display->SetScrollArea(start, end);
+      // Save scroll area if display supports it
+      if(result.IsGood())
+      {
+        scroll_start = start;
+        scroll_end = end;
+      }
+    }
+  }
+  else if(start > end)
+  {
+    // Scroll disabled
+    result = Result::RESULT_OK;
+  }
+#if defined(DISPLAY_LINE_HASH)
+  // Lines can be shown from other places of display memory now
+  ResetLineHash();
+#endif
+  // Unlock display
+  UnlockDisplay();
+  // Display memory content is shown in different places now
+  InvalidateArea(0, 0, width, height);
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Scroll object   ***********************************************
+// *****************************************************************************
+Result DisplayDrv::Scroll(VisObject& obj, int16_t delta)
+{
+  // Result
+  Result result = Result::RESULT_OK;
+  // Lock display - scroll can't be changed during frame drawing
+  LockDisplay();
+  // Take line semaphore before move object
+  line_mutex.Lock();
+  // Object have to be in list
+  if(obj.list == nullptr)
+  {
+    result = Result::ERR_NULL_PTR;
+  }
+  // If there is no scroll area or display isn't drawn line by line - just
+  // move object
+  else if((scroll_start > scroll_end) || (update_mode != UPDATE_TOP_BOTTOM) || is_column_order)
+  {
+    if(scroll_along_x) obj.Move(delta, 0, true);
+    else               obj.Move(0, delta, true);
+    result = Result::ERR_CANNOT_EXECUTE;
+  }
+  else if(delta != 0)
+  {
+    // Move object without invalidation: content already drawn is moved by
+    // display itself. List collects objects for draw area again.
+    if(scroll_along_x) result = obj.list->ShiftVisObject(&obj, delta, 0);
+    else               result = obj.list->ShiftVisObject(&obj, 0, delta);
+    // Size of scroll area
+    int32_t size = scroll_end - scroll_start + 1;
+    // Content moves forward when display memory shown from previous lines
+    scroll_offset = (((scroll_offset - delta) % size) + size) % size;
+    is_scroll_changed = true;
+#if defined(DISPLAY_LINE_HASH)
+    // Lines of scroll area shown from other places of display memory now
+    ResetLineHash();
+#endif
+    // Lines exposed by scroll
+    int32_t start = scroll_start;
+    int32_t end = scroll_end;
+    if((delta >= 0) && (delta < size)) end = scroll_start + delta - 1;
+    else if((delta < 0) && (-delta < size)) start = scroll_end + delta + 1;
+#if defined(UPDATE_AREA_ENABLED)
+  #if defined(MULTIPLE_UPDATE_AREAS) || defined(UPDATE_AREA_TILES)
+    bool is_pending = !areas.IsEmpty();
+  #else
+    bool is_pending = is_dirty;
+  #endif
+    // Area that isn't drawn yet can be moved to wrong place, redraw whole
+    // scroll area in this case
+    if(is_pending)
+    {
+      start = scroll_start;
+      end = scroll_end;
+    }
+#endif
+    // Draw exposed lines
+    if(scroll_along_x) InvalidateArea(start, 0, end, height - 1);
+    else               InvalidateArea(0, start, width - 1, end);
+  }
+  // Give semaphore after changes
+  line_mutex.Release();
+  // Unlock display
+  UnlockDisplay();
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Check if area is visible   ************************************
+// *****************************************************************************
+bool DisplayDrv::IsAreaVisible(int32_t start_x, int32_t start_y, int32_t end_x, int32_t end_y)
+{
+  // Whole display is visible by default
+  bool is_visible = true;
+  // Check area against visibility mask
+  if(mask != nullptr)
+  {
+    // Mask is in display coordinates
+    if(is_column_order)
+    {
+      int32_t tmp = start_x;
+      start_x = start_y;
+      start_y = width - 1 - end_x;
+      end_x = end_y;
+      end_y = width - 1 - tmp;
+    }
+    // Clip area to display lines
+    int32_t lines = display->GetHeight();
+    if(start_y < 0) start_y = 0;
+    if(end_y >= lines) end_y = lines - 1;
+    // Area is visible if it intersects visible span of any line
+    is_visible = false;
+    for(int32_t y = start_y; (y <= end_y) && !is_visible; y++)
+    {
+      is_visible = (mask[y].start <= end_x) && (mask[y].end >= start_x) && (mask[y].start <= mask[y].end);
+    }
+  }
+  // Return result
+  return is_visible;
+}
+
+// *****************************************************************************
+// ***   Private: Clear scroll area   ******************************************
+// *****************************************************************************
+void DisplayDrv::ClearScroll(void)
+{
+  // If scroll area is set
+  if(scroll_start <= scroll_end)
+  {
+    // Show display memory without offset
+    display->SetScrollOffset(0u);
+    // Clear scroll area
+    scroll_start = 0;
+    scroll_end = -1;
+    scroll_offset = 0;
+    is_scroll_changed = false;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Set scan order   *********************************************
+// *****************************************************************************
+void DisplayDrv::SetScanOrder(bool is_column)
+{
   // Wait while transfer complete before change settings
-  while(display->IsTransferComplete() == false);
-  // Change Update mode
-  if(mode == UPDATE_LEFT_RIGHT)
+  WaitTransferComplete();
+  // Rows are drawn as lines of display rotated counterclockwise
+  if(is_column)
   {
     display->SetRotation(((rotation - 1u) < IDisplay::ROTATION_CNT) ? (IDisplay::Rotation)(rotation - 1u) : IDisplay::ROTATION_RIGHT);
   }
@@ -488,12 +753,762 @@ void DisplayDrv::SetUpdateMode(UpdateMode mode)
   {
     display->SetRotation(rotation);
   }
-  // Save Update mode
-  update_mode = mode;
+  // Save scan order
+  is_column_order = is_column;
+  // Visible part of display can depend on rotation
+  mask = display->GetVisibleMask();
+#if defined(DISPLAY_LINE_HASH)
+  // Lines are different in other scan order
+  ResetLineHash();
+#endif
+}
+
+// *****************************************************************************
+// ***   Private: Draw area   **************************************************
+// *****************************************************************************
+void DisplayDrv::DrawArea(uint16_t start_x, uint16_t start_y, uint16_t end_x, uint16_t end_y)
+{
+  // Without mask whole area is visible
+  if(mask == nullptr)
+  {
+    DrawScrollArea(start_x, start_y, end_x, end_y);
+  }
+  else
+  {
+    // Lines are grouped to windows. Line added to window if pixels outside
+    // visible spans cost less than new window.
+    int32_t y = start_y;
+    while(y <= end_y)
+    {
+      // Visible span of first line of window
+      int32_t first = y;
+      int32_t sx = MAX(start_x, mask[y].start);
+      int32_t ex = MIN(end_x, mask[y].end);
+      y++;
+      // Skip invisible line
+      if(sx > ex) continue;
+      // Number of invisible pixels in window
+      int32_t waste = 0;
+      while(y <= end_y)
+      {
+        // Visible span of next line
+        int32_t lsx = MAX(start_x, mask[y].start);
+        int32_t lex = MIN(end_x, mask[y].end);
+        if(lsx > lex) break;
+        // Window span with this line
+        int32_t nsx = MIN(sx, lsx);
+        int32_t nex = MAX(ex, lex);
+        // Invisible pixels added by extending window lines and by this line
+        int32_t add = ((nex - nsx) - (ex - sx)) * (y - first) + ((nex - nsx) - (lex - lsx));
+        if(waste + add > UPDATE_AREA_WINDOW_COST) break;
+        // Add line to window
+        waste += add;
+        sx = nsx;
+        ex = nex;
+        y++;
+      }
+#if defined(COLOR_3BIT)
+      // In 3 bit mode each byte contains 2 pixels
+      sx &= ~1;
+      ex = MIN(end_x, ex | 1);
+#endif
+      // Draw window
+      DrawScrollArea(sx, first, ex, y - 1);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Draw area with hardware scroll   *****************************
+// *****************************************************************************
+void DisplayDrv::DrawScrollArea(uint16_t start_x, uint16_t start_y, uint16_t end_x, uint16_t end_y)
+{
+  // Area coordinates along scroll axis
+  int32_t start = scroll_along_x ? start_x : start_y;
+  int32_t end = scroll_along_x ? end_x : end_y;
+  // Draw area part by part
+  while(start <= end)
+  {
+    // Whole area by default
+    int32_t part_end = end;
+    // Lines of scroll area are shifted in display memory, so part can't cross
+    // borders of scroll area and line where it wraps around
+    if(scroll_start <= scroll_end)
+    {
+      // First line shown from the start of scroll area in display memory
+      int32_t wrap = scroll_end + 1 - scroll_offset;
+      if(start < scroll_start)     part_end = MIN(end, scroll_start - 1);
+      else if(start < wrap)        part_end = MIN(end, wrap - 1);
+      else if(start <= scroll_end) part_end = MIN(end, scroll_end);
+    }
+    // Draw part of area
+    if(scroll_along_x) DrawAreaPart(start, start_y, part_end, end_y);
+    else               DrawAreaPart(start_x, start, end_x, part_end);
+    // Next part
+    start = part_end + 1;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Draw part of area   ******************************************
+// *****************************************************************************
+void DisplayDrv::DrawAreaPart(uint16_t start_x, uint16_t start_y, uint16_t end_x, uint16_t end_y)
+{
+  // Set flag if data need preparation - call virtual function once per frame
+  bool is_data_need_preparation = display->IsDataNeedPreparation();
+  // Find number of pixels for given area
+  uint16_t pixels_cnt = end_x - start_x + 1u;
+#if defined(DISPLAY_LINE_HASH)
+  // Line that display expects next. Address window is set at first
+  // changed line and after each skipped line.
+  int32_t window_line = -1;
+#else
+  // Set address window for all screen
+  SetAddrWindow(start_x, start_y, end_x, end_y);
+#endif
+#if defined(DISPLAY_DEBUG_AREA)
+  // Sequential colors will help to see updated area.
+  static const color_t colors[] = {COLOR_WHITE, COLOR_RED, COLOR_GREEN, COLOR_BLUE, COLOR_YELLOW, COLOR_CYAN, COLOR_MAGENTA};
+  // Change color for each area
+  debug_color_idx++;
+  if(debug_color_idx >= NumberOf(colors)) debug_color_idx = 0u;
+#endif
+  // Number of lines in current buffer
+  int32_t lines_cnt = 0;
+  // Number of background lines to send. Lines in buffer and background lines
+  // are sent in order, so only one of counters can be non zero.
+  int32_t bkg_cnt = 0;
+  // Number of lines drawn since semaphore taken
+  int32_t locked_cnt = 0;
+  // Get free buffer from ring
+  scr_line_idx = GetFreeBuffer();
+  // Buffer taken, but not sent yet
+  bool is_buffer_held = true;
+  // For each line/row
+  for(int32_t i = start_y; i <= end_y; i++)
+  {
+    // Take semaphore before draw band
+    if(locked_cnt == 0) LockLine();
+    // Pointer to current line in buffer. Lines follow each other in
+    // buffer without gaps, so whole band can be sent as one stream.
+    color_t* line_buf = &scr_buf[scr_line_idx][pixels_cnt * lines_cnt];
+#if defined(DISPLAY_DEBUG_AREA)
+    // Debug frame is drawn in buffer, so every line have to be drawn
+    bool is_bkg = false;
+#else
+    // Line without objects is sent as repeated background color
+    bool is_bkg = is_column_order ? list.IsRowEmpty(width - 1 - i, start_x, pixels_cnt)
+                                  : list.IsLineEmpty(i, start_x, pixels_cnt);
+#endif
+    // Draw list to buf
+    if(!is_bkg)
+    {
+      if(is_column_order)
+      {
+        // Display line is screen row, background is filled only where row
+        // isn't covered by opaque object
+        list.DrawInBufH(line_buf, pixels_cnt, width - 1 - i, start_x, bkg_color);
+      }
+      else
+      {
+        // Draw list to buf, background is filled only where line isn't
+        // covered by opaque object
+        list.DrawInBufW(line_buf, pixels_cnt, i, start_x, bkg_color);
+      }
+    }
+    // Count drawn lines
+    locked_cnt++;
+#if defined(DISPLAY_DEBUG_AREA) // Show display area as needed. Allow to debug unnecessary display updates.
+    if((i == start_y) || (i == end_y))
+    {
+      for(uint32_t p = 0; p < pixels_cnt; p++)
+      {
+        line_buf[p] = colors[debug_color_idx];
+      }
+    }
+    else
+    {
+      line_buf[0] = colors[debug_color_idx];
+      line_buf[pixels_cnt - 1] = colors[debug_color_idx];
+    }
+#endif
+#if defined(DISPLAY_LINE_HASH)
+    // Hash of background line is found without filling buffer
+    uint32_t hash = is_bkg ? GetLineHash(bkg_color, pixels_cnt) : GetLineHash(line_buf, pixels_cnt);
+    // Skip line if display already shows the same
+    bool is_changed = IsLineChanged(i, start_x, end_x, hash);
+    if(!is_changed)
+    {
+      // Lines waiting to be sent have to be sent before address window change
+      if((lines_cnt > 0) || (bkg_cnt > 0))
+      {
+        // Give semaphore before send
+        line_mutex.Release();
+        locked_cnt = 0;
+      }
+      // Send lines and get next buffer
+      if(lines_cnt > 0)
+      {
+        SendBuffer(pixels_cnt, lines_cnt, is_data_need_preparation);
+        scr_line_idx = GetFreeBuffer();
+        is_buffer_held = true;
+        lines_cnt = 0;
+      }
+      // Send background lines
+      if(bkg_cnt > 0)
+      {
+        SendBackground(pixels_cnt, bkg_cnt);
+        bkg_cnt = 0;
+      }
+    }
+    // If previous line was skipped - address window have to be set
+    else if(window_line != i)
+    {
+      // Give semaphore before wait
+      line_mutex.Release();
+      locked_cnt = 0;
+      // Pull up CS if window was set before
+      if(window_line >= 0) StopTransfer();
+      // Set address window from changed line
+      SetAddrWindow(start_x, i, end_x, end_y);
+    }
+    // Next line expected by display
+    if(is_changed) window_line = i + 1;
+#else
+    // Every line is sent
+    bool is_changed = true;
+#endif
+    // Line have to be sent
+    if(is_changed && is_bkg)
+    {
+      // Lines in buffer have to be sent before background lines
+      if(lines_cnt > 0)
+      {
+        // Give semaphore before send
+        if(locked_cnt > 0) line_mutex.Release();
+        locked_cnt = 0;
+        // Send lines and get next buffer
+        SendBuffer(pixels_cnt, lines_cnt, is_data_need_preparation);
+        scr_line_idx = GetFreeBuffer();
+        is_buffer_held = true;
+        lines_cnt = 0;
+      }
+      // Count background line
+      bkg_cnt++;
+    }
+    else if(is_changed)
+    {
+      // Background lines have to be sent before lines in buffer
+      if(bkg_cnt > 0)
+      {
+        // Give semaphore before send
+        if(locked_cnt > 0) line_mutex.Release();
+        locked_cnt = 0;
+        // Send background lines
+        SendBackground(pixels_cnt, bkg_cnt);
+        bkg_cnt = 0;
+      }
+      // Line stays in buffer
+      lines_cnt++;
+    }
+    // Send background lines if last line reached
+    if((i == end_y) && (bkg_cnt > 0))
+    {
+      // Give semaphore before send
+      if(locked_cnt > 0) line_mutex.Release();
+      locked_cnt = 0;
+      // Send background lines
+      SendBackground(pixels_cnt, bkg_cnt);
+      bkg_cnt = 0;
+    }
+    // Send lines if buffer is full or last line drawn
+    if((lines_cnt == DISPLAY_BAND_LINES) || ((i == end_y) && (lines_cnt > 0)))
+    {
+      // Give semaphore before send
+      if(locked_cnt > 0) line_mutex.Release();
+      locked_cnt = 0;
+      // Send band to display. Next band will be rendered while this one
+      // transfer via SPI to display.
+      SendBuffer(pixels_cnt, lines_cnt, is_data_need_preparation);
+      is_buffer_held = false;
+      // Get next buffer if there more lines
+      if(i < end_y)
+      {
+        scr_line_idx = GetFreeBuffer();
+        is_buffer_held = true;
+      }
+      lines_cnt = 0;
+    }
+    // Give semaphore after band of lines drawn
+    else if(locked_cnt >= DISPLAY_BAND_LINES)
+    {
+      line_mutex.Release();
+      locked_cnt = 0;
+    }
+  }
+  // Give semaphore if last lines were skipped
+  if(locked_cnt > 0) line_mutex.Release();
+  // Return buffer if last lines were skipped
+  if(is_buffer_held) ReleaseBuffer(scr_line_idx);
+#if defined(DISPLAY_LINE_HASH)
+  // Pull up CS if window was set
+  if(window_line >= 0) StopTransfer();
+#else
+  // Pull up CS
+  StopTransfer();
+#endif
+}
+
+// *****************************************************************************
+// ***   Private: Get free buffer from ring   **********************************
+// *****************************************************************************
+uint8_t DisplayDrv::GetFreeBuffer(void)
+{
+  uint8_t idx = 0u;
+#if defined(DISPLAY_STATS)
+  // Time when wait started
+  uint32_t wait_start = DisplayStats::GetTimestamp();
+#endif
+
+#if defined(DISPLAY_TRANSFER_TASK)
+  // Time when wait started
+  uint32_t start_ms = RtosTick::GetTimeMs();
+  // Take buffer from pool, wait if all buffers are in flight
+  idx = transfer.GetFreeBuffer();
+  // Update wait time
+  frame_wait_ms += RtosTick::GetTimeMs() - start_ms;
+#else
+  // If transfers queued and started from callback
+  if(is_transfer_callback)
+  {
+    // Wait until at least one buffer isn't in transfer queue
+    while(tx_cnt >= DISPLAY_BUF_CNT) WaitTransferNotification();
+    // First buffer after transfer queue is free. Critical section is needed
+    // since callback can change both values.
+    Rtos::EnterCriticalSection();
+    idx = (tx_idx + tx_cnt) % DISPLAY_BUF_CNT;
+    Rtos::ExitCriticalSection();
+  }
+  else
+  {
+    // Only one transfer can be in progress, so next buffer is always free
+    idx = (scr_line_idx + 1u) % DISPLAY_BUF_CNT;
+  }
+#endif
+#if defined(DISPLAY_STATS)
+  // Update wait time
+  stat_wait_time += DisplayStats::GetTimestamp() - wait_start;
+#endif
+
+  // Return buffer index
+  return idx;
+}
+
+// *****************************************************************************
+// ***   Private: Send buffer to display   *************************************
+// *****************************************************************************
+void DisplayDrv::SubmitBuffer(uint8_t idx, uint32_t n)
+{
+#if defined(DISPLAY_STATS)
+  // Time when wait started
+  uint32_t wait_start = DisplayStats::GetTimestamp();
+#endif
+#if defined(DISPLAY_TRANSFER_TASK)
+  // Send buffer to transfer task, it will be returned to the pool after
+  // transfer complete
+  transfer.WriteDataStream(idx, (uint8_t*)scr_buf[idx], n);
+#else
+  // If transfers queued and started from callback
+  if(is_transfer_callback)
+  {
+    Rtos::EnterCriticalSection();
+    // Save number of bytes to transfer
+    scr_buf_bytes[idx] = n;
+    // If queue is empty - transfer have to be started here, otherwise it will
+    // be started from callback after previous transfer complete
+    bool is_idle = (tx_cnt == 0u);
+    // Add buffer to queue
+    tx_cnt++;
+    // New transfer will be started
+    if(is_idle) tx_seq++;
+    Rtos::ExitCriticalSection();
+    // Start transfer if needed
+    if(is_idle)
+    {
+      display->WriteDataStream((uint8_t*)scr_buf[idx], n);
+    }
+  }
+  else
+  {
+    // Wait until previous transfer complete
+    while(display->IsTransferComplete() == false) RtosTick::Yield();
+    // Write stream to LCD
+    display->WriteDataStream((uint8_t*)scr_buf[idx], n);
+  }
+#endif
+#if defined(DISPLAY_STATS)
+  // Update wait time
+  stat_wait_time += DisplayStats::GetTimestamp() - wait_start;
+#endif
+}
+
+// *****************************************************************************
+// ***   Private: Return buffer that wasn't sent   *****************************
+// *****************************************************************************
+void DisplayDrv::ReleaseBuffer(uint8_t idx)
+{
+#if defined(DISPLAY_TRANSFER_TASK)
+  // Return buffer to the pool
+  transfer.ReleaseBuffer(idx);
+#endif
+  // Buffers in ring don't need to be released
+}
+
+// *****************************************************************************
+// ***   Private: Prepare and send current buffer to display   *****************
+// *****************************************************************************
+void DisplayDrv::SendBuffer(uint32_t line_pixels, uint32_t lines_cnt, bool is_data_need_preparation)
+{
+  // Find number of pixels in buffer
+  uint32_t pixels_cnt = line_pixels * lines_cnt;
+  // Check display bits per color
+  if(is_data_need_preparation)
+  {
+    display->PrepareData(scr_buf[scr_line_idx], pixels_cnt);
+  }
+  // Find number of bytes in buffer
+  uint32_t bytes_cnt = display->GetPixelDataCnt(pixels_cnt);
+  // Send buffer to display
+  SubmitBuffer(scr_line_idx, bytes_cnt);
+  // Update transfer counters
+  frame_transfers++;
+  frame_bytes += bytes_cnt;
+  frame_pixels += pixels_cnt;
+  frame_lines += lines_cnt;
+#if defined(DISPLAY_TRANSFER_TASK)
+  // Update max number of buffers in flight
+  uint32_t in_flight = transfer.GetBuffersInFlight();
+  if(in_flight > frame_max_in_flight) frame_max_in_flight = in_flight;
+#endif
+}
+
+// *****************************************************************************
+// ***   Private: Send background lines to display   ***************************
+// *****************************************************************************
+void DisplayDrv::SendBackground(uint32_t line_pixels, uint32_t lines_cnt)
+{
+  // Find number of pixels to send
+  uint32_t pixels_cnt = line_pixels * lines_cnt;
+#if defined(DISPLAY_TRANSFER_TASK)
+  // Color will be sent after all buffers sent before
+  transfer.WriteColor(bkg_color, pixels_cnt);
+#else
+  // Color is sent by blocking writes, so all buffers sent before have to be
+  // transferred first
+  WaitTransferComplete();
+  // Send background color for all pixels
+  display->WriteColor(bkg_color, pixels_cnt);
+#endif
+  // Update transfer counters
+  uint32_t bytes_cnt = display->GetPixelDataCnt(pixels_cnt);
+  frame_transfers++;
+  frame_bytes += bytes_cnt;
+  frame_pixels += pixels_cnt;
+  frame_lines += lines_cnt;
+}
+
+#if defined(DISPLAY_LINE_HASH)
+// *****************************************************************************
+// ***   Public: Reset line hashes   *******************************************
+// *****************************************************************************
+void DisplayDrv::ResetLineHash(void)
+{
+  // Span with start greater than end never matches
+  for(uint32_t i = 0u; i < NumberOf(line_hash); i++)
+  {
+    line_hash[i].hash = 0u;
+    line_hash[i].start_x = 1u;
+    line_hash[i].end_x = 0u;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Check if line differs from one sent before   *****************
+// *****************************************************************************
+bool DisplayDrv::IsLineChanged(int32_t line, uint16_t start_x, uint16_t end_x, uint32_t hash)
+{
+  // Line changed by default
+  bool result = true;
+  // Lines outside of cache always sent
+  if(line < (int32_t)NumberOf(line_hash))
+  {
+    // Line is the same if it has the same span and hash
+    if((line_hash[line].hash == hash) && (line_hash[line].start_x == start_x) && (line_hash[line].end_x == end_x))
+    {
+      result = false;
+    }
+    else
+    {
+      // Save new line hash
+      line_hash[line].hash = hash;
+      line_hash[line].start_x = start_x;
+      line_hash[line].end_x = end_x;
+    }
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: Get hash of line in buffer   *********************************
+// *****************************************************************************
+uint32_t DisplayDrv::GetLineHash(const color_t* buf, uint32_t n)
+{
+  // Find FNV-1a hash of line
+  uint32_t hash = 2166136261u;
+  for(uint32_t i = 0u; i < n; i++)
+  {
+    hash ^= buf[i];
+    hash *= 16777619u;
+  }
+  // Return result
+  return hash;
+}
+
+// *****************************************************************************
+// ***   Private: Get hash of line filled by one color   ***********************
+// *****************************************************************************
+uint32_t DisplayDrv::GetLineHash(color_t color, uint32_t n)
+{
+  // The same FNV-1a hash as for buffer filled by color
+  uint32_t hash = 2166136261u;
+  for(uint32_t i = 0u; i < n; i++)
+  {
+    hash ^= color;
+    hash *= 16777619u;
+  }
+  // Return result
+  return hash;
+}
+#endif
+
+// *****************************************************************************
+// ***   Private: Lock line mutex for drawing   ********************************
+// *****************************************************************************
+void DisplayDrv::LockLine(void)
+{
+#if defined(DISPLAY_STATS)
+  // Time when wait started
+  uint32_t lock_start = DisplayStats::GetTimestamp();
+#endif
+  // Take line semaphore
+  line_mutex.Lock();
+#if defined(DISPLAY_STATS)
+  // Update lock wait time
+  stat_lock_time += DisplayStats::GetTimestamp() - lock_start;
+#endif
+}
+
+#if defined(DISPLAY_STATS)
+// *****************************************************************************
+// ***   Public: Get copy of display statistics   ******************************
+// *****************************************************************************
+Result DisplayDrv::GetStats(DisplayStats& out_stats)
+{
+  // Lock display to get consistent statistics
+  Result result = LockDisplay();
+  // Copy statistics
+  if(result.IsGood())
+  {
+    out_stats = stats;
+    UnlockDisplay();
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Clear display statistics   ************************************
+// *****************************************************************************
+void DisplayDrv::ClearStats(void)
+{
+  // Lock display
+  LockDisplay();
+  // Clear statistics
+  stats.Clear();
   // Unlock display
-  UnlockDisplay();  
-  // Set update adea to full screen
-  InvalidateArea(0, 0, width, height);
+  UnlockDisplay();
+}
+
+// *****************************************************************************
+// ***   Private: Add frame values to statistics   *****************************
+// *****************************************************************************
+void DisplayDrv::UpdateStats(uint32_t frame_start)
+{
+  // Frame time without waiting for transfers and line mutex
+  uint32_t frame_time = DisplayStats::GetTimestamp() - frame_start;
+  stats.render_time.Add(frame_time - stat_wait_time - stat_lock_time);
+  stats.wait_time.Add(stat_wait_time);
+  stats.lock_time.Add(stat_lock_time);
+  // Transfer counters
+  stats.lines.Add(frame_lines);
+  stats.pixels.Add(frame_pixels);
+  stats.windows.Add(frame_windows);
+  // Get number of merged areas
+  line_mutex.Lock();
+#if defined(MULTIPLE_UPDATE_AREAS)
+  area_merges += areas.GetMergesCnt();
+#endif
+  stats.merges.Add(area_merges);
+  area_merges = 0u;
+  line_mutex.Release();
+}
+#endif
+
+// *****************************************************************************
+// ***   Private: Set address window   *****************************************
+// *****************************************************************************
+void DisplayDrv::SetAddrWindow(int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y)
+{
+  // Lines of scroll area are shifted in display memory
+  if(scroll_along_x)
+  {
+    start_x = ScrollLine(start_x);
+    end_x = ScrollLine(end_x);
+  }
+  else
+  {
+    start_y = ScrollLine(start_y);
+    end_y = ScrollLine(end_y);
+  }
+#if defined(DISPLAY_TRANSFER_TASK)
+  // Window will be set after all buffers sent before
+  transfer.SetAddrWindow(start_x, start_y, end_x, end_y);
+#else
+  // Set address window
+  display->SetAddrWindow(start_x, start_y, end_x, end_y);
+#endif
+  // Update window counter
+  frame_windows++;
+}
+
+// *****************************************************************************
+// ***   Private: Stop transfer after all buffers are sent   *******************
+// *****************************************************************************
+void DisplayDrv::StopTransfer(void)
+{
+#if defined(DISPLAY_TRANSFER_TASK)
+  // Transfer will be stopped after all buffers sent before
+  transfer.StopTransfer();
+#else
+  // Wait until all transfers complete
+  WaitTransferComplete();
+  // Pull up CS
+  display->StopTransfer();
+#endif
+}
+
+#if defined(DISPLAY_TARGET_FPS)
+// *****************************************************************************
+// ***   Private: Wait until next frame can be started   ***********************
+// *****************************************************************************
+void DisplayDrv::WaitFrameSlot(void)
+{
+  // Time left until next frame slot
+  int32_t wait_ms = (int32_t)(next_frame_ms - RtosTick::GetTimeMs());
+  // Wait if previous frame started less than frame period ago
+  if(wait_ms > 0)
+  {
+    RtosTick::DelayMs(wait_ms);
+  }
+}
+#endif
+
+// *****************************************************************************
+// ***   Private: Wait for start of vertical blanking   ************************
+// *****************************************************************************
+void DisplayDrv::WaitTearingEffect(void)
+{
+  // Time when wait started
+  uint32_t start_ms = RtosTick::GetTimeMs();
+  // If blanking is in progress, wait for the next one - there may be not
+  // enough time left to stay ahead of the scan line
+  while((te->Read() == IGpio::HIGH) && !RtosTick::CheckTimeDifferenceMs(start_ms, TE_TIMEOUT_MS))
+  {
+    RtosTick::DelayMs(TE_POLL_MS);
+  }
+  // Wait for start of blanking. Frame is drawn without sync if TE signal
+  // doesn't come within timeout.
+  while((te->Read() == IGpio::LOW) && !RtosTick::CheckTimeDifferenceMs(start_ms, TE_TIMEOUT_MS))
+  {
+    RtosTick::DelayMs(TE_POLL_MS);
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Wait for transfer complete notification   ********************
+// *****************************************************************************
+void DisplayDrv::WaitTransferNotification(void)
+{
+  // Wait for notification from callback
+  if(transfer_complete.Take(RtosTick::MsToTicks(TRANSFER_TIMEOUT_MS)) != Result::RESULT_OK)
+  {
+    // No notification - transfer can be finished, but callback missed(for
+    // example transfer wasn't started because of error)
+    bool is_claimed = false;
+    // Only check and claim completed buffer in critical section. Sequence
+    // number marks completion as consumed, so callback that is pending right
+    // now ignores it when critical section ends.
+    Rtos::EnterCriticalSection();
+    if((tx_cnt > 0u) && (tx_done_seq != tx_seq) && display->IsTransferComplete())
+    {
+      // Remove completed buffer from queue
+      tx_idx = (tx_idx + 1u) % DISPLAY_BUF_CNT;
+      tx_cnt--;
+      tx_done_seq = tx_seq;
+      is_claimed = true;
+    }
+    Rtos::ExitCriticalSection();
+    // Start transfer of next buffer in queue after pending callback for the
+    // claimed transfer is processed. Sequence number updated together with
+    // the start, so callback can't see new number before transfer started. No
+    // need to notify: display task is the one who waits.
+    if(is_claimed && (tx_cnt > 0u))
+    {
+      Rtos::EnterCriticalSection();
+      tx_seq++;
+      display->WriteDataStream((uint8_t*)scr_buf[tx_idx], scr_buf_bytes[tx_idx]);
+      Rtos::ExitCriticalSection();
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Wait until all transfers complete   **************************
+// *****************************************************************************
+void DisplayDrv::WaitTransferComplete(void)
+{
+#if defined(DISPLAY_STATS)
+  // Time when wait started
+  uint32_t wait_start = DisplayStats::GetTimestamp();
+#endif
+#if defined(DISPLAY_TRANSFER_TASK)
+  // Wait until transfer task processes all commands sent before
+  transfer.Sync();
+#else
+  // If transfers queued and started from callback
+  if(is_transfer_callback)
+  {
+    // Wait until transfer queue is empty
+    while(tx_cnt > 0u) WaitTransferNotification();
+  }
+  // Wait until last transfer complete
+  while(display->IsTransferComplete() == false) RtosTick::Yield();
+#endif
+#if defined(DISPLAY_STATS)
+  // Update wait time
+  stat_wait_time += DisplayStats::GetTimestamp() - wait_start;
+#endif
 }
 
 // *****************************************************************************
@@ -514,6 +1529,24 @@ Result DisplayDrv::SetTouchDrv(ITouchscreen* in_touch)
   return result;
 }
 
+// *****************************************************************************
+// ***   Public: Set tearing effect pin(or clear if nullptr passed)   **********
+// *****************************************************************************
+Result DisplayDrv::SetTePin(IGpio* in_te)
+{
+  Result result = Result::ERR_INVALID_ITEM;
+  // Tearing effect pin should be set before scheduler started
+  if(Rtos::IsSchedulerNotRunning())
+  {
+    // Store new tearing effect pin pointer
+    te = in_te;
+    // Set good result
+    result = Result::RESULT_OK;
+  }
+  // Return result
+  return result;
+}
+
 // *****************************************************************************
 // ***   Public: Get Touch X and Y coordinate   ********************************
 // *****************************************************************************
@@ -65,8 +65,12 @@
 #include "Framework/AppTask.h"
 
 #include "Display/UpdateAreaProcessor.h"
+#include "Display/DisplayTransfer.h"
+#include "Display/DisplayStats.h"
 
+#include "Interfaces/ICallback.h"
 #include "Interfaces/IDisplay.h"
+#include "Interfaces/IGpio.h"
 #include "Interfaces/ITouchscreen.h"
 #include "Display/VisObject.h"
 #include "Display/VisList.h"
@@ -80,7 +84,7 @@
 // *****************************************************************************
 // ***   Display Driver Class   ************************************************
 // *****************************************************************************
-class DisplayDrv : public AppTask
+class DisplayDrv : public AppTask, public ICallback
 {
   public:
     // *************************************************************************
@@ -89,7 +93,8 @@ class DisplayDrv : public AppTask
     enum UpdateMode
     {
       UPDATE_TOP_BOTTOM,
-      UPDATE_LEFT_RIGHT
+      UPDATE_LEFT_RIGHT,
+      UPDATE_AUTO
     };
 
     // *************************************************************************
@@ -97,6 +102,16 @@ class DisplayDrv : public AppTask
     // *************************************************************************
     static DisplayDrv& GetInstance(void);
 
+    // *************************************************************************
+    // ***   Public: Constructor   *********************************************
+    // *************************************************************************
+    // * Display driver for additional display. Each instance has its own task,
+    // * buffers, update areas and list. Default list isn't changed, so
+    // * SetList(*drv.GetVisList()) should be called for every VisObject shown
+    // * on this display.
+    explicit DisplayDrv(const char* task_name) :
+      AppTask(DISPLAY_DRV_TASK_STACK_SIZE, DISPLAY_DRV_TASK_PRIORITY, task_name) {};
+
     // *************************************************************************
     // ***   Public: InitTask from AppTask to prevent warning   ****************
     // *************************************************************************
@@ -122,6 +137,11 @@ class DisplayDrv : public AppTask
     // *************************************************************************
     virtual Result Loop();
 
+    // *************************************************************************
+    // ***   Public: Transfer complete callback(called from interrupt)   *******
+    // *************************************************************************
+    virtual void Callback(void* ptr);
+
     // *************************************************************************
     // ***   Public: Set display driver   **************************************
     // *************************************************************************
@@ -185,8 +205,43 @@ class DisplayDrv : public AppTask
     // *************************************************************************
     // ***   Public: Set Update Mode   *****************************************
     // *************************************************************************
+    // * UPDATE_TOP_BOTTOM draws areas line by line, UPDATE_LEFT_RIGHT - row by
+    // * row. UPDATE_AUTO chooses order for each area: rows are used if area
+    // * is higher than wide, so area is sent by fewer, longer lines.
     void SetUpdateMode(UpdateMode mode);
 
+    // *************************************************************************
+    // ***   Public: Set Scroll Area   *****************************************
+    // *************************************************************************
+    // * Lines from start to end(inclusive) are scrolled by display controller
+    // * when Scroll() called. Lines are columns if display scrolls along X in
+    // * current rotation(see IsScrollAlongX()), rows otherwise. Pass start
+    // * greater than end to disable scroll. Works only in UPDATE_TOP_BOTTOM
+    // * mode and is cleared by rotation or update mode change.
+    Result SetScrollArea(int16_t start, int16_t end);
+
+    // *************************************************************************
+    // ***   Public: Scroll object   ********************************************
+    // *************************************************************************
+    // * Moves object by delta pixels along scroll axis. Content already shown
+    // * in scroll area is shifted by display, only newly exposed lines are
+    // * redrawn. Scroll area lines should contain only this object and
+    // * background. Without scroll area or if display isn't updated in
+    // * UPDATE_TOP_BOTTOM order object is just moved and error is returned.
+    Result Scroll(VisObject& obj, int16_t delta);
+
+    // *************************************************************************
+    // ***   Public: Check if display scrolls along X   ************************
+    // *************************************************************************
+    inline bool IsScrollAlongX(void) {return scroll_along_x;}
+
+    // *************************************************************************
+    // ***   Public: Check if area is visible   ********************************
+    // *************************************************************************
+    // * Returns false if area is outside of visibility mask of display(i.e.
+    // * corners of round panel).
+    bool IsAreaVisible(int32_t start_x, int32_t start_y, int32_t end_x, int32_t end_y);
+
     // *************************************************************************
     // ***   Public: Set Background Color   ************************************
     // *************************************************************************
@@ -202,6 +257,96 @@ class DisplayDrv : public AppTask
     // *************************************************************************
     inline int32_t GetScreenH(void) {return height;}
 
+    // *************************************************************************
+    // ***   Public: Get number of transfers to display during last frame   ****
+    // *************************************************************************
+    inline uint32_t GetFrameTransfers(void) {return frame_transfers;}
+
+    // *************************************************************************
+    // ***   Public: Get number of bytes sent to display during last frame   ***
+    // *************************************************************************
+    inline uint32_t GetFrameBytes(void) {return frame_bytes;}
+
+    // *************************************************************************
+    // ***   Public: Get number of pixels sent to display during last frame   **
+    // *************************************************************************
+    inline uint32_t GetFramePixels(void) {return frame_pixels;}
+
+    // *************************************************************************
+    // ***   Public: Get number of lines sent to display during last frame   ***
+    // *************************************************************************
+    inline uint32_t GetFrameLines(void) {return frame_lines;}
+
+    // *************************************************************************
+    // ***   Public: Get number of windows set during last frame   *************
+    // *************************************************************************
+    inline uint32_t GetFrameWindows(void) {return frame_windows;}
+
+    // *************************************************************************
+    // ***   Public: Get time from start to end of last frame   ****************
+    // *************************************************************************
+    inline uint32_t GetFrameTimeMs(void) {return frame_time_ms;}
+
+    // *************************************************************************
+    // ***   Public: Get achieved frame rate multiplied by 10   ****************
+    // *************************************************************************
+    inline uint32_t GetFrameRateX10(void) {return frame_rate_x10;}
+
+#if defined(DISPLAY_STATS)
+    // *************************************************************************
+    // ***   Public: Get copy of display statistics   **************************
+    // *************************************************************************
+    Result GetStats(DisplayStats& out_stats);
+
+    // *************************************************************************
+    // ***   Public: Clear display statistics   ********************************
+    // *************************************************************************
+    void ClearStats(void);
+#endif
+
+#if defined(DISPLAY_TARGET_FPS)
+    // *************************************************************************
+    // ***   Public: Get number of frames that took longer than frame period   *
+    // *************************************************************************
+    inline uint32_t GetMissedFrames(void) {return missed_frames;}
+#endif
+
+#if defined(DISPLAY_TRANSFER_TASK)
+    // *************************************************************************
+    // ***   Public: Get time spent for rendering during last frame   **********
+    // *************************************************************************
+    inline uint32_t GetFrameRenderTimeMs(void) {return frame_render_ms;}
+
+    // *************************************************************************
+    // ***   Public: Get time spent waiting for buffers during last frame   *****
+    // *************************************************************************
+    inline uint32_t GetFrameWaitTimeMs(void) {return frame_wait_ms;}
+
+    // *************************************************************************
+    // ***   Public: Get time spent for transfers during last frame   **********
+    // *************************************************************************
+    inline uint32_t GetFrameTransferTimeMs(void) {return frame_transfer_ms;}
+
+    // *************************************************************************
+    // ***   Public: Get max number of buffers in flight during last frame   ***
+    // *************************************************************************
+    inline uint32_t GetFrameMaxBuffersInFlight(void) {return frame_max_in_flight;}
+
+    // *************************************************************************
+    // ***   Public: Get number of buffers in flight   *************************
+    // *************************************************************************
+    inline uint32_t GetBuffersInFlight(void) {return transfer.GetBuffersInFlight();}
+#endif
+
+#if defined(DISPLAY_LINE_HASH)
+    // *************************************************************************
+    // ***   Public: Reset line hashes   ***************************************
+    // *************************************************************************
+    // * After reset all lines will be sent to display. Should be called if
+    // * display content changed bypassing display driver.
+    void ResetLineHash(void);
+#endif
+
     // *************************************************************************
     // ***   Public: Set touchscreen driver(or clear if nullptr passed)   ******
     // *************************************************************************
@@ -212,6 +357,13 @@ class DisplayDrv : public AppTask
     // *************************************************************************
     ITouchscreen* GetTouchDrv(void) {return touch;}
 
+    // *************************************************************************
+    // ***   Public: Set tearing effect pin(or clear if nullptr passed)   ******
+    // *************************************************************************
+    // * If pin is set, each frame starts at the rising edge of display TE
+    // * output(start of vertical blanking).
+    Result SetTePin(IGpio* in_te);
+
     // *************************************************************************
     // ***   Public: Get Touch X and Y coordinate   ****************************
     // *************************************************************************
@@ -234,6 +386,14 @@ class DisplayDrv : public AppTask
     // Touchscreen driver object
     ITouchscreen* touch = nullptr;
 
+    // Tearing effect pin
+    IGpio* te = nullptr;
+    // Timeout for tearing effect signal
+    static const uint32_t TE_TIMEOUT_MS = 40u;
+    // Tearing effect signal poll period. Delay instead of yield lets lower
+    // priority tasks run while display task waits for TE.
+    static const uint32_t TE_POLL_MS = 1u;
+
     // List with visual objects
     VisList list = VisList(*this);
 
@@ -246,13 +406,109 @@ class DisplayDrv : public AppTask
     IDisplay::Rotation rotation = IDisplay::ROTATION_TOP;
     // Update mode: true - vertical, false = horizontal
     UpdateMode update_mode = UPDATE_TOP_BOTTOM;
+    // Current scan order: areas drawn by rows(display rotated by 90 degrees)
+    bool is_column_order = false;
     // Variables for update screen mode
     int32_t width = 0;
     int32_t height = 0;
-    // Double Screen Line buffer
-    color_t scr_buf[2][DISPLAY_MAX_BUF_LEN];
-    // Current screen line
+    // Ring of Screen Band buffers(DISPLAY_BAND_LINES lines each)
+    color_t scr_buf[DISPLAY_BUF_CNT][DISPLAY_MAX_BUF_LEN * DISPLAY_BAND_LINES];
+    // Number of bytes to transfer for each buffer
+    uint32_t scr_buf_bytes[DISPLAY_BUF_CNT] = {0u};
+    // Max bytes in one transfer: DMA transfer size is 16-bit number
+    static const int32_t MAX_TRANSFER_BYTES = 65535;
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+    // Objects present in current update area
+    VisListArea_t area_objects;
+#endif
+    // Current screen band buffer
     uint8_t scr_line_idx = 0u;
+    // Index of first buffer in transfer queue(buffer in transfer)
+    volatile uint8_t tx_idx = 0u;
+    // Number of buffers in transfer queue
+    volatile uint8_t tx_cnt = 0u;
+    // Sequence number of last started transfer
+    volatile uint8_t tx_seq = 0u;
+    // Sequence number of last transfer removed from queue. If it is equal to
+    // tx_seq, completion of started transfer is already consumed.
+    volatile uint8_t tx_done_seq = 0u;
+    // Display driver reports transfer completion via callback
+    bool is_transfer_callback = false;
+    // Timeout for transfer complete notification
+    static const uint32_t TRANSFER_TIMEOUT_MS = 10u;
+
+    // Number of transfers to display during last frame
+    uint32_t frame_transfers = 0u;
+    // Number of bytes sent to display during last frame
+    uint32_t frame_bytes = 0u;
+    // Number of pixels sent to display during last frame
+    uint32_t frame_pixels = 0u;
+    // Number of lines sent to display during last frame
+    uint32_t frame_lines = 0u;
+    // Number of windows set during last frame
+    uint32_t frame_windows = 0u;
+    // Time from start to end of last frame
+    uint32_t frame_time_ms = 0u;
+    // Achieved frame rate multiplied by 10
+    uint32_t frame_rate_x10 = 0u;
+    // Start time of last frame
+    uint32_t last_frame_start_ms = 0u;
+
+#if defined(DISPLAY_STATS)
+    // Display statistics
+    DisplayStats stats;
+    // Time spent waiting for transfers during current frame
+    uint32_t stat_wait_time = 0u;
+    // Time spent waiting for line mutex during current frame
+    uint32_t stat_lock_time = 0u;
+    // Number of merged update areas since last frame
+    uint32_t area_merges = 0u;
+#endif
+
+#if defined(DISPLAY_TARGET_FPS)
+    // Frame period
+    static const uint32_t FRAME_PERIOD_MS = 1000u / DISPLAY_TARGET_FPS;
+    // Time when next frame can be started
+    uint32_t next_frame_ms = 0u;
+    // Number of frames that took longer than frame period
+    uint32_t missed_frames = 0u;
+#endif
+
+#if defined(DISPLAY_TRANSFER_TASK)
+    // Transfer task
+    DisplayTransfer transfer;
+    // Time spent waiting for free buffer during current frame
+    uint32_t frame_wait_ms = 0u;
+    // Time spent for rendering during last frame
+    uint32_t frame_render_ms = 0u;
+    // Time spent for transfers during last frame
+    uint32_t frame_transfer_ms = 0u;
+    // Max number of buffers in flight during last frame
+    uint32_t frame_max_in_flight = 0u;
+#endif
+
+    // Visible span of each display line(nullptr - whole display visible)
+    const IDisplay::Span* mask = nullptr;
+
+    // Hardware scroll area(start greater than end - no scroll area)
+    int16_t scroll_start = 0;
+    int16_t scroll_end = -1;
+    // Offset of scroll area content in display memory
+    int16_t scroll_offset = 0;
+    // Scroll offset have to be sent to display at the start of next frame
+    bool is_scroll_changed = false;
+    // Display scrolls along X in current rotation
+    bool scroll_along_x = false;
+
+#if defined(DISPLAY_LINE_HASH)
+    // Hash of each line sent to display and its span
+    struct
+    {
+      uint32_t hash;
+      uint16_t start_x;
+      uint16_t end_x;
+    } line_hash[DISPLAY_MAX_BUF_LEN];
+#endif
 
 #if defined(UPDATE_AREA_ENABLED)
     // Area to update
@@ -260,6 +516,9 @@ class DisplayDrv : public AppTask
   #if defined(MULTIPLE_UPDATE_AREAS)
     // For multiple areas
     UpdateAreaProcessor<MULTIPLE_UPDATE_AREAS> areas;
+  #elif defined(UPDATE_AREA_TILES)
+    // For dirty tiles
+    UpdateAreaTiles<UPDATE_AREA_TILES> areas;
   #else
     // Dirty flag
     bool is_dirty = false;
@@ -285,8 +544,15 @@ class DisplayDrv : public AppTask
     Circle touch_cir;
 #endif
 
+#if defined(DISPLAY_DEBUG_AREA)
+    // Index of color for update area
+    uint32_t debug_color_idx = 0u;
+#endif
+
     // Semaphore for update screen
     RtosSemaphore screen_update;
+    // Semaphore for transfer complete notification
+    RtosSemaphore transfer_complete;
     // Mutex to synchronize when drawing lines
     RtosRecursiveMutex line_mutex;
     // Mutex to synchronize when drawing frames
@@ -304,10 +570,140 @@ class DisplayDrv : public AppTask
       b = tmp;
     }
 
+    // *************************************************************************
+    // ***   Private: Get line of display memory for line of screen   **********
+    // *************************************************************************
+    inline int16_t ScrollLine(int16_t line)
+    {
+      if((line >= scroll_start) && (line <= scroll_end))
+      {
+        line = scroll_start + (line - scroll_start + scroll_offset) % (scroll_end - scroll_start + 1);
+      }
+      return line;
+    }
+
+    // *************************************************************************
+    // ***   Private: Clear scroll area   **************************************
+    // *************************************************************************
+    void ClearScroll(void);
+
+    // *************************************************************************
+    // ***   Private: Set scan order   *****************************************
+    // *************************************************************************
+    // * Rows are drawn as lines of display rotated counterclockwise: display
+    // * X is Y and display Y is width - 1 - X.
+    void SetScanOrder(bool is_column);
+
+    // *************************************************************************
+    // ***   Private: Draw area   **********************************************
+    // *************************************************************************
+    // * Only visible part of area is drawn if display provides visibility mask.
+    void DrawArea(uint16_t start_x, uint16_t start_y, uint16_t end_x, uint16_t end_y);
+
+    // *************************************************************************
+    // ***   Private: Draw area with hardware scroll   *************************
+    // *************************************************************************
+    // * Area is split to parts placed continuously in display memory.
+    void DrawScrollArea(uint16_t start_x, uint16_t start_y, uint16_t end_x, uint16_t end_y);
+
+    // *************************************************************************
+    // ***   Private: Draw part of area   **************************************
+    // *************************************************************************
+    void DrawAreaPart(uint16_t start_x, uint16_t start_y, uint16_t end_x, uint16_t end_y);
+
+    // *************************************************************************
+    // ***   Private: Get free buffer from ring   ******************************
+    // *************************************************************************
+    uint8_t GetFreeBuffer(void);
+
+    // *************************************************************************
+    // ***   Private: Send buffer to display   *********************************
+    // *************************************************************************
+    void SubmitBuffer(uint8_t idx, uint32_t n);
+
+    // *************************************************************************
+    // ***   Private: Return buffer that wasn't sent   *************************
+    // *************************************************************************
+    void ReleaseBuffer(uint8_t idx);
+
+    // *************************************************************************
+    // ***   Private: Prepare and send current buffer to display   *************
+    // *************************************************************************
+    void SendBuffer(uint32_t line_pixels, uint32_t lines_cnt, bool is_data_need_preparation);
+
+    // *************************************************************************
+    // ***   Private: Send background lines to display   ***********************
+    // *************************************************************************
+    // * Lines without objects are sent by repeating background color, without
+    // * drawing them in buffer.
+    void SendBackground(uint32_t line_pixels, uint32_t lines_cnt);
+
+    // *************************************************************************
+    // ***   Private: Lock line mutex for drawing   ****************************
+    // *************************************************************************
+    void LockLine(void);
+
+#if defined(DISPLAY_STATS)
+    // *************************************************************************
+    // ***   Private: Add frame values to statistics   *************************
+    // *************************************************************************
+    void UpdateStats(uint32_t frame_start);
+#endif
+
+#if defined(DISPLAY_LINE_HASH)
+    // *************************************************************************
+    // ***   Private: Check if line differs from one sent before   *************
+    // *************************************************************************
+    // * Returns true and saves hash if line or its span is different.
+    bool IsLineChanged(int32_t line, uint16_t start_x, uint16_t end_x, uint32_t hash);
+
+    // *************************************************************************
+    // ***   Private: Get hash of line in buffer   *****************************
+    // *************************************************************************
+    static uint32_t GetLineHash(const color_t* buf, uint32_t n);
+
+    // *************************************************************************
+    // ***   Private: Get hash of line filled by one color   *******************
+    // *************************************************************************
+    static uint32_t GetLineHash(color_t color, uint32_t n);
+#endif
+
+    // *************************************************************************
+    // ***   Private: Set address window   *************************************
+    // *************************************************************************
+    void SetAddrWindow(int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y);
+
+    // *************************************************************************
+    // ***   Private: Stop transfer after all buffers are sent   ***************
+    // *************************************************************************
+    void StopTransfer(void);
+
+#if defined(DISPLAY_TARGET_FPS)
+    // *************************************************************************
+    // ***   Private: Wait until next frame can be started   *******************
+    // *************************************************************************
+    void WaitFrameSlot(void);
+#endif
+
+    // *************************************************************************
+    // ***   Private: Wait for start of vertical blanking   ********************
+    // *************************************************************************
+    void WaitTearingEffect(void);
+
+    // *************************************************************************
+    // ***   Private: Wait for transfer complete notification   ****************
+    // *************************************************************************
+    void WaitTransferNotification(void);
+
+    // *************************************************************************
+    // ***   Private: Wait until all transfers complete   **********************
+    // *************************************************************************
+    void WaitTransferComplete(void);
+
     // *************************************************************************
     // ** Private constructor: Only GetInstance() allow to access this class ***
     // *************************************************************************
-    DisplayDrv() : AppTask(DISPLAY_DRV_TASK_STACK_SIZE, DISPLAY_DRV_TASK_PRIORITY, "DisplayDrv")
+    DisplayDrv() : DisplayDrv("DisplayDrv")
     {
       // Set default list for all VisObjects. Every object should have list. If
       // default list isn't set, SetList() should be explicitly called for every
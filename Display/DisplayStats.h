@@ -0,0 +1,176 @@
+// *****************************************************************************
+// @file DisplayStats.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Display Statistics Class, header
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef DisplayStats_h
+#define DisplayStats_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+
+#if defined(DISPLAY_STATS)
+
+// *****************************************************************************
+// ***   Timestamp source   ****************************************************
+// *****************************************************************************
+// * Can be overridden in DevCfgUsr.h. All times in statistics are differences
+// * of this value.
+#if !defined(DISPLAY_STATS_TIMESTAMP)
+  #if defined(HAL_RCC_MODULE_ENABLED) && defined(DWT)
+    #include "Drivers/DwtCycleCounter.h"
+    // CPU cycles. DwtCycleCounter::Init() have to be called before use.
+    #define DISPLAY_STATS_TIMESTAMP() DwtCycleCounter::GetClockCounter()
+  #else
+    // RTOS ticks(RtosTick included by DevCfg.h). Too coarse to measure one frame on fast displays, so better
+    // source should be provided via DISPLAY_STATS_TIMESTAMP() if it exists.
+    #define DISPLAY_STATS_TIMESTAMP() RtosTick::GetTickCount()
+  #endif
+#endif
+
+// *****************************************************************************
+// ***   Display Statistics Class   ********************************************
+// *****************************************************************************
+class DisplayStats
+{
+  public:
+    // Number of histogram bins: one per bit of 32-bit value plus one for zero
+    static const uint32_t HIST_BINS = 33u;
+
+    // *************************************************************************
+    // ***   Statistics of one value   *****************************************
+    // *************************************************************************
+    // * Histogram has logarithmic bins: bin 0 counts zeros, bin i counts values
+    // * from 2^(i-1) to 2^i - 1.
+    class Value
+    {
+      public:
+        // *********************************************************************
+        // ***   Public: Add value   *******************************************
+        // *********************************************************************
+        void Add(uint32_t val)
+        {
+          if((cnt == 0u) || (val < min)) min = val;
+          if(val > max) max = val;
+          sum += val;
+          last = val;
+          cnt++;
+          // Find bin - number of significant bits in value
+          uint32_t bin = 0u;
+          while(val != 0u)
+          {
+            val >>= 1u;
+            bin++;
+          }
+          hist[bin]++;
+        }
+
+        // *********************************************************************
+        // ***   Public: Clear   ***********************************************
+        // *********************************************************************
+        void Clear(void) {*this = Value();}
+
+        // *********************************************************************
+        // ***   Public: Get values   ******************************************
+        // *********************************************************************
+        inline uint32_t GetMin(void) const {return min;}
+        inline uint32_t GetMax(void) const {return max;}
+        inline uint32_t GetAvg(void) const {return (cnt > 0u) ? (uint32_t)(sum / cnt) : 0u;}
+        inline uint32_t GetLast(void) const {return last;}
+        inline uint32_t GetCnt(void) const {return cnt;}
+        inline uint32_t GetHist(uint32_t bin) const {return (bin < HIST_BINS) ? hist[bin] : 0u;}
+
+      private:
+        // Min value
+        uint32_t min = 0u;
+        // Max value
+        uint32_t max = 0u;
+        // Last value
+        uint32_t last = 0u;
+        // Number of values
+        uint32_t cnt = 0u;
+        // Sum of all values
+        uint64_t sum = 0u;
+        // Histogram
+        uint32_t hist[HIST_BINS] = {0u};
+    };
+
+    // *************************************************************************
+    // ***   Public: Get timestamp   *******************************************
+    // *************************************************************************
+    // * Unit depends on source: CPU cycles from DWT cycle counter, RTOS ticks
+    // * if there is no DWT or unit of user defined DISPLAY_STATS_TIMESTAMP().
+    static inline uint32_t GetTimestamp(void) {return DISPLAY_STATS_TIMESTAMP();}
+
+    // *************************************************************************
+    // ***   Public: Clear all statistics   ************************************
+    // *************************************************************************
+    void Clear(void) {*this = DisplayStats();}
+
+    // Time spent for rendering a frame
+    Value render_time;
+    // Time spent waiting for transfers during a frame
+    Value wait_time;
+    // Time spent waiting for line mutex during a frame
+    Value lock_time;
+    // Lines sent to display during a frame
+    Value lines;
+    // Pixels sent to display during a frame
+    Value pixels;
+    // Address windows set during a frame
+    Value windows;
+    // Update areas merged before a frame
+    Value merges;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,244 @@
+// *****************************************************************************
+// @file DisplayTransfer.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Display Transfer Task Class, implementation
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DisplayTransfer.h"
+
+#if defined(DISPLAY_TRANSFER_TASK)
+
+// *****************************************************************************
+// ***   Public: Init Display Transfer Task   **********************************
+// *****************************************************************************
+Result DisplayTransfer::InitTask(IDisplay& in_display)
+{
+  // Save display driver pointer
+  display = &in_display;
+  // Create pool of free buffers
+  Result result = free_queue.Create();
+  // Put all buffers to the pool
+  for(uint8_t i = 0u; (i < DISPLAY_BUF_CNT) && result.IsGood(); i++)
+  {
+    result = free_queue.SendToBack(&i);
+  }
+  // Create task
+  if(result.IsGood())
+  {
+    result = AppTask::InitTask();
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Get free buffer from pool   ***********************************
+// *****************************************************************************
+uint8_t DisplayTransfer::GetFreeBuffer(void)
+{
+  uint8_t idx = 0u;
+  // Wait until buffer returned to the pool
+  free_queue.Receive(&idx, UINT32_MAX);
+  // Return buffer index
+  return idx;
+}
+
+// *****************************************************************************
+// ***   Public: Return unused buffer to pool   ********************************
+// *****************************************************************************
+void DisplayTransfer::ReleaseBuffer(uint8_t idx)
+{
+  // Return buffer to the pool
+  free_queue.SendToBack(&idx);
+}
+
+// *****************************************************************************
+// ***   Public: Get number of buffers taken from pool   ***********************
+// *****************************************************************************
+uint32_t DisplayTransfer::GetBuffersInFlight(void)
+{
+  uint32_t free_cnt = DISPLAY_BUF_CNT;
+  // Get number of buffers in the pool
+  free_queue.GetMessagesWaiting(free_cnt);
+  // Return number of buffers that aren't in the pool
+  return DISPLAY_BUF_CNT - free_cnt;
+}
+
+// *****************************************************************************
+// ***   Public: Set address window   ******************************************
+// *****************************************************************************
+Result DisplayTransfer::SetAddrWindow(int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y)
+{
+  Message msg;
+  msg.cmd = CMD_SET_WINDOW;
+  msg.start_x = start_x;
+  msg.start_y = start_y;
+  msg.end_x = end_x;
+  msg.end_y = end_y;
+  return SendMessage(msg);
+}
+
+// *****************************************************************************
+// ***   Public: Send buffer to display   **************************************
+// *****************************************************************************
+Result DisplayTransfer::WriteDataStream(uint8_t idx, uint8_t* buf, uint32_t n)
+{
+  Message msg;
+  msg.cmd = CMD_WRITE_DATA;
+  msg.idx = idx;
+  msg.buf = buf;
+  msg.n = n;
+  return SendMessage(msg);
+}
+
+// *****************************************************************************
+// ***   Public: Send one color for n pixels to display   **********************
+// *****************************************************************************
+Result DisplayTransfer::WriteColor(color_t color, uint32_t n)
+{
+  Message msg;
+  msg.cmd = CMD_WRITE_COLOR;
+  msg.color = color;
+  msg.n = n;
+  return SendMessage(msg);
+}
+
+// *****************************************************************************
+// ***   Public: Stop transfer(pull up CS)   ***********************************
+// *****************************************************************************
+Result DisplayTransfer::StopTransfer(void)
+{
+  Message msg;
+  msg.cmd = CMD_STOP_TRANSFER;
+  return SendMessage(msg);
+}
+
+// *****************************************************************************
+// ***   Public: Wait until all commands sent before are processed   ***********
+// *****************************************************************************
+Result DisplayTransfer::Sync(void)
+{
+  Message msg;
+  msg.cmd = CMD_SYNC;
+  Result result = SendMessage(msg);
+  // Wait until task process sync command
+  if(result.IsGood())
+  {
+    result = sync.Take();
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Transfer complete callback   **********************************
+// *****************************************************************************
+void DisplayTransfer::Callback(void* ptr)
+{
+  // Notify transfer task
+  transfer_complete.Give();
+}
+
+// *****************************************************************************
+// ***   Private: Setup function   *********************************************
+// *****************************************************************************
+Result DisplayTransfer::Setup()
+{
+#if defined(DISPLAY_TRANSFER_CALLBACK)
+  // Use transfer complete notification if display driver supports it
+  is_transfer_callback = display->SetTransferCompleteCallback(this).IsGood();
+#endif
+  // Always good
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Private: ProcessMessage function   ************************************
+// *****************************************************************************
+Result DisplayTransfer::ProcessMessage()
+{
+  switch(rcv_msg.cmd)
+  {
+    case CMD_SET_WINDOW:
+      display->SetAddrWindow(rcv_msg.start_x, rcv_msg.start_y, rcv_msg.end_x, rcv_msg.end_y);
+      break;
+
+    case CMD_WRITE_DATA:
+    {
+      // Time when transfer started
+      uint32_t start_ms = RtosTick::GetTimeMs();
+      // Write stream to display
+      display->WriteDataStream(rcv_msg.buf, rcv_msg.n);
+      // Wait until transfer complete
+      while(display->IsTransferComplete() == false)
+      {
+        // Wait for notification if callback is used. Timeout allows to
+        // continue if notification was missed.
+        if(is_transfer_callback) transfer_complete.Take(RtosTick::MsToTicks(TRANSFER_TIMEOUT_MS));
+        else                     RtosTick::Yield();
+      }
+      // Update transfer time
+      transfer_time_ms += RtosTick::GetTimeMs() - start_ms;
+      // Return buffer to the pool
+      ReleaseBuffer(rcv_msg.idx);
+      break;
+    }
+
+    case CMD_WRITE_COLOR:
+    {
+      // Time when transfer started
+      uint32_t start_ms = RtosTick::GetTimeMs();
+      // Write color by blocking writes
+      display->WriteColor(rcv_msg.color, rcv_msg.n);
+      // Update transfer time
+      transfer_time_ms += RtosTick::GetTimeMs() - start_ms;
+      break;
+    }
+
+    case CMD_STOP_TRANSFER:
+      display->StopTransfer();
+      break;
+
+    case CMD_SYNC:
+      sync.Give();
+      break;
+
+    default:
+      break;
+  }
+  // Always good - error in one command shouldn't stop the task
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Private: Send message to the task   ***********************************
+// *****************************************************************************
+Result DisplayTransfer::SendMessage(Message& msg)
+{
+  Result result = SendTaskMessage(&msg);
+  // Queue is full if many commands without buffers(colors, windows) are sent
+  // ahead of transfers. Wait for free space instead of losing command.
+  while(result == Result::ERR_QUEUE_WRITE)
+  {
+    RtosTick::DelayTicks(1u);
+    result = SendTaskMessage(&msg);
+  }
+  // Return result
+  return result;
+}
+
+#endif
@@ -0,0 +1,214 @@
+// *****************************************************************************
+// @file DisplayTransfer.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Display Transfer Task Class, header
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef DisplayTransfer_h
+#define DisplayTransfer_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "DevCfgRtos.h"
+#include "Framework/AppTask.h"
+
+#include "Interfaces/ICallback.h"
+#include "Interfaces/IDisplay.h"
+
+#if defined(DISPLAY_TRANSFER_TASK)
+
+// *****************************************************************************
+// ***   Display Transfer Class   **********************************************
+// *****************************************************************************
+// * Task that owns display transfers. Display driver task takes free buffer
+// * from pool, renders lines into it and sends it to this task via queue
+// * together with address window commands. After transfer complete buffer
+// * returned back to the pool, so display driver task is blocked only if all
+// * buffers are in flight.
+class DisplayTransfer : public AppTask, public ICallback
+{
+  public:
+    // *************************************************************************
+    // ***   Public: Constructor   *********************************************
+    // *************************************************************************
+    DisplayTransfer() : AppTask(DISPLAY_TRANSFER_TASK_STACK_SIZE, DISPLAY_TRANSFER_TASK_PRIORITY,
+                                "DisplayTransfer", QUEUE_LEN, sizeof(Message), &rcv_msg),
+                        free_queue(DISPLAY_BUF_CNT, sizeof(uint8_t)) {};
+
+    // *************************************************************************
+    // ***   Public: InitTask from AppTask to prevent warning   ****************
+    // *************************************************************************
+    using AppTask::InitTask;
+
+    // *************************************************************************
+    // ***   Public: Init Display Transfer Task   ******************************
+    // *************************************************************************
+    Result InitTask(IDisplay& in_display);
+
+    // *************************************************************************
+    // ***   Public: Get free buffer from pool   *******************************
+    // *************************************************************************
+    // * Blocks until one of buffers is returned by transfer task.
+    uint8_t GetFreeBuffer(void);
+
+    // *************************************************************************
+    // ***   Public: Return unused buffer to pool   ****************************
+    // *************************************************************************
+    void ReleaseBuffer(uint8_t idx);
+
+    // *************************************************************************
+    // ***   Public: Set address window   **************************************
+    // *************************************************************************
+    Result SetAddrWindow(int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y);
+
+    // *************************************************************************
+    // ***   Public: Send buffer to display   **********************************
+    // *************************************************************************
+    Result WriteDataStream(uint8_t idx, uint8_t* buf, uint32_t n);
+
+    // *************************************************************************
+    // ***   Public: Send one color for n pixels to display   ******************
+    // *************************************************************************
+    Result WriteColor(color_t color, uint32_t n);
+
+    // *************************************************************************
+    // ***   Public: Stop transfer(pull up CS)   *******************************
+    // *************************************************************************
+    Result StopTransfer(void);
+
+    // *************************************************************************
+    // ***   Public: Wait until all commands sent before are processed   *******
+    // *************************************************************************
+    Result Sync(void);
+
+    // *************************************************************************
+    // ***   Public: Get number of buffers taken from pool   *******************
+    // *************************************************************************
+    uint32_t GetBuffersInFlight(void);
+
+    // *************************************************************************
+    // ***   Public: Get time spent in transfers since last clear   ************
+    // *************************************************************************
+    inline uint32_t GetTransferTimeMs(void) {return transfer_time_ms;}
+
+    // *************************************************************************
+    // ***   Public: Clear transfer time   *************************************
+    // *************************************************************************
+    inline void ClearTransferTime(void) {transfer_time_ms = 0u;}
+
+    // *************************************************************************
+    // ***   Public: Transfer complete callback   ******************************
+    // *************************************************************************
+    virtual void Callback(void* ptr);
+
+  private:
+    // Command types
+    enum Command
+    {
+      CMD_SET_WINDOW,
+      CMD_WRITE_DATA,
+      CMD_WRITE_COLOR,
+      CMD_STOP_TRANSFER,
+      CMD_SYNC
+    };
+
+    // Message for the task queue
+    struct Message
+    {
+      Command cmd;
+      uint8_t idx;
+      uint8_t* buf;
+      uint32_t n;
+      color_t color;
+      int16_t start_x;
+      int16_t start_y;
+      int16_t end_x;
+      int16_t end_y;
+    };
+
+    // Each buffer can be preceded by color, stop and set window commands
+    static const uint16_t QUEUE_LEN = DISPLAY_BUF_CNT * 4u + 2u;
+    // Timeout for transfer complete notification
+    static const uint32_t TRANSFER_TIMEOUT_MS = 10u;
+
+    // Pointer to display
+    IDisplay* display = nullptr;
+    // Display driver reports transfer completion via callback
+    bool is_transfer_callback = false;
+    // Received message
+    Message rcv_msg;
+    // Pool of free buffers
+    RtosQueue free_queue;
+    // Time spent in transfers
+    volatile uint32_t transfer_time_ms = 0u;
+    // Transfer complete notification
+    RtosSemaphore transfer_complete;
+    // Sync notification
+    RtosSemaphore sync;
+
+    // *************************************************************************
+    // ***   Private: Setup function   *****************************************
+    // *************************************************************************
+    virtual Result Setup();
+
+    // *************************************************************************
+    // ***   Private: ProcessMessage function   ********************************
+    // *************************************************************************
+    virtual Result ProcessMessage();
+
+    // *************************************************************************
+    // ***   Private: Send message to the task   *******************************
+    // *************************************************************************
+    Result SendMessage(Message& msg);
+};
+
+#endif
+
+#endif
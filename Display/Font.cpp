@@ -0,0 +1,351 @@
+// *****************************************************************************
+// @file Font.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Font interface
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2016-2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "Font.h"
+#include <cstring> // for memcpy()
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Two 16-bit pixels can be stored by one word if first pixel is in low half
+#if defined(COLOR_16BIT) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define FONT_PIXEL_PAIRS
+#endif
+
+// *****************************************************************************
+// ***   Put column of character in buffer   ***********************************
+// *****************************************************************************
+void Font::DrawCharColumn(color_t* buf, int32_t n, int32_t pos, uint8_t ch, uint32_t col, uint32_t scale, color_t color, const color_t* bg_color)
+{
+  // Bytes in one line of character
+  uint32_t bytes_per_line = GetBytesPerChar() / GetCharH();
+  // Get pointer to the byte that contains column data in first line
+  const uint8_t* char_ptr = GetCharGataPtr(ch) + col / 8u;
+  // Column bit is the same for all lines
+  uint8_t mask = 1u << (col % 8u);
+  // Skip lines before buffer
+  uint32_t y = (pos < 0) ? ((-pos) / scale) : 0u;
+  pos += y * scale;
+  char_ptr += y * bytes_per_line;
+  // Output character column
+  for(; (y < GetCharH()) && (pos < n); y++)
+  {
+    bool is_set = ((*char_ptr & mask) != 0u);
+    for(uint32_t i = 0u; i < scale; i++)
+    {
+      // Put color in buffer only if visible
+      if((pos >= 0) && (pos < n))
+      {
+        if(is_set)
+        {
+          buf[pos] = color;
+        }
+        else if(bg_color != nullptr)
+        {
+          buf[pos] = *bg_color;
+        }
+        else
+        {
+          // Empty statement
+        }
+      }
+      pos++;
+    }
+    char_ptr += bytes_per_line;
+  }
+}
+
+// *****************************************************************************
+// ***   Put line of string in buffer   ****************************************
+// *****************************************************************************
+void Font::DrawStringLine(color_t* buf, int32_t start, int32_t end, int32_t x, const char* str, uint32_t line, uint32_t scale, color_t color, const color_t* bg_color)
+{
+  // Character width in pixels
+  int32_t char_w = GetCharW() * scale;
+  // Bytes in one line of character
+  uint32_t bytes_per_line = GetBytesPerChar() / GetCharH();
+  // Offset of the line in character data
+  uint32_t line_offset = line * bytes_per_line;
+  // Mask of character line bits, bits after character width can be not empty
+  uint32_t char_mask = (GetCharW() < 32u) ? ((1u << GetCharW()) - 1u) : 0xFFFFFFFFu;
+  // Cache is used for opaque background of scaled characters if character line
+  // fits in cache entry: unscaled line is expanded faster than it is looked up.
+  // Only task that owns the cache can use it.
+  GlyphCache* cache = nullptr;
+  if((glyph_cache != nullptr) && (bg_color != nullptr) && (scale > 1u) && (char_w <= FONT_CACHE_LINE_PIXELS) && glyph_cache->IsOwnerTask())
+  {
+    cache = glyph_cache;
+  }
+
+  // Skip characters before visible part without fetching its data
+  while((x + char_w <= start) && (*str != '\0'))
+  {
+    x += char_w;
+    str++;
+  }
+  // Draw characters until last visible one, visible part can be empty
+  while((x <= end) && (start <= end) && (*str != '\0') && (char_w > 0))
+  {
+    // Visible pixels of character
+    int32_t px = (x < start) ? start : x;
+    int32_t px_end = (x + char_w - 1 > end) ? end : (x + char_w - 1);
+    // Cached line pixels
+    const color_t* pixels = nullptr;
+    if(cache != nullptr)
+    {
+      pixels = cache->Find(*str, line, scale, color, *bg_color);
+    }
+    // Copy cached line
+    if(pixels != nullptr)
+    {
+      memcpy(&buf[px], &pixels[px - x], (px_end - px + 1) * sizeof(color_t));
+    }
+    else
+    {
+      // Get character line, first pixel in bit 0
+      const uint8_t* char_ptr = GetCharGataPtr(*str) + line_offset;
+      uint32_t b = 0u;
+      for(uint32_t i = 0u; i < bytes_per_line; i++)
+      {
+        b |= (uint32_t)char_ptr[i] << (i * 8u);
+      }
+      b &= char_mask;
+      if(cache != nullptr)
+      {
+        // Expand whole line to cache and copy visible part of it
+        color_t* new_pixels = cache->Add(*str, line, scale, color, *bg_color);
+        ExpandLine(new_pixels, char_w, b, scale, scale, color, *bg_color);
+        memcpy(&buf[px], &new_pixels[px - x], (px_end - px + 1) * sizeof(color_t));
+      }
+      else if(bg_color != nullptr)
+      {
+        // Opaque background: every bit selects color
+        ExpandLine(&buf[px], px_end - px + 1, b >> ((px - x) / scale), scale - (px - x) % scale, scale, color, *bg_color);
+      }
+      else if(scale == 1u)
+      {
+        // Transparent background: stop after last set bit
+        b >>= px - x;
+        for(int32_t i = px; (i <= px_end) && (b != 0u); i++)
+        {
+          if(b & 1u) buf[i] = color;
+          b >>= 1u;
+        }
+      }
+      else
+      {
+        // Remove bits of invisible pixels
+        b >>= (px - x) / scale;
+        // Pixels left for the first bit
+        int32_t rep = scale - (px - x) % scale;
+        while((px <= px_end) && (b != 0u))
+        {
+          if(rep > px_end - px + 1) rep = px_end - px + 1;
+          // Put scaled pixel
+          if(b & 1u)
+          {
+            for(int32_t i = 0; i < rep; i++)
+            {
+              buf[px + i] = color;
+            }
+          }
+          px += rep;
+          rep = scale;
+          b >>= 1u;
+        }
+      }
+    }
+    // Next character
+    x += char_w;
+    str++;
+  }
+}
+
+// *****************************************************************************
+// ***   Put column of string in buffer   **************************************
+// *****************************************************************************
+void Font::DrawStringColumn(color_t* buf, int32_t n, int32_t pos, const char* str, int32_t col, uint32_t scale, color_t color, const color_t* bg_color)
+{
+  // Character width in pixels
+  int32_t char_w = GetCharW() * scale;
+
+  // Column can be before string
+  if((col >= 0) && (char_w > 0))
+  {
+    // Index of character in string
+    int32_t idx = col / char_w;
+    // Find character, string can be shorter than column
+    while((idx > 0) && (*str != '\0'))
+    {
+      str++;
+      idx--;
+    }
+    // Draw column of character if it exist
+    if(*str != '\0')
+    {
+      DrawCharColumn(buf, n, pos, *str, (col % char_w) / scale, scale, color, bg_color);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Get width of string   *************************************************
+// *****************************************************************************
+uint32_t Font::GetStringW(const char* str, uint32_t n)
+{
+  uint32_t cnt = 0u;
+  // Count characters
+  if(str != nullptr)
+  {
+    while((cnt < n) && (str[cnt] != '\0')) cnt++;
+  }
+  // All characters have the same width
+  return cnt * GetCharW();
+}
+
+// *****************************************************************************
+// ***   Get pixels of characters   ********************************************
+// *****************************************************************************
+void Font::GetCharsPixels(const char* str, uint32_t first, uint32_t last, int32_t& start, int32_t& end)
+{
+  // Character draws only its cell
+  start = first * GetCharW();
+  end = (last + 1u) * GetCharW() - 1;
+}
+
+// *****************************************************************************
+// ***   Find changed characters of string   ***********************************
+// *****************************************************************************
+bool Font::FindChangedChars(const char* old_str, int32_t old_x, const char* new_str, int32_t new_x, uint32_t scale, int32_t& start, int32_t& end)
+{
+  // Character width in pixels
+  int32_t char_w = GetCharW() * scale;
+  // Ends of strings(exclusive)
+  int32_t old_end = old_x + ((old_str == nullptr) ? 0 : (int32_t)strlen(old_str)) * char_w;
+  int32_t new_end = new_x + ((new_str == nullptr) ? 0 : (int32_t)strlen(new_str)) * char_w;
+  // Area covered by both strings
+  int32_t from = MIN(old_x, new_x);
+  int32_t to = MAX(old_end, new_end);
+
+  // If characters of strings are in different cells - everything changed
+  if((char_w <= 0) || (((old_x - new_x) % char_w) != 0))
+  {
+    start = from;
+    end = to - 1;
+  }
+  else
+  {
+    start = to;
+    end = from - 1;
+    // Compare characters cell by cell, cell without character is empty
+    for(int32_t pos = from; pos < to; pos += char_w)
+    {
+      char old_ch = ((pos >= old_x) && (pos < old_end)) ? old_str[(pos - old_x) / char_w] : '\0';
+      char new_ch = ((pos >= new_x) && (pos < new_end)) ? new_str[(pos - new_x) / char_w] : '\0';
+      if(old_ch != new_ch)
+      {
+        if(start > pos) start = pos;
+        end = pos + char_w - 1;
+      }
+    }
+  }
+
+  // Return result
+  return (start <= end);
+}
+
+// *****************************************************************************
+// ***   Private: Expand character line to pixels   ****************************
+// *****************************************************************************
+void Font::ExpandLine(color_t* buf, int32_t cnt, uint32_t b, int32_t rep, uint32_t scale, color_t color, color_t bg_color)
+{
+  if(scale == 1u)
+  {
+#if defined(FONT_PIXEL_PAIRS)
+    // Two pixels for each combination of two bits, two pixels per word
+    const uint32_t pairs[4u] = {bg_color | ((uint32_t)bg_color << 16u), color | ((uint32_t)bg_color << 16u),
+                                bg_color | ((uint32_t)color << 16u),    color | ((uint32_t)color << 16u)};
+    for(; cnt >= 2; cnt -= 2)
+    {
+      memcpy(buf, &pairs[b & 3u], sizeof(uint32_t));
+      b >>= 2u;
+      buf += 2u;
+    }
+#endif
+    // Every bit selects color
+    const color_t colors[2u] = {bg_color, color};
+    for(; cnt > 0; cnt--)
+    {
+      *buf++ = colors[b & 1u];
+      b >>= 1u;
+    }
+  }
+  else
+  {
+    // Every bit gives scale pixels
+    while(cnt > 0)
+    {
+      if(rep > cnt) rep = cnt;
+      color_t c = (b & 1u) ? color : bg_color;
+      for(int32_t i = 0; i < rep; i++)
+      {
+        *buf++ = c;
+      }
+      cnt -= rep;
+      rep = scale;
+      b >>= 1u;
+    }
+  }
+}
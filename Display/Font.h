@@ -56,6 +56,7 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DevCfg.h"
+#include "Display/GlyphCache.h"
 
 // *****************************************************************************
 // ***   Font Class   **********************************************************
@@ -98,6 +99,73 @@ class Font
     // *************************************************************************
     virtual const uint8_t* GetGataPointer() {return font_data_ptr;}
 
+    // *************************************************************************
+    // ***   Put column of character in buffer   *******************************
+    // *************************************************************************
+    // * Puts column col of character ch scaled by scale in buf starting from
+    // * position pos(can be negative). Background isn't drawn if bg_color is
+    // * nullptr.
+    virtual void DrawCharColumn(color_t* buf, int32_t n, int32_t pos, uint8_t ch, uint32_t col, uint32_t scale, color_t color, const color_t* bg_color);
+
+    // *************************************************************************
+    // ***   Put line of string in buffer   ************************************
+    // *************************************************************************
+    // * Puts line of characters of str scaled by scale in buf. First character
+    // * starts from position x(can be negative). Only pixels from start to
+    // * end(inclusive) are drawn, so only characters that are visible there
+    // * are fetched from font. Background isn't drawn if bg_color is nullptr.
+    virtual void DrawStringLine(color_t* buf, int32_t start, int32_t end, int32_t x, const char* str, uint32_t line, uint32_t scale, color_t color, const color_t* bg_color);
+
+    // *************************************************************************
+    // ***   Put column of string in buffer   **********************************
+    // *************************************************************************
+    // * Puts column col of str scaled by scale in buf starting from position
+    // * pos(can be negative). Column is in pixels from first character.
+    // * Background isn't drawn if bg_color is nullptr.
+    virtual void DrawStringColumn(color_t* buf, int32_t n, int32_t pos, const char* str, int32_t col, uint32_t scale, color_t color, const color_t* bg_color);
+
+    // *************************************************************************
+    // ***   Get width of string   *********************************************
+    // *************************************************************************
+    // * Returns width in pixels of first n bytes of str or of whole str if it
+    // * is shorter.
+    virtual uint32_t GetStringW(const char* str, uint32_t n = UINT32_MAX);
+
+    // *************************************************************************
+    // ***   Get pixels of characters   ****************************************
+    // *************************************************************************
+    // * Finds first(start) and last(end) pixel from first character of str
+    // * that characters from byte first to byte last(inclusive) can draw.
+    virtual void GetCharsPixels(const char* str, uint32_t first, uint32_t last, int32_t& start, int32_t& end);
+
+    // *************************************************************************
+    // ***   Get overhang of glyphs   ******************************************
+    // *************************************************************************
+    // * Returns number of pixels that glyphs can draw before(left) and
+    // * after(right) their character cells.
+    virtual void GetOverhang(int32_t& left, int32_t& right) {left = 0; right = 0;}
+
+    // *************************************************************************
+    // ***   Find changed characters of string   *******************************
+    // *************************************************************************
+    // * Compares old_str drawn from position old_x with new_str drawn from
+    // * position new_x and finds first(start) and last(end) pixel of changed
+    // * character cells. Returns false if nothing changed. If strings aren't
+    // * shifted by whole characters, all area of both strings is changed.
+    virtual bool FindChangedChars(const char* old_str, int32_t old_x, const char* new_str, int32_t new_x, uint32_t scale, int32_t& start, int32_t& end);
+
+    // *************************************************************************
+    // ***   SetCache   ********************************************************
+    // *************************************************************************
+    // * Sets cache of expanded character lines used by DrawStringLine() for
+    // * text with opaque background. Pass nullptr to disable cache.
+    void SetCache(GlyphCache* cache) {glyph_cache = cache;}
+
+    // *************************************************************************
+    // ***   GetCache   ********************************************************
+    // *************************************************************************
+    GlyphCache* GetCache() {return glyph_cache;}
+
   protected:
     // Width and Height of character
     uint8_t char_width = 0U;
@@ -106,9 +174,16 @@ class Font
     uint16_t bytes_per_char = 0U;
     // Pointer to font data
     const uint8_t* font_data_ptr = nullptr;
+    // Pointer to glyph line cache
+    GlyphCache* glyph_cache = nullptr;
 
   private:
-    // Nothing yet
+    // *************************************************************************
+    // ***   Private: Expand character line to pixels   ************************
+    // *************************************************************************
+    // * Puts cnt pixels of bits b to buf, every bit gives scale pixels, first
+    // * bit gives rep pixels. Bits select color or bg_color.
+    static void ExpandLine(color_t* buf, int32_t cnt, uint32_t b, int32_t rep, uint32_t scale, color_t color, color_t bg_color);
 };
 
 #endif
@@ -0,0 +1,489 @@
+// *****************************************************************************
+// @file FontPacked.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Packed Proportional Font Class, implementation
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "FontPacked.h"
+#include <cstring> // for strlen()
+
+// *****************************************************************************
+// ***   Public: Constructor   *************************************************
+// *****************************************************************************
+FontPacked::FontPacked(const Data& data) : font(data)
+{
+  // Fixed size of character is size of widest character
+  char_width = data.max_advance;
+  char_height = data.height;
+}
+
+// *****************************************************************************
+// ***   Get glyph   ***********************************************************
+// *****************************************************************************
+const FontPacked::Glyph* FontPacked::GetGlyph(uint32_t code)
+{
+  const Glyph* glyph = nullptr;
+  // Page of code point
+  uint32_t page = code >> 8u;
+
+  // Find code point in index
+  if((page < font.pages_cnt) && (font.pages[page] != NO_PAGE))
+  {
+    // Block of code point and its bit in block mask
+    const Block& block = font.blocks[font.pages[page] + ((code >> 4u) & 0x0Fu)];
+    uint32_t bit = 1u << (code & 0x0Fu);
+    // Glyphs of present code points of block are stored one after another
+    if((block.mask & bit) != 0u)
+    {
+      glyph = &font.glyphs[block.glyph + BitCount(block.mask & (bit - 1u))];
+    }
+  }
+  // Use default glyph for missing code point
+  if((glyph == nullptr) && (font.default_glyph != NO_GLYPH))
+  {
+    glyph = &font.glyphs[font.default_glyph];
+  }
+
+  return glyph;
+}
+
+// *****************************************************************************
+// ***   Get code point   ******************************************************
+// *****************************************************************************
+uint32_t FontPacked::GetCode(const char*& str)
+{
+  // First byte of character
+  uint32_t code = (uint8_t)*str;
+  // Number of continuation bytes
+  uint32_t cnt = 0u;
+
+  // Find sequence length by first byte
+  if((code >= 0xC2u) && (code <= 0xDFu))
+  {
+    cnt = 1u;
+    code &= 0x1Fu;
+  }
+  else if((code >= 0xE0u) && (code <= 0xEFu))
+  {
+    cnt = 2u;
+    code &= 0x0Fu;
+  }
+  else if((code >= 0xF0u) && (code <= 0xF4u))
+  {
+    cnt = 3u;
+    code &= 0x07u;
+  }
+  else
+  {
+    ; // Single byte character
+  }
+
+  // Check continuation bytes, string end fails check too
+  uint32_t i = 1u;
+  while((i <= cnt) && (((uint8_t)str[i] & 0xC0u) == 0x80u))
+  {
+    code = (code << 6u) | ((uint8_t)str[i] & 0x3Fu);
+    i++;
+  }
+  // Byte that isn't valid sequence is taken as is
+  if(i <= cnt)
+  {
+    code = (uint8_t)*str;
+    i = 1u;
+  }
+  str += i;
+
+  return code;
+}
+
+// *****************************************************************************
+// ***   Put column of character in buffer   ***********************************
+// *****************************************************************************
+void FontPacked::DrawCharColumn(color_t* buf, int32_t n, int32_t pos, uint8_t ch, uint32_t col, uint32_t scale, color_t color, const color_t* bg_color)
+{
+  const Glyph* glyph = GetGlyph(ch);
+
+  if(glyph != nullptr)
+  {
+    // Background of character cell
+    if((bg_color != nullptr) && (col < glyph->advance))
+    {
+      Fill(buf, 0, n - 1, pos, font.height * scale, *bg_color);
+    }
+    // Column of glyph bounding box
+    int32_t gx = (int32_t)col - glyph->x_offset;
+    if((gx >= 0) && (gx < glyph->width))
+    {
+      DrawGlyphColumn(buf, n, pos + glyph->y_offset * (int32_t)scale, *glyph, gx, scale, color);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Put line of string in buffer   ****************************************
+// *****************************************************************************
+void FontPacked::DrawStringLine(color_t* buf, int32_t start, int32_t end, int32_t x, const char* str, uint32_t line, uint32_t scale, color_t color, const color_t* bg_color)
+{
+  // Left most pixel of glyph from pen position
+  int32_t min_x = font.min_x_offset * (int32_t)scale;
+  // Background can be drawn cell by cell only if glyphs don't draw after
+  // their cells, otherwise next cell background would clear them
+  const color_t* cell_bg = (font.max_overhang == 0u) ? bg_color : nullptr;
+
+  // Visible part can be empty
+  if((start <= end) && (str != nullptr))
+  {
+    // Background of all character cells at once
+    if((bg_color != nullptr) && (cell_bg == nullptr))
+    {
+      Fill(buf, start, end, x, FindStringEnd(str, x, end, scale) - x, *bg_color);
+    }
+    // Draw characters until glyph can't reach visible part
+    while((*str != '\0') && (*str != '\n') && (x + min_x <= end))
+    {
+      const Glyph* glyph = GetGlyph(GetCode(str));
+      if(glyph != nullptr)
+      {
+        // Background of character cell
+        if(cell_bg != nullptr)
+        {
+          Fill(buf, start, end, x, glyph->advance * scale, *cell_bg);
+        }
+        // Row of glyph bounding box
+        uint32_t row = line - glyph->y_offset;
+        if(row < glyph->height)
+        {
+          DrawGlyphLine(buf, start, end, x + glyph->x_offset * (int32_t)scale, *glyph, row, scale, color);
+        }
+        x += glyph->advance * scale;
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Put column of string in buffer   **************************************
+// *****************************************************************************
+void FontPacked::DrawStringColumn(color_t* buf, int32_t n, int32_t pos, const char* str, int32_t col, uint32_t scale, color_t color, const color_t* bg_color)
+{
+  // Left most pixel of glyph from pen position
+  int32_t min_x = font.min_x_offset * (int32_t)scale;
+  // Pen position
+  int32_t x = 0;
+  // Background can be drawn when cell is found only if glyphs don't draw
+  // after their cells, otherwise it would clear previous glyph
+  const color_t* cell_bg = (font.max_overhang == 0u) ? bg_color : nullptr;
+
+  if(str != nullptr)
+  {
+    // Background only inside character cells
+    if((bg_color != nullptr) && (cell_bg == nullptr) && (col >= 0) && (col < FindStringEnd(str, 0, col, scale)))
+    {
+      Fill(buf, 0, n - 1, pos, font.height * scale, *bg_color);
+    }
+    // Column can be drawn by several characters if glyphs overlap
+    while((*str != '\0') && (*str != '\n') && (x + min_x <= col))
+    {
+      const Glyph* glyph = GetGlyph(GetCode(str));
+      if(glyph != nullptr)
+      {
+        // Background of character cell
+        if((cell_bg != nullptr) && (col >= x) && (col < x + glyph->advance * (int32_t)scale))
+        {
+          Fill(buf, 0, n - 1, pos, font.height * scale, *cell_bg);
+        }
+        // Column of glyph bounding box
+        int32_t gx = col - (x + glyph->x_offset * (int32_t)scale);
+        if((gx >= 0) && (gx < glyph->width * (int32_t)scale))
+        {
+          DrawGlyphColumn(buf, n, pos + glyph->y_offset * (int32_t)scale, *glyph, gx / scale, scale, color);
+        }
+        x += glyph->advance * scale;
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Get width of string   *************************************************
+// *****************************************************************************
+uint32_t FontPacked::GetStringW(const char* str, uint32_t n)
+{
+  uint32_t w = 0u;
+
+  if(str != nullptr)
+  {
+    // Characters that start in first n bytes
+    const char* str_start = str;
+    while((*str != '\0') && (*str != '\n') && ((uint32_t)(str - str_start) < n))
+    {
+      w += GetAdvance(GetCode(str));
+    }
+  }
+
+  return w;
+}
+
+// *****************************************************************************
+// ***   Get pixels of characters   ********************************************
+// *****************************************************************************
+void FontPacked::GetCharsPixels(const char* str, uint32_t first, uint32_t last, int32_t& start, int32_t& end)
+{
+  // First byte of character that contains byte first
+  while((first > 0u) && (((uint8_t)str[first] & 0xC0u) == 0x80u)) first--;
+  // Glyphs can be drawn outside of their cells
+  start = GetStringW(str, first) + font.min_x_offset;
+  end = GetStringW(str, last + 1u) - 1 + font.max_overhang;
+}
+
+// *****************************************************************************
+// ***   Find changed characters of string   ***********************************
+// *****************************************************************************
+bool FontPacked::FindChangedChars(const char* old_str, int32_t old_x, const char* new_str, int32_t new_x, uint32_t scale, int32_t& start, int32_t& end)
+{
+  // Empty string instead of missing one
+  if(old_str == nullptr) old_str = "";
+  if(new_str == nullptr) new_str = "";
+  // Lengths of strings in bytes and in pixels
+  uint32_t old_len = strlen(old_str);
+  uint32_t new_len = strlen(new_str);
+  int32_t old_end = old_x + (int32_t)(GetStringW(old_str) * scale);
+  int32_t new_end = new_x + (int32_t)(GetStringW(new_str) * scale);
+  // Area covered by both strings
+  int32_t from = MIN(old_x, new_x);
+  int32_t to = MAX(old_end, new_end);
+  // Bytes at the beginning of strings that are the same
+  uint32_t prefix = 0u;
+  // Bytes at the end of strings that are the same
+  uint32_t suffix = 0u;
+
+  // Same characters at the same position at the beginning
+  if(old_x == new_x)
+  {
+    while((prefix < old_len) && (old_str[prefix] == new_str[prefix])) prefix++;
+    // Don't split UTF-8 character
+    while((prefix > 0u) && (((uint8_t)new_str[prefix] & 0xC0u) == 0x80u)) prefix--;
+    from = new_x + (int32_t)(GetStringW(new_str, prefix) * scale);
+  }
+  // Same characters at the same position at the end
+  if(old_end == new_end)
+  {
+    while((suffix < old_len - prefix) && (suffix < new_len - prefix) &&
+          (old_str[old_len - suffix - 1u] == new_str[new_len - suffix - 1u])) suffix++;
+    // Don't split UTF-8 character
+    while((suffix > 0u) && (((uint8_t)new_str[new_len - suffix] & 0xC0u) == 0x80u)) suffix--;
+    to = new_x + (int32_t)(GetStringW(new_str, new_len - suffix) * scale);
+  }
+  // Glyphs can be drawn outside of their cells
+  start = from + font.min_x_offset * (int32_t)scale;
+  end = to - 1 + font.max_overhang * (int32_t)scale;
+
+  // Something changed if strings or its positions are different
+  return ((old_x != new_x) || (old_len != new_len) || (prefix != old_len)) && (start <= end);
+}
+
+// *****************************************************************************
+// ***   Private: Get advance of code point   **********************************
+// *****************************************************************************
+inline int32_t FontPacked::GetAdvance(uint32_t code)
+{
+  const Glyph* glyph = GetGlyph(code);
+  return (glyph == nullptr) ? 0 : glyph->advance;
+}
+
+// *****************************************************************************
+// ***   Private: Find end of string   *****************************************
+// *****************************************************************************
+int32_t FontPacked::FindStringEnd(const char* str, int32_t x, int32_t limit, uint32_t scale)
+{
+  while((*str != '\0') && (*str != '\n') && (x <= limit))
+  {
+    x += GetAdvance(GetCode(str)) * scale;
+  }
+  return x;
+}
+
+// *****************************************************************************
+// ***   Private: Put line of glyph in buffer   ********************************
+// *****************************************************************************
+void FontPacked::DrawGlyphLine(color_t* buf, int32_t start, int32_t end, int32_t x, const Glyph& glyph, uint32_t row, uint32_t scale, color_t color)
+{
+  // Glyph data
+  const uint8_t* data = &font.bitmap[glyph.offset];
+
+  // Draw only if glyph line is visible
+  if((x <= end) && (x + glyph.width * (int32_t)scale > start))
+  {
+    if((glyph.flags & GLYPH_RLE) != 0u)
+    {
+      // Skip rows before: every row is number of runs and runs
+      for(uint32_t i = 0u; i < row; i++)
+      {
+        data += *data + 1u;
+      }
+      // Draw runs of set pixels
+      uint32_t cnt = *data++;
+      for(uint32_t i = 0u; (i < cnt) && (x <= end); i++)
+      {
+        x += (data[i] >> 4u) * scale;
+        int32_t set = (data[i] & 0x0Fu) * scale;
+        Fill(buf, start, end, x, set, color);
+        x += set;
+      }
+    }
+    else
+    {
+      // First bit of row
+      uint32_t bit = row * glyph.width;
+      // Row is processed by parts that fit in word
+      for(uint32_t col = 0u; (col < glyph.width) && (x + (int32_t)(col * scale) <= end); col += 24u)
+      {
+        uint32_t cnt = glyph.width - col;
+        if(cnt > 24u) cnt = 24u;
+        // Get bits of pixels, first pixel in bit 0
+        const uint8_t* ptr = &data[(bit + col) >> 3u];
+        uint32_t shift = (bit + col) & 7u;
+        uint32_t b = 0u;
+        for(uint32_t i = 0u; i * 8u < shift + cnt; i++)
+        {
+          b |= (uint32_t)ptr[i] << (i * 8u);
+        }
+        b = (b >> shift) & ((1u << cnt) - 1u);
+        // Draw runs of set pixels, stop after last one
+        int32_t px = x + (int32_t)(col * scale);
+        while(b != 0u)
+        {
+          while((b & 1u) == 0u)
+          {
+            b >>= 1u;
+            px += scale;
+          }
+          int32_t set = 0;
+          while((b & 1u) != 0u)
+          {
+            b >>= 1u;
+            set += scale;
+          }
+          Fill(buf, start, end, px, set, color);
+          px += set;
+        }
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Put column of glyph in buffer   ******************************
+// *****************************************************************************
+void FontPacked::DrawGlyphColumn(color_t* buf, int32_t n, int32_t pos, const Glyph& glyph, uint32_t col, uint32_t scale, color_t color)
+{
+  // Glyph data
+  const uint8_t* data = &font.bitmap[glyph.offset];
+
+  for(uint32_t row = 0u; (row < glyph.height) && (pos < n); row++)
+  {
+    bool is_set = false;
+    if((glyph.flags & GLYPH_RLE) != 0u)
+    {
+      // Find run that contains column
+      uint32_t cnt = *data++;
+      uint32_t x = 0u;
+      for(uint32_t i = 0u; (i < cnt) && (x <= col); i++)
+      {
+        x += data[i] >> 4u;
+        is_set = (col >= x) && (col < x + (data[i] & 0x0Fu));
+        x += data[i] & 0x0Fu;
+      }
+      data += cnt;
+    }
+    else
+    {
+      uint32_t bit = row * glyph.width + col;
+      is_set = ((data[bit >> 3u] & (1u << (bit & 7u))) != 0u);
+    }
+    // Put scaled pixel
+    if(is_set)
+    {
+      Fill(buf, 0, n - 1, pos, scale, color);
+    }
+    pos += scale;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Fill pixels   ************************************************
+// *****************************************************************************
+inline void FontPacked::Fill(color_t* buf, int32_t start, int32_t end, int32_t x, int32_t cnt, color_t color)
+{
+  // Visible part of pixels
+  int32_t px_end = x + cnt - 1;
+  if(x < start) x = start;
+  if(px_end > end) px_end = end;
+  // Put pixels
+  for(; x <= px_end; x++)
+  {
+    buf[x] = color;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Count set bits   *********************************************
+// *****************************************************************************
+inline uint32_t FontPacked::BitCount(uint32_t mask)
+{
+#if defined(__GNUC__)
+  return __builtin_popcount(mask);
+#else
+  uint32_t cnt = 0u;
+  for(; mask != 0u; mask &= mask - 1u) cnt++;
+  return cnt;
+#endif
+}
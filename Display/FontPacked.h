@@ -0,0 +1,229 @@
+// *****************************************************************************
+// @file FontPacked.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Packed Proportional Font Class, header
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+
+#ifndef FontPacked_h
+#define FontPacked_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "Display/Font.h"
+
+// *****************************************************************************
+// ***   FontPacked Class   ****************************************************
+// *****************************************************************************
+// * Proportional font: each glyph has own advance and bounding box, so blank
+// * parts of glyphs don't take space. Glyphs are found by code point through
+// * two level index: 256 code points pages of 16 code points blocks. Strings
+// * are UTF-8, byte that isn't valid UTF-8 sequence is taken as code point.
+// * Drawing and width of string stop at new line character. Font data is
+// * generated from BDF font by Tools/bdf2font.py.
+class FontPacked : public Font
+{
+  public:
+    // Glyph rows are run-length encoded
+    static const uint8_t GLYPH_RLE = 0x01u;
+    // Page without glyphs
+    static const uint16_t NO_PAGE = 0xFFFFu;
+    // No glyph for code points that aren't in font
+    static const uint16_t NO_GLYPH = 0xFFFFu;
+
+    // *************************************************************************
+    // ***   Glyph   ***********************************************************
+    // *************************************************************************
+    // * Bounding box is relative to pen position and top of font. Bitmap is
+    // * width * height bits row after row, first pixel in bit 0 of byte.
+    // * Run-length encoded bitmap is height rows of byte with number of runs
+    // * and runs: high nibble - clear pixels, low nibble - set pixels.
+    struct Glyph
+    {
+      uint16_t offset;  // Offset of bitmap in font bitmap data
+      uint8_t width;    // Bounding box width
+      uint8_t height;   // Bounding box height
+      int8_t x_offset;  // Bounding box left side from pen position
+      int8_t y_offset;  // Bounding box top side from top of font
+      uint8_t advance;  // Pen advance
+      uint8_t flags;    // Glyph flags
+    };
+
+    // *************************************************************************
+    // ***   Block of 16 code points   *****************************************
+    // *************************************************************************
+    struct Block
+    {
+      uint16_t glyph;   // Glyph of first code point that is present in block
+      uint16_t mask;    // Bit N is set if code point N of block is present
+    };
+
+    // *************************************************************************
+    // ***   Font data   *******************************************************
+    // *************************************************************************
+    struct Data
+    {
+      const Glyph* glyphs;     // Glyphs in code point order
+      const uint8_t* bitmap;   // Bitmaps of glyphs
+      const uint16_t* pages;   // First block of each page or NO_PAGE
+      const Block* blocks;     // Blocks, 16 for each page
+      uint16_t pages_cnt;      // Number of pages
+      uint16_t default_glyph;  // Glyph for missing code points or NO_GLYPH
+      uint8_t height;          // Height of font
+      uint8_t max_advance;     // Maximum advance of glyphs
+      int8_t min_x_offset;     // Left most glyph pixel from pen, zero or less
+      uint8_t max_overhang;    // Right most glyph pixel after advance
+    };
+
+    // *************************************************************************
+    // ***   Public: Constructor   *********************************************
+    // *************************************************************************
+    explicit FontPacked(const Data& data);
+
+    // *************************************************************************
+    // ***   GetCharGataPtr   **************************************************
+    // *************************************************************************
+    // * Font doesn't have fixed size character data.
+    virtual const uint8_t* GetCharGataPtr(uint8_t ch) {return nullptr;}
+
+    // *************************************************************************
+    // ***   Get glyph   *******************************************************
+    // *************************************************************************
+    // * Returns glyph of code point, default glyph if font doesn't have it
+    // * or nullptr if there is no default glyph.
+    const Glyph* GetGlyph(uint32_t code);
+
+    // *************************************************************************
+    // ***   Get code point   **************************************************
+    // *************************************************************************
+    // * Decodes UTF-8 character and moves str to next one.
+    static uint32_t GetCode(const char*& str);
+
+    // *************************************************************************
+    // ***   Put column of character in buffer   *******************************
+    // *************************************************************************
+    // * Column is in pixels from pen position, character is code point 0-255.
+    virtual void DrawCharColumn(color_t* buf, int32_t n, int32_t pos, uint8_t ch, uint32_t col, uint32_t scale, color_t color, const color_t* bg_color);
+
+    // *************************************************************************
+    // ***   Put line of string in buffer   ************************************
+    // *************************************************************************
+    virtual void DrawStringLine(color_t* buf, int32_t start, int32_t end, int32_t x, const char* str, uint32_t line, uint32_t scale, color_t color, const color_t* bg_color);
+
+    // *************************************************************************
+    // ***   Put column of string in buffer   **********************************
+    // *************************************************************************
+    virtual void DrawStringColumn(color_t* buf, int32_t n, int32_t pos, const char* str, int32_t col, uint32_t scale, color_t color, const color_t* bg_color);
+
+    // *************************************************************************
+    // ***   Get width of string   *********************************************
+    // *************************************************************************
+    virtual uint32_t GetStringW(const char* str, uint32_t n = UINT32_MAX);
+
+    // *************************************************************************
+    // ***   Get pixels of characters   ****************************************
+    // *************************************************************************
+    virtual void GetCharsPixels(const char* str, uint32_t first, uint32_t last, int32_t& start, int32_t& end);
+
+    // *************************************************************************
+    // ***   Get overhang of glyphs   ******************************************
+    // *************************************************************************
+    virtual void GetOverhang(int32_t& left, int32_t& right) {left = -font.min_x_offset; right = font.max_overhang;}
+
+    // *************************************************************************
+    // ***   Find changed characters of string   *******************************
+    // *************************************************************************
+    // * Same characters at the same positions at the beginning and at the end
+    // * of strings aren't changed, everything between them is.
+    virtual bool FindChangedChars(const char* old_str, int32_t old_x, const char* new_str, int32_t new_x, uint32_t scale, int32_t& start, int32_t& end);
+
+  private:
+    // Font data
+    const Data& font;
+
+    // *************************************************************************
+    // ***   Private: Get advance of code point   ******************************
+    // *************************************************************************
+    inline int32_t GetAdvance(uint32_t code);
+
+    // *************************************************************************
+    // ***   Private: Find end of string   *************************************
+    // *************************************************************************
+    // * Returns pen position after last character of str that starts not
+    // * after limit. String starts from position x.
+    int32_t FindStringEnd(const char* str, int32_t x, int32_t limit, uint32_t scale);
+
+    // *************************************************************************
+    // ***   Private: Put line of glyph in buffer   ****************************
+    // *************************************************************************
+    // * Puts set pixels of glyph row starting from position x. Only pixels
+    // * from start to end(inclusive) are drawn.
+    void DrawGlyphLine(color_t* buf, int32_t start, int32_t end, int32_t x, const Glyph& glyph, uint32_t row, uint32_t scale, color_t color);
+
+    // *************************************************************************
+    // ***   Private: Put column of glyph in buffer   **************************
+    // *************************************************************************
+    // * Puts set pixels of glyph column starting from position pos.
+    void DrawGlyphColumn(color_t* buf, int32_t n, int32_t pos, const Glyph& glyph, uint32_t col, uint32_t scale, color_t color);
+
+    // *************************************************************************
+    // ***   Private: Fill pixels   ********************************************
+    // *************************************************************************
+    // * Puts cnt pixels of color starting from position x. Only pixels from
+    // * start to end(inclusive) are drawn.
+    static inline void Fill(color_t* buf, int32_t start, int32_t end, int32_t x, int32_t cnt, color_t color);
+
+    // *************************************************************************
+    // ***   Private: Count set bits   *****************************************
+    // *************************************************************************
+    static inline uint32_t BitCount(uint32_t mask);
+};
+
+#endif
@@ -38,6 +38,11 @@ Font_12x16::Font_12x16()
   char_height = 16U;
   bytes_per_char = 32U;
   font_data_ptr = (uint8_t*)font_data;
+#if defined(FONT_12x16_CACHE_LINES) && (FONT_12x16_CACHE_LINES > 0)
+  // Glyph line cache for this font
+  static GlyphCacheBuf<FONT_12x16_CACHE_LINES> cache;
+  glyph_cache = &cache;
+#endif
 }
 
 // *****************************************************************************
@@ -38,6 +38,11 @@ Font_4x6::Font_4x6()
   char_height = 6U;
   bytes_per_char = 6U;
   font_data_ptr = (uint8_t*)font_data;
+#if defined(FONT_4x6_CACHE_LINES) && (FONT_4x6_CACHE_LINES > 0)
+  // Glyph line cache for this font
+  static GlyphCacheBuf<FONT_4x6_CACHE_LINES> cache;
+  glyph_cache = &cache;
+#endif
 }
 
 // *****************************************************************************
@@ -38,6 +38,11 @@ Font_6x8::Font_6x8()
   char_height = 8U;
   bytes_per_char = 8U;
   font_data_ptr = (uint8_t*)font_data;
+#if defined(FONT_6x8_CACHE_LINES) && (FONT_6x8_CACHE_LINES > 0)
+  // Glyph line cache for this font
+  static GlyphCacheBuf<FONT_6x8_CACHE_LINES> cache;
+  glyph_cache = &cache;
+#endif
 }
 
 // *****************************************************************************
@@ -38,6 +38,11 @@ Font_8x12::Font_8x12()
   char_height = 12U;
   bytes_per_char = 12U;
   font_data_ptr = (uint8_t*)font_data;
+#if defined(FONT_8x12_CACHE_LINES) && (FONT_8x12_CACHE_LINES > 0)
+  // Glyph line cache for this font
+  static GlyphCacheBuf<FONT_8x12_CACHE_LINES> cache;
+  glyph_cache = &cache;
+#endif
 }
 
 // *****************************************************************************
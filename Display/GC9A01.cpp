@@ -24,6 +24,87 @@
 // ***   Defines   *************************************************************
 // *****************************************************************************
 
+// Command list: if this bit is set in number of parameters, delay in ms follows
+// command parameters
+#define CMD_LIST_DELAY 0x80
+
+// *****************************************************************************
+// ***   Init sequence   *******************************************************
+// *****************************************************************************
+static const uint8_t init_cmd_list[] =
+{
+  // Set the resolution and scanning method of the screen
+  // Set the read / write scan direction of the frame memory
+  0x36, 1u, 0xC8, // MX, MY, RGB mode, 0x08 set RGB
+
+  // Set the initialization register
+  0xEF, 0u,
+  0xEB, 1u, 0x14,
+  0xFE, 0u,
+  0xEF, 0u,
+  0xEB, 1u, 0x14,
+  0x84, 1u, 0x40,
+  0x85, 1u, 0xFF,
+  0x86, 1u, 0xFF,
+  0x87, 1u, 0xFF,
+  0x88, 1u, 0x0A,
+  0x89, 1u, 0x21,
+  0x8A, 1u, 0x00,
+  0x8B, 1u, 0x80,
+  0x8C, 1u, 0x01,
+  0x8D, 1u, 0x01,
+  0x8E, 1u, 0xFF,
+  0x8F, 1u, 0xFF,
+  0xB6, 2u, 0x00, 0x20,
+  0x36, 1u, 0x08, // Set as vertical screen
+  0x3A, 1u, 0x05,
+  0x90, 4u, 0x08, 0x08, 0x08, 0x08,
+  0xBD, 1u, 0x06,
+  0xBC, 1u, 0x00,
+  0xFF, 3u, 0x60, 0x01, 0x04,
+  0xC3, 1u, 0x13,
+  0xC4, 1u, 0x13,
+  0xC9, 1u, 0x22,
+  0xBE, 1u, 0x11,
+  0xE1, 2u, 0x10, 0x0E,
+  0xDF, 3u, 0x21, 0x0C, 0x02,
+  0xF0, 6u, 0x45, 0x09, 0x08, 0x08, 0x26, 0x2A,
+  0xF1, 6u, 0x43, 0x70, 0x72, 0x36, 0x37, 0x6F,
+  0xF2, 6u, 0x45, 0x09, 0x08, 0x08, 0x26, 0x2A,
+  0xF3, 6u, 0x43, 0x70, 0x72, 0x36, 0x37, 0x6F,
+  0xED, 2u, 0x1B, 0x0B,
+  0xAE, 1u, 0x77,
+  0xCD, 1u, 0x63,
+  0x70, 9u,
+    0x07, 0x07, 0x04, 0x0E, 0x0F, 0x09, 0x07, 0x08,
+    0x03,
+  0xE8, 1u, 0x34,
+  0x62, 12u,
+    0x18, 0x0D, 0x71, 0xED, 0x70, 0x70, 0x18, 0x0F,
+    0x71, 0xEF, 0x70, 0x70,
+  0x63, 12u,
+    0x18, 0x11, 0x71, 0xF1, 0x70, 0x70, 0x18, 0x13,
+    0x71, 0xF3, 0x70, 0x70,
+  0x64, 7u,
+    0x28, 0x29, 0xF1, 0x01, 0xF1, 0x00, 0x07,
+  0x66, 10u,
+    0x3C, 0x00, 0xCD, 0x67, 0x45, 0x45, 0x10, 0x00,
+    0x00, 0x00,
+  0x67, 10u,
+    0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10,
+    0x32, 0x98,
+  0x74, 7u,
+    0x10, 0x85, 0x80, 0x00, 0x00, 0x4E, 0x00,
+  0x98, 2u, 0x3E, 0x07,
+  0x35, 0u,
+  0x21, 0u,
+
+  // Exit sleep
+  0x11, CMD_LIST_DELAY, 120u,
+  // Display on
+  0x29, CMD_LIST_DELAY, 20u,
+};
+
 // *****************************************************************************
 // ***   Public: Init screen   *************************************************
 // *****************************************************************************
@@ -40,245 +121,30 @@ Result GC9A01::Init(void)
     Delay(100u);            // Wait for 100 ms
   }
 
-  // Set the resolution and scanning method of the screen
-  // Set the read / write scan direction of the frame memory
-  WriteCommand(0x36); // MX, MY, RGB mode
-  WriteData(0XC8);    // 0x08 set RGB
-
-  // Set the initialization register
-  WriteCommand(0xEF);
-  WriteCommand(0xEB);
-  WriteData(0x14);
-
-  WriteCommand(0xFE);
-  WriteCommand(0xEF);
-
-  WriteCommand(0xEB);
-  WriteData(0x14);
-
-  WriteCommand(0x84);
-  WriteData(0x40);
-
-  WriteCommand(0x85);
-  WriteData(0xFF);
-
-  WriteCommand(0x86);
-  WriteData(0xFF);
-
-  WriteCommand(0x87);
-  WriteData(0xFF);
-
-  WriteCommand(0x88);
-  WriteData(0x0A);
-
-  WriteCommand(0x89);
-  WriteData(0x21);
-
-  WriteCommand(0x8A);
-  WriteData(0x00);
-
-  WriteCommand(0x8B);
-  WriteData(0x80);
-
-  WriteCommand(0x8C);
-  WriteData(0x01);
-
-  WriteCommand(0x8D);
-  WriteData(0x01);
-
-  WriteCommand(0x8E);
-  WriteData(0xFF);
+  // Send init sequence
+  WriteCommandList(init_cmd_list, sizeof(init_cmd_list));
 
-  WriteCommand(0x8F);
-  WriteData(0xFF);
-
-  WriteCommand(0xB6);
-  WriteData(0x00);
-  WriteData(0x20);
-
-  WriteCommand(0x36);
-  WriteData(0x08); // Set as vertical screen
-
-  WriteCommand(0x3A);
-  WriteData(0x05);
-
-
-  WriteCommand(0x90);
-  WriteData(0x08);
-  WriteData(0x08);
-  WriteData(0x08);
-  WriteData(0x08);
-
-  WriteCommand(0xBD);
-  WriteData(0x06);
-
-  WriteCommand(0xBC);
-  WriteData(0x00);
-
-  WriteCommand(0xFF);
-  WriteData(0x60);
-  WriteData(0x01);
-  WriteData(0x04);
-
-  WriteCommand(0xC3);
-  WriteData(0x13);
-  WriteCommand(0xC4);
-  WriteData(0x13);
-
-  WriteCommand(0xC9);
-  WriteData(0x22);
-
-  WriteCommand(0xBE);
-  WriteData(0x11);
-
-  WriteCommand(0xE1);
-  WriteData(0x10);
-  WriteData(0x0E);
-
-  WriteCommand(0xDF);
-  WriteData(0x21);
-  WriteData(0x0c);
-  WriteData(0x02);
-
-  WriteCommand(0xF0);
-  WriteData(0x45);
-  WriteData(0x09);
-  WriteData(0x08);
-  WriteData(0x08);
-  WriteData(0x26);
-  WriteData(0x2A);
-
-  WriteCommand(0xF1);
-  WriteData(0x43);
-  WriteData(0x70);
-  WriteData(0x72);
-  WriteData(0x36);
-  WriteData(0x37);
-  WriteData(0x6F);
-
-
-  WriteCommand(0xF2);
-  WriteData(0x45);
-  WriteData(0x09);
-  WriteData(0x08);
-  WriteData(0x08);
-  WriteData(0x26);
-  WriteData(0x2A);
-
-  WriteCommand(0xF3);
-  WriteData(0x43);
-  WriteData(0x70);
-  WriteData(0x72);
-  WriteData(0x36);
-  WriteData(0x37); 
-  WriteData(0x6F);
-
-  WriteCommand(0xED);
-  WriteData(0x1B);
-  WriteData(0x0B);
-
-  WriteCommand(0xAE);
-  WriteData(0x77);
-
-  WriteCommand(0xCD);
-  WriteData(0x63);
-
-
-  WriteCommand(0x70);
-  WriteData(0x07);
-  WriteData(0x07);
-  WriteData(0x04);
-  WriteData(0x0E);
-  WriteData(0x0F);
-  WriteData(0x09);
-  WriteData(0x07);
-  WriteData(0x08);
-  WriteData(0x03);
-
-  WriteCommand(0xE8);
-  WriteData(0x34);
-
-  WriteCommand(0x62);
-  WriteData(0x18);
-  WriteData(0x0D);
-  WriteData(0x71);
-  WriteData(0xED);
-  WriteData(0x70);
-  WriteData(0x70);
-  WriteData(0x18);
-  WriteData(0x0F);
-  WriteData(0x71);
-  WriteData(0xEF);
-  WriteData(0x70);
-  WriteData(0x70);
-
-  WriteCommand(0x63);
-  WriteData(0x18);
-  WriteData(0x11);
-  WriteData(0x71);
-  WriteData(0xF1);
-  WriteData(0x70);
-  WriteData(0x70);
-  WriteData(0x18);
-  WriteData(0x13);
-  WriteData(0x71);
-  WriteData(0xF3);
-  WriteData(0x70);
-  WriteData(0x70);
-
-  WriteCommand(0x64);
-  WriteData(0x28);
-  WriteData(0x29);
-  WriteData(0xF1);
-  WriteData(0x01);
-  WriteData(0xF1);
-  WriteData(0x00);
-  WriteData(0x07);
-
-  WriteCommand(0x66);
-  WriteData(0x3C);
-  WriteData(0x00);
-  WriteData(0xCD);
-  WriteData(0x67);
-  WriteData(0x45);
-  WriteData(0x45);
-  WriteData(0x10);
-  WriteData(0x00);
-  WriteData(0x00);
-  WriteData(0x00);
-
-  WriteCommand(0x67);
-  WriteData(0x00);
-  WriteData(0x3C);
-  WriteData(0x00);
-  WriteData(0x00);
-  WriteData(0x00);
-  WriteData(0x01);
-  WriteData(0x54);
-  WriteData(0x10);
-  WriteData(0x32);
-  WriteData(0x98);
-
-  WriteCommand(0x74);
-  WriteData(0x10);
-  WriteData(0x85);
-  WriteData(0x80);
-  WriteData(0x00); 
-  WriteData(0x00); 
-  WriteData(0x4E);
-  WriteData(0x00);
-
-  WriteCommand(0x98);
-  WriteData(0x3e);
-  WriteData(0x07);
-
-  WriteCommand(0x35);
-  WriteCommand(0x21);
-
-  WriteCommand(0x11);
-  Delay(120u);
-  WriteCommand(0x29);
-  Delay(20u);
+  // Only part of round panel inside the circle is visible
+  is_mask_valid = (init_width == init_height) && (init_height <= MASK_LINES);
+  if(is_mask_valid)
+  {
+    // Coordinates are doubled to work with pixel edges in integers
+    int32_t d = init_width;
+    for(int32_t y = 0; y < init_height; y++)
+    {
+      // Distance from center to the nearest horizontal edge of pixel
+      int32_t dy = (2 * y + 1 < d) ? (d - 2 * y - 2) : (2 * y - d);
+      // First pixel which nearest vertical edge is inside the circle
+      int32_t x = 0;
+      while((x < d / 2) && (((d - 2 * x - 2) * (d - 2 * x - 2) + dy * dy) >= d * d))
+      {
+        x++;
+      }
+      // Line is symmetric
+      mask[y].start = x;
+      mask[y].end = d - 1 - x;
+    }
+  }
 
   // Always Ok
   return Result::RESULT_OK;
@@ -299,6 +165,36 @@ Result GC9A01::WriteDataStream(uint8_t* data, uint32_t n)
   return result;
 }
 
+// *****************************************************************************
+// ***   Public: Write same color to output window   ***************************
+// *****************************************************************************
+Result GC9A01::WriteColor(color_t color, uint32_t n)
+{
+  Result result = Result::RESULT_OK;
+  // Pattern buffer, filled only as much as needed
+  color_t buf[DISPLAY_FILL_BUF_PIXELS];
+  uint32_t buf_cnt = (n < DISPLAY_FILL_BUF_PIXELS) ? n : DISPLAY_FILL_BUF_PIXELS;
+  for(uint32_t i = 0u; i < buf_cnt; i++)
+  {
+    buf[i] = color;
+  }
+  // Data
+  display_dc.SetHigh();
+  // Pull down CS
+  display_cs.SetLow();
+  // Send pattern buffer until all pixels are sent
+  while((n != 0u) && result.IsGood())
+  {
+    uint32_t cnt = (n < buf_cnt) ? n : buf_cnt;
+    result = spi.Write((uint8_t*)buf, cnt * sizeof(color_t));
+    n -= cnt;
+  }
+  // Pull up CS
+  display_cs.SetHigh();
+  // Return result
+  return result;
+}
+
 // *****************************************************************************
 // ***   Public: Check SPI transfer status   ***********************************
 // *****************************************************************************
@@ -323,26 +219,30 @@ Result GC9A01::StopTransfer(void)
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   Public: Set callback for data stream transfer completion   ************
+// *****************************************************************************
+Result GC9A01::SetTransferCompleteCallback(ICallback* callback)
+{
+  // Data stream sent via SPI, so SPI driver reports transfer completion
+  return spi.SetTransferCompleteCallback(callback);
+}
+
 // *****************************************************************************
 // ***   Public: Set output window   *******************************************
 // *****************************************************************************
 Result GC9A01::SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
-  // Set the X coordinates
-  WriteCommand(0x2A);
-  WriteData(x0 >> 8);
-  WriteData(x0 & 0xFF);
-  WriteData(x1 >> 8);
-  WriteData(x1 & 0xFF);
-
-  // Set the Y coordinates
-  WriteCommand(0x2B);
-  WriteData(y0 >> 8);
-  WriteData(y0 & 0xFF);
-  WriteData(y1 >> 8);
-  WriteData(y1 & 0xFF);
-
-  WriteCommand(0x2C);
+  // Column and row address parameters
+  uint8_t col[4u] = {(uint8_t)(x0 >> 8), (uint8_t)x0, (uint8_t)(x1 >> 8), (uint8_t)x1};
+  uint8_t row[4u] = {(uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8), (uint8_t)y1};
+
+  // Send window setup in one CS cycle
+  display_cs.SetLow(); // Pull down CS
+  SendCommand(0x2A, col, sizeof(col)); // Column address set
+  SendCommand(0x2B, row, sizeof(row)); // Row address set
+  SendCommand(0x2C, nullptr, 0u); // Write to RAM
+  display_cs.SetHigh(); // Pull up CS
 
   // Prepare for write data
   display_dc.SetHigh(); // Data
@@ -426,21 +326,13 @@ Result GC9A01::DrawPixel(int16_t x, int16_t y, color_t color)
 Result GC9A01::DrawFastVLine(int16_t x, int16_t y, int16_t h, color_t color)
 {
   // Rudimentary clipping
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (h > 0))
   {
     if((y+h-1) >= height) h = height-y;
 
     SetAddrWindow(x, y, x, y+h-1);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    while(h--)
-    {
-      spi.Write(&clr, sizeof(clr));
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of line
+    WriteColor(color, h);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -451,21 +343,13 @@ Result GC9A01::DrawFastVLine(int16_t x, int16_t y, int16_t h, color_t color)
 // *****************************************************************************
 Result GC9A01::DrawFastHLine(int16_t x, int16_t y, int16_t w, color_t color)
 {
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (w > 0))
   {
     if((x+w-1) >= width)  w = width-x;
 
     SetAddrWindow(x, y, x+w-1, y);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    while(w--)
-    {
-      spi.Write(&clr, sizeof(clr));
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of line
+    WriteColor(color, w);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -476,25 +360,14 @@ Result GC9A01::DrawFastHLine(int16_t x, int16_t y, int16_t w, color_t color)
 // *****************************************************************************
 Result GC9A01::FillRect(int16_t x, int16_t y, int16_t w, int16_t h, color_t color)
 {
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (w > 0) && (h > 0))
   {
     if((x + w - 1) >= width)  w = width  - x;
     if((y + h - 1) >= height) h = height - y;
 
     SetAddrWindow(x, y, x+w-1, y+h-1);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    for(y = h; y > 0; y--)
-    {
-      for(x = w; x > 0; x--)
-      {
-        spi.Write(&clr, sizeof(clr));
-      }
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of rectangle
+    WriteColor(color, w * h);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -549,6 +422,58 @@ inline void GC9A01::SpiWrite(uint8_t c)
   display_cs.SetHigh(); // Pull up CS
 }
 
+// *****************************************************************************
+// ***   Private: Write command with parameters to SPI   ***********************
+// *****************************************************************************
+void GC9A01::WriteCommand(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  display_cs.SetLow(); // Pull down CS
+  SendCommand(c, data, n);
+  display_cs.SetHigh(); // Pull up CS
+}
+
+// *****************************************************************************
+// ***   Private: Write list of commands to SPI   ******************************
+// *****************************************************************************
+void GC9A01::WriteCommandList(const uint8_t* list, uint32_t size)
+{
+  // Index of current command in list
+  uint32_t idx = 0u;
+  // Send all commands from list
+  while(idx + 1u < size)
+  {
+    // Get command and number of parameters
+    uint8_t c = list[idx];
+    uint8_t n = list[idx + 1u] & ~CMD_LIST_DELAY;
+    bool need_delay = (list[idx + 1u] & CMD_LIST_DELAY) != 0u;
+    idx += 2u;
+    // Send command with all parameters in one CS cycle
+    WriteCommand(c, &list[idx], n);
+    idx += n;
+    // Wait for execute command if needed
+    if(need_delay)
+    {
+      Delay(list[idx]);
+      idx++;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Send command with parameters   *******************************
+// *****************************************************************************
+inline void GC9A01::SendCommand(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  display_dc.SetLow(); // Command
+  spi.Write(&c, sizeof(c));
+  // All parameters sent in one transfer
+  if(n != 0u)
+  {
+    display_dc.SetHigh(); // Data
+    spi.Write((uint8_t*)data, n);
+  }
+}
+
 // *****************************************************************************
 // ***   Private: Send read command ad read result   ***************************
 // *****************************************************************************
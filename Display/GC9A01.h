@@ -82,6 +82,11 @@ class GC9A01 : public IDisplay
     // *************************************************************************
     virtual Result WriteDataStream(uint8_t* data, uint32_t n);
 
+    // *************************************************************************
+    // ***   Public: Write same color to output window   ***********************
+    // *************************************************************************
+    virtual Result WriteColor(color_t color, uint32_t n);
+
     // *************************************************************************
     // ***   Public: Check SPI transfer status  ********************************
     // *************************************************************************
@@ -92,6 +97,11 @@ class GC9A01 : public IDisplay
     // *************************************************************************
     virtual Result StopTransfer(void);
 
+    // *************************************************************************
+    // ***   Public: Set callback for data stream transfer completion   ********
+    // *************************************************************************
+    virtual Result SetTransferCompleteCallback(ICallback* callback);
+
     // *************************************************************************
     // ***   Public: Set output window   ***************************************
     // *************************************************************************
@@ -132,7 +142,20 @@ class GC9A01 : public IDisplay
     // *************************************************************************
     virtual Result InvertDisplay(bool invert);
 
+    // *************************************************************************
+    // ***   Public: Get visibility mask   *************************************
+    // *************************************************************************
+    // * Mask is calculated at Init() for round panel(width equal to height).
+    virtual const Span* GetVisibleMask(void) {return is_mask_valid ? mask : nullptr;}
+
   private:
+    // Max number of lines in visibility mask
+    static const int32_t MASK_LINES = 240;
+    // Visible span of each line
+    Span mask[MASK_LINES];
+    // Mask calculated
+    bool is_mask_valid = false;
+
     // Handle to SPI used for display
     ISpi& spi;
     // Reference to CS and DC - mandatory
@@ -161,6 +184,26 @@ class GC9A01 : public IDisplay
     // *************************************************************************
     inline void SpiWrite(uint8_t c);
 
+    // *************************************************************************
+    // ***   Private: Write command with parameters to SPI   *******************
+    // *************************************************************************
+    void WriteCommand(uint8_t c, const uint8_t* data, uint32_t n);
+
+    // *************************************************************************
+    // ***   Private: Write list of commands to SPI   **************************
+    // *************************************************************************
+    // * List entry: command, number of parameters, parameters. If
+    // * CMD_LIST_DELAY bit is set in number of parameters, delay in ms
+    // * follows parameters.
+    void WriteCommandList(const uint8_t* list, uint32_t size);
+
+    // *************************************************************************
+    // ***   Private: Send command with parameters   ***************************
+    // *************************************************************************
+    // * DC line switched between command and parameters, CS line should be
+    // * pulled down by caller.
+    inline void SendCommand(uint8_t c, const uint8_t* data, uint32_t n);
+
     // *************************************************************************
     // ***   Private: Send read command ad read result   ***********************
     // *************************************************************************
@@ -0,0 +1,134 @@
+// *****************************************************************************
+// @file GlyphCache.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Glyph Line Cache, implementation
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "GlyphCache.h"
+
+// *****************************************************************************
+// ***   Public: Find line of character   **************************************
+// *****************************************************************************
+const color_t* GlyphCache::Find(uint8_t ch, uint8_t line, uint8_t scale, color_t color, color_t bg_color)
+{
+  const color_t* result = nullptr;
+  // Look in the set for given key
+  Entry* set = GetSet(ch, line, scale, color, bg_color);
+  for(uint32_t i = 0u; i < WAYS; i++)
+  {
+    Entry& e = set[i];
+    if((e.ch == ch) && (e.line == line) && (e.scale == scale) && (e.color == color) && (e.bg_color == bg_color))
+    {
+      e.stamp = ++stamp;
+      result = e.pixels;
+      break;
+    }
+  }
+  // Update statistics
+  if(result != nullptr) hits++;
+  else                  misses++;
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Add line of character   ***************************************
+// *****************************************************************************
+color_t* GlyphCache::Add(uint8_t ch, uint8_t line, uint8_t scale, color_t color, color_t bg_color)
+{
+  // Find least recently used entry of the set, empty entries have zero stamp
+  Entry* set = GetSet(ch, line, scale, color, bg_color);
+  Entry* e = &set[0u];
+  for(uint32_t i = 1u; i < WAYS; i++)
+  {
+    if((uint32_t)(stamp - set[i].stamp) > (uint32_t)(stamp - e->stamp)) e = &set[i];
+  }
+  // Replace it
+  e->stamp = ++stamp;
+  e->color = color;
+  e->bg_color = bg_color;
+  e->ch = ch;
+  e->line = line;
+  e->scale = scale;
+  // Return pixels to fill
+  return e->pixels;
+}
+
+// *****************************************************************************
+// ***   Public: Check if cache can be used by current task   ******************
+// *****************************************************************************
+bool GlyphCache::IsOwnerTask(void)
+{
+  TaskHandle_t task = Rtos::GetCurrentTaskHandle();
+  // Claim the cache if it has no owner yet
+  if(owner == nullptr)
+  {
+    Rtos::EnterCriticalSection();
+    if(owner == nullptr) owner = task;
+    Rtos::ExitCriticalSection();
+  }
+  // Return result
+  return (owner == task);
+}
+
+// *****************************************************************************
+// ***   Public: Clear cache   *************************************************
+// *****************************************************************************
+void GlyphCache::Clear(void)
+{
+  for(uint32_t i = 0u; i < sets_cnt * WAYS; i++)
+  {
+    entries_ptr[i].stamp = 0u;
+    entries_ptr[i].scale = 0u;
+  }
+  stamp = 0u;
+}
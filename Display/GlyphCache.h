@@ -0,0 +1,193 @@
+// *****************************************************************************
+// @file GlyphCache.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Glyph Line Cache, header
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+
+#ifndef GlyphCache_h
+#define GlyphCache_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+
+// *****************************************************************************
+// ***   GlyphCache   **********************************************************
+// *****************************************************************************
+// * Keeps lines of characters expanded to color_t pixels, so text with opaque
+// * background is copied instead of decoded from font bits. Key is character,
+// * line, scale, text and background colors. Cache is set associative: key
+// * hash selects set of WAYS entries and least recently used entry of the set
+// * is replaced. Cache isn't thread safe: first task that uses it becomes its
+// * owner and other tasks(for example second DisplayDrv) draw without cache.
+class GlyphCache
+{
+  public:
+    // Entries in one set
+    static const uint32_t WAYS = 4u;
+
+    // *************************************************************************
+    // ***   Cache entry   *****************************************************
+    // *************************************************************************
+    struct Entry
+    {
+      // Last use stamp
+      uint32_t stamp = 0u;
+      // Text and background colors
+      color_t color = 0u;
+      color_t bg_color = 0u;
+      // Character and line
+      uint8_t ch = 0u;
+      uint8_t line = 0u;
+      // Scale, zero - entry is empty
+      uint8_t scale = 0u;
+      // Pixels of character line
+      color_t pixels[FONT_CACHE_LINE_PIXELS];
+    };
+
+    // *************************************************************************
+    // ***   Public: Constructor   *********************************************
+    // *************************************************************************
+    // * Number of entries n should be multiple of WAYS.
+    explicit GlyphCache(Entry* entries, uint32_t n) : entries_ptr(entries), sets_cnt(n / WAYS) {};
+
+    // *************************************************************************
+    // ***   Public: Find line of character   **********************************
+    // *************************************************************************
+    // * Returns pixels of cached line or nullptr if line isn't cached.
+    const color_t* Find(uint8_t ch, uint8_t line, uint8_t scale, color_t color, color_t bg_color);
+
+    // *************************************************************************
+    // ***   Public: Add line of character   ***********************************
+    // *************************************************************************
+    // * Replaces least recently used entry of the set and returns its pixels
+    // * to be filled by caller.
+    color_t* Add(uint8_t ch, uint8_t line, uint8_t scale, color_t color, color_t bg_color);
+
+    // *************************************************************************
+    // ***   Public: Clear cache   *********************************************
+    // *************************************************************************
+    void Clear(void);
+
+    // *************************************************************************
+    // ***   Public: Check if cache can be used by current task   **************
+    // *************************************************************************
+    // * First task that calls it becomes owner of the cache. Returns true only
+    // * for owner task.
+    bool IsOwnerTask(void);
+
+    // *************************************************************************
+    // ***   Public: Get number of hits   **************************************
+    // *************************************************************************
+    uint32_t GetHits(void) {return hits;}
+
+    // *************************************************************************
+    // ***   Public: Get number of misses   ************************************
+    // *************************************************************************
+    uint32_t GetMisses(void) {return misses;}
+
+    // *************************************************************************
+    // ***   Public: Get hit rate in percent   *********************************
+    // *************************************************************************
+    uint32_t GetHitRate(void) {return ((hits + misses) == 0u) ? 0u : (uint32_t)((uint64_t)hits * 100u / (hits + misses));}
+
+    // *************************************************************************
+    // ***   Public: Clear hits and misses counters   **************************
+    // *************************************************************************
+    void ClearStats(void) {hits = 0u; misses = 0u;}
+
+  private:
+    // Pointer to entries
+    Entry* entries_ptr = nullptr;
+    // Number of sets
+    uint32_t sets_cnt = 0u;
+    // Task that owns the cache
+    TaskHandle_t owner = nullptr;
+    // Use stamp, incremented on every hit or add
+    uint32_t stamp = 0u;
+    // Statistics
+    uint32_t hits = 0u;
+    uint32_t misses = 0u;
+
+    // *************************************************************************
+    // ***   Private: Get first entry of set for key   *************************
+    // *************************************************************************
+    inline Entry* GetSet(uint8_t ch, uint8_t line, uint8_t scale, color_t color, color_t bg_color)
+    {
+      // Multiplicative hash spreads lines of the same characters over sets
+      uint32_t key = ((uint32_t)ch << 8u) ^ line ^ ((uint32_t)scale << 16u) ^ ((uint32_t)color * 0x9E3779B1u) ^ (uint32_t)bg_color;
+      return &entries_ptr[(((key * 0x9E3779B1u) >> 16u) % sets_cnt) * WAYS];
+    }
+
+    // *************************************************************************
+    // ***   Private: Constructors and assign operator - prevent copying   *****
+    // *************************************************************************
+    GlyphCache(const GlyphCache&);
+};
+
+// *****************************************************************************
+// ***   GlyphCache with storage   *********************************************
+// *****************************************************************************
+template <uint32_t N> class GlyphCacheBuf : public GlyphCache
+{
+  static_assert((N != 0u) && ((N % GlyphCache::WAYS) == 0u), "Number of glyph cache entries should be multiple of GlyphCache::WAYS");
+
+  public:
+    // *************************************************************************
+    // ***   Public: Constructor   *********************************************
+    // *************************************************************************
+    GlyphCacheBuf() : GlyphCache(entries, N) {};
+
+  private:
+    // Entries storage
+    GlyphCache::Entry entries[N];
+};
+
+#endif
@@ -111,155 +111,104 @@
 #define MADCTL_RGB 0x00 // RGB Order (No BGR bit)
 #define MADCTL_MH  0x04 // Horizontal Refresh ORDER
 
+// Command list: if this bit is set in number of parameters, delay in ms follows
+// command parameters
+#define CMD_LIST_DELAY 0x80
+
 // *****************************************************************************
-// ***   Public: Init screen   *************************************************
+// ***   Init sequence   *******************************************************
 // *****************************************************************************
-Result ILI9341::Init(void)
+static const uint8_t init_cmd_list[] =
 {
-  // Reset sequence. Used only if GPIO pin used as LCD reset.
-  if(display_rst != nullptr)
-  {
-    display_rst->SetHigh(); // Pull up reset line
-    Delay(5u);              // Wait for 5 ms
-    display_rst->SetLow();  // Pull down reset line
-    Delay(20u);             // Wait for 20 ms
-    display_rst->SetHigh(); // Pull up reset line
-    Delay(150u);            // Wait for 150 ms
-  }
-
   // Reset display
-  WriteCommand(CMD_SWRESET);
-  // Delay for execute previous command
-  Delay(100u);
+  CMD_SWRESET, CMD_LIST_DELAY, 100u, // Delay for execute previous command
 
   // Power control 1
-  WriteCommand(CMD_PWCTR1);
-  WriteData(0x23); // VRH[5:0] // 25
+  CMD_PWCTR1, 1u, 0x23, // VRH[5:0] // 25
 
   // Power control 2
-  WriteCommand(CMD_PWCTR2);
-  WriteData(0x10); // SAP[2:0]; BT[3:0] // 11
+  CMD_PWCTR2, 1u, 0x10, // SAP[2:0]; BT[3:0] // 11
 
   // VCM control 1
-  WriteCommand(CMD_VMCTR1);
-  WriteData(0x2B);
-  WriteData(0x2B);
+  CMD_VMCTR1, 2u, 0x2B, 0x2B,
 
   // VCM control 2
-  WriteCommand(CMD_VMCTR2);
-  WriteData(0xC0);
+  CMD_VMCTR2, 1u, 0xC0,
 
   // Pixel Format Set
-  WriteCommand(CMD_PIXFMT);
-  WriteData(0x55);
+  CMD_PIXFMT, 1u, 0x55,
 
   // Frame Control (In Normal Mode)
-  WriteCommand(CMD_FRMCTR1);
-  WriteData(0x00);
-  WriteData(0x18);
+  CMD_FRMCTR1, 2u, 0x00, 0x18,
 
   // Power control A
-  WriteCommand(CMD_PWCTRA);
-  WriteData(0x39);
-  WriteData(0x2C);
-  WriteData(0x00);
-  WriteData(0x34);
-  WriteData(0x02);
+  CMD_PWCTRA, 5u, 0x39, 0x2C, 0x00, 0x34, 0x02,
 
   // Power control B
-  WriteCommand(CMD_PWCTRB);
-  WriteData(0x00);
-  WriteData(0XC1);
-  WriteData(0X30);
+  CMD_PWCTRB, 3u, 0x00, 0xC1, 0x30,
 
   // Power on sequence control
-  WriteCommand(CMD_PWONSC);
-  WriteData(0x64);
-  WriteData(0x03);
-  WriteData(0X12);
-  WriteData(0X81);
+  CMD_PWONSC, 4u, 0x64, 0x03, 0x12, 0x81,
 
   // Driver timing control A
-  WriteCommand(CMD_DRVTMCA);
-  WriteData(0x85);
-  WriteData(0x00);
-  WriteData(0x78);
+  CMD_DRVTMCA, 3u, 0x85, 0x00, 0x78,
 
   // Driver timing control B
-  WriteCommand(CMD_DRVTMCB);
-  WriteData(0x00);
-  WriteData(0x00);
+  CMD_DRVTMCB, 2u, 0x00, 0x00,
 
   // Pump ratio control
-  WriteCommand(CMD_PUMPRC);
-  WriteData(0x20);
+  CMD_PUMPRC, 1u, 0x20,
 
   // Memory Access Control
-  WriteCommand(CMD_MADCTL);
-  WriteData(0x48);
+  CMD_MADCTL, 1u, 0x48,
 
   // Display Function Control
-  WriteCommand(CMD_DFUNCTR);
-  WriteData(0x08);
-  WriteData(0x82);
-  WriteData(0x27);
+  CMD_DFUNCTR, 3u, 0x08, 0x82, 0x27,
 
   // Enable 3 gamma control - Disable 3 Gamma Function
-  WriteCommand(CMD_EN3G);
-  WriteData(0x00);
+  CMD_EN3G, 1u, 0x00,
 
   // Gamma Set - Gamma curve selected
-  WriteCommand(CMD_GAMMASET);
-  WriteData(0x01);
+  CMD_GAMMASET, 1u, 0x01,
 
   // Positive Gamma Correction
-  WriteCommand(CMD_GMCTRP1);
-  WriteData(0x0F);
-  WriteData(0x31);
-  WriteData(0x2B);
-  WriteData(0x0C);
-  WriteData(0x0E);
-  WriteData(0x08);
-  WriteData(0x4E);
-  WriteData(0xF1);
-  WriteData(0x37);
-  WriteData(0x07);
-  WriteData(0x10);
-  WriteData(0x03);
-  WriteData(0x0E);
-  WriteData(0x09);
-  WriteData(0x00);
+  CMD_GMCTRP1, 15u,
+    0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1,
+    0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
 
   // Negative Gamma Correction
-  WriteCommand(CMD_GMCTRN1);
-  WriteData(0x00);
-  WriteData(0x0E);
-  WriteData(0x14);
-  WriteData(0x03);
-  WriteData(0x11);
-  WriteData(0x07);
-  WriteData(0x31);
-  WriteData(0xC1);
-  WriteData(0x48);
-  WriteData(0x08);
-  WriteData(0x0F);
-  WriteData(0x0C);
-  WriteData(0x31);
-  WriteData(0x36);
-  WriteData(0x0F);
+  CMD_GMCTRN1, 15u,
+    0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1,
+    0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
 
   // Interface Control
-  WriteCommand(CMD_INTCTRL);
-  WriteData(0x01);
-  WriteData(0x00);
-  WriteData(0x01 << 5);
+  CMD_INTCTRL, 3u, 0x01, 0x00, 0x01 << 5,
 
   // Exit Sleep
-  WriteCommand(CMD_SLPOUT);
-  // Delay for execute previous command
-  Delay(120u);
+  CMD_SLPOUT, CMD_LIST_DELAY, 120u, // Delay for execute previous command
+
   // Display on
-  WriteCommand(CMD_DISPON);
+  CMD_DISPON, 0u,
+};
+
+// *****************************************************************************
+// ***   Public: Init screen   *************************************************
+// *****************************************************************************
+Result ILI9341::Init(void)
+{
+  // Reset sequence. Used only if GPIO pin used as LCD reset.
+  if(display_rst != nullptr)
+  {
+    display_rst->SetHigh(); // Pull up reset line
+    Delay(5u);              // Wait for 5 ms
+    display_rst->SetLow();  // Pull down reset line
+    Delay(20u);             // Wait for 20 ms
+    display_rst->SetHigh(); // Pull up reset line
+    Delay(150u);            // Wait for 150 ms
+  }
+
+  // Send init sequence
+  WriteCommandList(init_cmd_list, sizeof(init_cmd_list));
 
   // Always Ok
   return Result::RESULT_OK;
@@ -280,6 +229,36 @@ Result ILI9341::WriteDataStream(uint8_t* data, uint32_t n)
   return result;
 }
 
+// *****************************************************************************
+// ***   Public: Write same color to output window   ***************************
+// *****************************************************************************
+Result ILI9341::WriteColor(color_t color, uint32_t n)
+{
+  Result result = Result::RESULT_OK;
+  // Pattern buffer, filled only as much as needed
+  color_t buf[DISPLAY_FILL_BUF_PIXELS];
+  uint32_t buf_cnt = (n < DISPLAY_FILL_BUF_PIXELS) ? n : DISPLAY_FILL_BUF_PIXELS;
+  for(uint32_t i = 0u; i < buf_cnt; i++)
+  {
+    buf[i] = color;
+  }
+  // Data
+  display_dc.SetHigh();
+  // Pull down CS
+  display_cs.SetLow();
+  // Send pattern buffer until all pixels are sent
+  while((n != 0u) && result.IsGood())
+  {
+    uint32_t cnt = (n < buf_cnt) ? n : buf_cnt;
+    result = spi.Write((uint8_t*)buf, cnt * sizeof(color_t));
+    n -= cnt;
+  }
+  // Pull up CS
+  display_cs.SetHigh();
+  // Return result
+  return result;
+}
+
 // *****************************************************************************
 // ***   Public: Check SPI transfer status   ***********************************
 // *****************************************************************************
@@ -304,24 +283,30 @@ Result ILI9341::StopTransfer(void)
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   Public: Set callback for data stream transfer completion   ************
+// *****************************************************************************
+Result ILI9341::SetTransferCompleteCallback(ICallback* callback)
+{
+  // Data stream sent via SPI, so SPI driver reports transfer completion
+  return spi.SetTransferCompleteCallback(callback);
+}
+
 // *****************************************************************************
 // ***   Public: Set output window   *******************************************
 // *****************************************************************************
 Result ILI9341::SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
-  WriteCommand(CMD_CASET); // Column address set
-  WriteData(x0 >> 8);
-  WriteData(x0 & 0xFF); // XSTART 
-  WriteData(x1 >> 8);
-  WriteData(x1 & 0xFF); // XEND
+  // Column and row address parameters
+  uint8_t col[4u] = {(uint8_t)(x0 >> 8), (uint8_t)x0, (uint8_t)(x1 >> 8), (uint8_t)x1};
+  uint8_t row[4u] = {(uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8), (uint8_t)y1};
 
-  WriteCommand(CMD_PASET); // Row address set
-  WriteData(y0 >> 8);
-  WriteData(y0);        // YSTART
-  WriteData(y1 >> 8);
-  WriteData(y1);        // YEND
-
-  WriteCommand(CMD_RAMWR); // write to RAM
+  // Send window setup in one CS cycle
+  display_cs.SetLow(); // Pull down CS
+  SendCommand(CMD_CASET, col, sizeof(col)); // Column address set
+  SendCommand(CMD_PASET, row, sizeof(row)); // Row address set
+  SendCommand(CMD_RAMWR, nullptr, 0u); // Write to RAM
+  display_cs.SetHigh(); // Pull up CS
 
   // Prepare for write data
   display_dc.SetHigh(); // Data
@@ -335,39 +320,47 @@ Result ILI9341::SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1
 // *****************************************************************************
 Result ILI9341::SetRotation(IDisplay::Rotation r)
 {
+  // Result
+  Result result = Result::RESULT_OK;
+
   rotation = r;
-  WriteCommand(CMD_MADCTL);
   switch (rotation)
   {
     case IDisplay::ROTATION_BOTTOM:
-      WriteData(MADCTL_MV | MADCTL_BGR);
+      madctl = MADCTL_MV | MADCTL_BGR;
       width  = init_width;
       height = init_height;
       break;
 
     case IDisplay::ROTATION_RIGHT:
-      WriteData(MADCTL_MX | MADCTL_BGR);
+      madctl = MADCTL_MX | MADCTL_BGR;
       width  = init_height;
       height = init_width;
       break;
 
     case IDisplay::ROTATION_LEFT: // Y: up -> down
-      WriteData(MADCTL_MY | MADCTL_BGR);
+      madctl = MADCTL_MY | MADCTL_BGR;
       width  = init_height;
       height = init_width;
       break;
 
     case IDisplay::ROTATION_TOP: // X: left -> right
-      WriteData(MADCTL_MX | MADCTL_MY | MADCTL_MV | MADCTL_BGR);
+      madctl = MADCTL_MX | MADCTL_MY | MADCTL_MV | MADCTL_BGR;
       width  = init_width;
       height = init_height;
       break;
 
     default:
+      result = Result::ERR_BAD_PARAMETER;
       break;
   }
-  // Always Ok
-  return Result::RESULT_OK;
+  // Set Memory Access Control register
+  if(result.IsGood())
+  {
+    WriteCommand(CMD_MADCTL, &madctl, sizeof(madctl));
+  }
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -405,21 +398,13 @@ Result ILI9341::DrawPixel(int16_t x, int16_t y, color_t color)
 Result ILI9341::DrawFastVLine(int16_t x, int16_t y, int16_t h, color_t color)
 {
   // Rudimentary clipping
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (h > 0))
   {
     if((y+h-1) >= height) h = height-y;
 
     SetAddrWindow(x, y, x, y+h-1);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    while(h--)
-    {
-      spi.Write(&clr, sizeof(clr));
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of line
+    WriteColor(color, h);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -430,21 +415,13 @@ Result ILI9341::DrawFastVLine(int16_t x, int16_t y, int16_t h, color_t color)
 // *****************************************************************************
 Result ILI9341::DrawFastHLine(int16_t x, int16_t y, int16_t w, color_t color)
 {
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (w > 0))
   {
     if((x+w-1) >= width)  w = width-x;
 
     SetAddrWindow(x, y, x+w-1, y);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    while(w--)
-    {
-      spi.Write(&clr, sizeof(clr));
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of line
+    WriteColor(color, w);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -455,25 +432,14 @@ Result ILI9341::DrawFastHLine(int16_t x, int16_t y, int16_t w, color_t color)
 // *****************************************************************************
 Result ILI9341::FillRect(int16_t x, int16_t y, int16_t w, int16_t h, color_t color)
 {
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (w > 0) && (h > 0))
   {
     if((x + w - 1) >= width)  w = width  - x;
     if((y + h - 1) >= height) h = height - y;
 
     SetAddrWindow(x, y, x+w-1, y+h-1);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    for(y = h; y > 0; y--)
-    {
-      for(x = w; x > 0; x--)
-      {
-        spi.Write(&clr, sizeof(clr));
-      }
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of rectangle
+    WriteColor(color, w * h);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -489,6 +455,73 @@ Result ILI9341::InvertDisplay(bool invert)
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   Public: Set vertical scroll area   ************************************
+// *****************************************************************************
+Result ILI9341::SetScrollArea(uint16_t start, uint16_t end)
+{
+  // Result
+  Result result = Result::ERR_BAD_PARAMETER;
+
+  // Display scrolls memory lines. If rows and columns exchanged, those lines
+  // are columns on the screen.
+  uint16_t len = (madctl & MADCTL_MV) ? width : height;
+  if((start <= end) && (end < len))
+  {
+    // Screen lines to display memory lines
+    uint16_t first = start;
+    uint16_t last = end;
+    // If row address order is reversed, screen area is reversed in memory
+    scroll_start = (madctl & MADCTL_MY) ? (GATE_LINES - 1u - last) : first;
+    scroll_size = last - first + 1u;
+    uint16_t bottom = GATE_LINES - scroll_start - scroll_size;
+    // Top fixed area, vertical scrolling area and bottom fixed area
+    uint8_t data[6u] = {(uint8_t)(scroll_start >> 8), (uint8_t)scroll_start,
+                        (uint8_t)(scroll_size >> 8),  (uint8_t)scroll_size,
+                        (uint8_t)(bottom >> 8),       (uint8_t)bottom};
+    WriteCommand(CMD_VSCRDEF, data, sizeof(data));
+    // Start without offset
+    result = SetScrollOffset(0u);
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Set vertical scroll offset   **********************************
+// *****************************************************************************
+Result ILI9341::SetScrollOffset(uint16_t offset)
+{
+  // Result
+  Result result = Result::ERR_BAD_PARAMETER;
+
+  // Offset should be inside scroll area
+  if(offset < scroll_size)
+  {
+    // If row address order is reversed, content moves in opposite direction
+    if((madctl & MADCTL_MY) && (offset != 0u))
+    {
+      offset = scroll_size - offset;
+    }
+    // Memory line shown at the start of scroll area
+    uint16_t line = scroll_start + offset;
+    uint8_t data[2u] = {(uint8_t)(line >> 8), (uint8_t)line};
+    WriteCommand(CMD_VSAADDR, data, sizeof(data));
+    // Set result
+    result = Result::RESULT_OK;
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Check if display scrolls along X axis   ***********************
+// *****************************************************************************
+bool ILI9341::IsScrollAlongX(void)
+{
+  return ((madctl & MADCTL_MV) != 0u);
+}
+
 // *****************************************************************************
 // ***   Private: Delay in ms    ***********************************************
 // *****************************************************************************
@@ -528,6 +561,58 @@ inline void ILI9341::SpiWrite(uint8_t c)
   display_cs.SetHigh(); // Pull up CS
 }
 
+// *****************************************************************************
+// ***   Private: Write command with parameters to SPI   ***********************
+// *****************************************************************************
+void ILI9341::WriteCommand(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  display_cs.SetLow(); // Pull down CS
+  SendCommand(c, data, n);
+  display_cs.SetHigh(); // Pull up CS
+}
+
+// *****************************************************************************
+// ***   Private: Write list of commands to SPI   ******************************
+// *****************************************************************************
+void ILI9341::WriteCommandList(const uint8_t* list, uint32_t size)
+{
+  // Index of current command in list
+  uint32_t idx = 0u;
+  // Send all commands from list
+  while(idx + 1u < size)
+  {
+    // Get command and number of parameters
+    uint8_t c = list[idx];
+    uint8_t n = list[idx + 1u] & ~CMD_LIST_DELAY;
+    bool need_delay = (list[idx + 1u] & CMD_LIST_DELAY) != 0u;
+    idx += 2u;
+    // Send command with all parameters in one CS cycle
+    WriteCommand(c, &list[idx], n);
+    idx += n;
+    // Wait for execute command if needed
+    if(need_delay)
+    {
+      Delay(list[idx]);
+      idx++;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Send command with parameters   *******************************
+// *****************************************************************************
+inline void ILI9341::SendCommand(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  display_dc.SetLow(); // Command
+  spi.Write(&c, sizeof(c));
+  // All parameters sent in one transfer
+  if(n != 0u)
+  {
+    display_dc.SetHigh(); // Data
+    spi.Write((uint8_t*)data, n);
+  }
+}
+
 // *****************************************************************************
 // ***   Private: Send read command ad read result   ***************************
 // *****************************************************************************
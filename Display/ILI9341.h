@@ -82,6 +82,11 @@ class ILI9341 : public IDisplay
     // *************************************************************************
     virtual Result WriteDataStream(uint8_t* data, uint32_t n);
 
+    // *************************************************************************
+    // ***   Public: Write same color to output window   ***********************
+    // *************************************************************************
+    virtual Result WriteColor(color_t color, uint32_t n);
+
     // *************************************************************************
     // ***   Public: Check SPI transfer status  ********************************
     // *************************************************************************
@@ -92,6 +97,11 @@ class ILI9341 : public IDisplay
     // *************************************************************************
     virtual Result StopTransfer(void);
 
+    // *************************************************************************
+    // ***   Public: Set callback for data stream transfer completion   ********
+    // *************************************************************************
+    virtual Result SetTransferCompleteCallback(ICallback* callback);
+
     // *************************************************************************
     // ***   Public: Set output window   ***************************************
     // *************************************************************************
@@ -132,7 +142,31 @@ class ILI9341 : public IDisplay
     // *************************************************************************
     virtual Result InvertDisplay(bool invert);
 
+    // *************************************************************************
+    // ***   Public: Set vertical scroll area   ********************************
+    // *************************************************************************
+    virtual Result SetScrollArea(uint16_t start, uint16_t end);
+
+    // *************************************************************************
+    // ***   Public: Set vertical scroll offset   ******************************
+    // *************************************************************************
+    virtual Result SetScrollOffset(uint16_t offset);
+
+    // *************************************************************************
+    // ***   Public: Check if display scrolls along X axis   *******************
+    // *************************************************************************
+    virtual bool IsScrollAlongX(void);
+
   private:
+    // Number of display memory lines scanned by panel(gate lines)
+    static const uint16_t GATE_LINES = 320u;
+
+    // Memory Access Control register value for current rotation
+    uint8_t madctl = 0u;
+    // Scroll area start and size in display memory lines
+    uint16_t scroll_start = 0u;
+    uint16_t scroll_size = 0u;
+
     // Handle to SPI used for display
     ISpi& spi;
     // Reference to CS and DC - mandatory
@@ -161,6 +195,26 @@ class ILI9341 : public IDisplay
     // *************************************************************************
     inline void SpiWrite(uint8_t c);
 
+    // *************************************************************************
+    // ***   Private: Write command with parameters to SPI   *******************
+    // *************************************************************************
+    void WriteCommand(uint8_t c, const uint8_t* data, uint32_t n);
+
+    // *************************************************************************
+    // ***   Private: Write list of commands to SPI   **************************
+    // *************************************************************************
+    // * List entry: command, number of parameters, parameters. If
+    // * CMD_LIST_DELAY bit is set in number of parameters, delay in ms
+    // * follows parameters.
+    void WriteCommandList(const uint8_t* list, uint32_t size);
+
+    // *************************************************************************
+    // ***   Private: Send command with parameters   ***************************
+    // *************************************************************************
+    // * DC line switched between command and parameters, CS line should be
+    // * pulled down by caller.
+    inline void SendCommand(uint8_t c, const uint8_t* data, uint32_t n);
+
     // *************************************************************************
     // ***   Private: Send read command ad read result   ***********************
     // *************************************************************************
@@ -19,6 +19,7 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "ILI9488.h"
+#include "PixelConvert.h"
 
 // *****************************************************************************
 // ***   Defines   *************************************************************
@@ -116,123 +117,96 @@
 #define MADCTL_RGB 0x00 // RGB Order (No BGR bit)
 #define MADCTL_MH  0x04 // Horizontal Refresh ORDER
 
+// Command list: if this bit is set in number of parameters, delay in ms follows
+// command parameters
+#define CMD_LIST_DELAY 0x80
+
 // *****************************************************************************
-// ***   Public: Init screen   *************************************************
+// ***   Init sequence   *******************************************************
 // *****************************************************************************
-Result ILI9488::Init(void)
+static const uint8_t init_cmd_list[] =
 {
-  // Reset sequence. Used only if GPIO pin used as LCD reset.
-  if(display_rst != nullptr)
-  {
-    display_rst->SetHigh(); // Pull up reset line
-    Delay(5u);              // Wait for 5 ms
-    display_rst->SetLow();  // Pull down reset line
-    Delay(20u);             // Wait for 20 ms
-    display_rst->SetHigh(); // Pull up reset line
-    Delay(150u);            // Wait for 150 ms
-  }
-
   // Reset display
-  WriteCommand(CMD_SWRESET);
-  // Delay for execute previous command
-  Delay(100u);
+  CMD_SWRESET, CMD_LIST_DELAY, 100u, // Delay for execute previous command
 
   // Power control 1
-  WriteCommand(CMD_PWCTR1);
-  WriteData(0x17); // Vreg1out
-  WriteData(0x15); // Verg2out
+  CMD_PWCTR1, 2u,
+    0x17, // Vreg1out
+    0x15, // Verg2out
 
   // Power control 2
-  WriteCommand(CMD_PWCTR2);
-  WriteData(0x41); // VGH,VGL
+  CMD_PWCTR2, 1u, 0x41, // VGH,VGL
 
   // VCM control 1
-  WriteCommand(CMD_VMCTR1);
-  WriteData(0x00);
-  WriteData(0x12); // Vcom
-  WriteData(0x80);
+  CMD_VMCTR1, 3u,
+    0x00,
+    0x12, // Vcom
+    0x80,
 
   // Interface Pixel Format
-  WriteCommand(CMD_PIXFMT);
 #if defined(COLOR_3BIT)
-  WriteData(0x11); // 0x11 - 3 bit
+  CMD_PIXFMT, 1u, 0x11, // 0x11 - 3 bit
 #else
-  WriteData(0x66); // 0x66 - 18 bit, 0x55 - 16 bit(DOESN'T WORK!), 0x11 - 3 bit
+  CMD_PIXFMT, 1u, 0x66, // 0x66 - 18 bit, 0x55 - 16 bit(DOESN'T WORK!), 0x11 - 3 bit
 #endif
 
   // Frame Control (In Normal Mode)
-  WriteCommand(CMD_FRMCTR1);
-  WriteData(0xA0); // Frame rate 60Hz
+  CMD_FRMCTR1, 1u, 0xA0, // Frame rate 60Hz
 
   // Adjust control 3: data from datasheet
-  WriteCommand(CMD_ADJCTRL3);
-  WriteData(0xA9);
-  WriteData(0x51);
-  WriteData(0x2C);
-  WriteData(0x82);
+  CMD_ADJCTRL3, 4u, 0xA9, 0x51, 0x2C, 0x82,
 
   // Memory Access Control
-  WriteCommand(CMD_MADCTL);
-  WriteData(MADCTL_MV | MADCTL_BGR);
+  CMD_MADCTL, 1u, MADCTL_MV | MADCTL_BGR,
 
   // Positive Gamma Correction
-  WriteCommand(CMD_GMCTRP1);
-  WriteData(0x00);
-  WriteData(0x03);
-  WriteData(0x09);
-  WriteData(0x08);
-  WriteData(0x16);
-  WriteData(0x0A);
-  WriteData(0x3F);
-  WriteData(0x78);
-  WriteData(0x4C);
-  WriteData(0x09);
-  WriteData(0x0A);
-  WriteData(0x08);
-  WriteData(0x16);
-  WriteData(0x1A);
-  WriteData(0x0F);
+  CMD_GMCTRP1, 15u,
+    0x00, 0x03, 0x09, 0x08, 0x16, 0x0A, 0x3F, 0x78,
+    0x4C, 0x09, 0x0A, 0x08, 0x16, 0x1A, 0x0F,
 
   // Negative Gamma Correction
-  WriteCommand(CMD_GMCTRN1);
-  WriteData(0x00);
-  WriteData(0x16);
-  WriteData(0x19);
-  WriteData(0x03);
-  WriteData(0x0F);
-  WriteData(0x05);
-  WriteData(0x32);
-  WriteData(0x45);
-  WriteData(0x46);
-  WriteData(0x04);
-  WriteData(0x0E);
-  WriteData(0x0D);
-  WriteData(0x35);
-  WriteData(0x37);
-  WriteData(0x0F);
+  CMD_GMCTRN1, 15u,
+    0x00, 0x16, 0x19, 0x03, 0x0F, 0x05, 0x32, 0x45,
+    0x46, 0x04, 0x0E, 0x0D, 0x35, 0x37, 0x0F,
 
   // Interface Mode Control
-  WriteCommand(CMD_RGBISC);
-  WriteData(0x80); // SDO NOT USE
+  CMD_RGBISC, 1u, 0x80, // SDO NOT USE
 
   // Display Inversion Control
-  WriteCommand(CMD_INVCTR);
-  WriteData(0x02); // 2-dot
+  CMD_INVCTR, 1u, 0x02, // 2-dot
 
   // Display Function Control RGB/MCU Interface Control
-  WriteCommand(CMD_DFUNCTR);
-  WriteData(0x02); // MCU
-  WriteData(0x02); // Source, Gate scan direction
-
-  WriteCommand(0xE9); // Set Image Function
-  WriteData(0x00);    // Disable 24 bit data
+  CMD_DFUNCTR, 2u,
+    0x02, // MCU
+    0x02, // Source, Gate scan direction
+  // Set Image Function
+  0xE9, 1u, 0x00, // Disable 24 bit data
 
   // Exit Sleep
-  WriteCommand(CMD_SLPOUT);
-  // Delay for execute previous command
-  Delay(120u);
+  CMD_SLPOUT, CMD_LIST_DELAY, 120u, // Delay for execute previous command
+
   // Display on
-  WriteCommand(CMD_DISPON);
+  CMD_DISPON, 0u,
+};
+
+// *****************************************************************************
+// ***   Public: Init screen   *************************************************
+// *****************************************************************************
+Result ILI9488::Init(void)
+{
+  // Reset sequence. Used only if GPIO pin used as LCD reset.
+  if(display_rst != nullptr)
+  {
+    display_rst->SetHigh(); // Pull up reset line
+    Delay(5u);              // Wait for 5 ms
+    display_rst->SetLow();  // Pull down reset line
+    Delay(20u);             // Wait for 20 ms
+    display_rst->SetHigh(); // Pull up reset line
+    Delay(150u);            // Wait for 150 ms
+  }
+
+  // Send init sequence
+  WriteCommandList(init_cmd_list, sizeof(init_cmd_list));
 
   // Always Ok
   return Result::RESULT_OK;
@@ -243,18 +217,8 @@ Result ILI9488::Init(void)
 // *****************************************************************************
 Result ILI9488::PrepareData(uint32_t* data, uint32_t n)
 {
-  // Change pointer to uint8_t
-  uint8_t* dt = (uint8_t*)data;
-  // Index for packed data
-  uint32_t idx = 0;
   // Do packing 32 bit -> 24 bit
-  for(uint32_t i = 0u; i < n*4; i++)
-  {
-    // Create 24-bit RGB values from 32 bit
-    dt[idx++] = dt[i++];
-    dt[idx++] = dt[i++];
-    dt[idx++] = dt[i++];
-  }
+  PixelConvert::Rgb888xToRgb888((uint8_t*)data, n);
   // Always Ok
   return Result::RESULT_OK;
 }
@@ -264,19 +228,8 @@ Result ILI9488::PrepareData(uint32_t* data, uint32_t n)
 // *****************************************************************************
 Result ILI9488::PrepareData(uint16_t* data, uint32_t n)
 {
-  // Change pointer to uint8_t
-  uint8_t* dt = (uint8_t*)data;
-  // Index variable
-  uint16_t idx = (n * 3u) - 1u;
-  // Convert data
-  for(int16_t i = n - 1u; i >= 0; i--)
-  {
-    uint16_t color = dt[i*2u+1u] | (dt[i*2u] << 8u);
-    // Create 24-bit RGB values from 16 bit
-    dt[idx--] = (color & 0x001F) << 3;
-    dt[idx--] = (color & 0x07E0) >> 3; // >> 5 << 3
-    dt[idx--] = (color & 0xF800) >> 8; // >> 11 << 3
-  }
+  // Create 24-bit RGB values from 16 bit
+  PixelConvert::Rgb565ToRgb888((uint8_t*)data, n);
   // Always Ok
   return Result::RESULT_OK;
 }
@@ -286,24 +239,8 @@ Result ILI9488::PrepareData(uint16_t* data, uint32_t n)
 // *****************************************************************************
 Result ILI9488::PrepareData(uint8_t* data, uint32_t n)
 {
-  // Convert data
-  for(uint32_t i = 0u; i < n / 2u; i++)
-  {
-//    uint16_t color1 = data[i*4u+1u] | (data[i*4u+0u] << 8u);
-//    uint16_t color2 = data[i*4u+3u] | (data[i*4u+2u] << 8u);
-//    // Create two 3-bit RGB values from two 16 bit
-//    data[i] = ((color1 & 0x0010) ? 0x20 : 0x00) | ((color1 & 0x0400) ? 0x10 : 0x00) | ((color1 & 0x8000) ? 0x08 : 0x00) |
-//              ((color2 & 0x0010) ? 0x04 : 0x00) | ((color2 & 0x0400) ? 0x02 : 0x00) | ((color2 & 0x8000) ? 0x01 : 0x00);
-
-//    data[i] = ((data[i*4u+1u] & 0x10) ? 0x20 : 0x00) | ((data[i*4u+0u] & 0x04) ? 0x10 : 0x00) | ((data[i*4u+0u] & 0x80) ? 0x08 : 0x00) |
-//              ((data[i*4u+3u] & 0x10) ? 0x04 : 0x00) | ((data[i*4u+2u] & 0x04) ? 0x02 : 0x00) | ((data[i*4u+2u] & 0x80) ? 0x01 : 0x00);
-
-//    data[i] = ((data[i*4u+1u] & 0x10) << 1u) | ((data[i*4u+0u] & 0x04) << 2u) | ((data[i*4u+0u] & 0x80) >> 4u) |
-//              ((data[i*4u+3u] & 0x10) >> 2u) | ((data[i*4u+2u] & 0x04) >> 1u) | ((data[i*4u+2u] & 0x80) >> 7u);
-
-    //
-    data[i] = ((data[i*2u + 0u] & 0x07) << 3u) | (data[i*2u + 1u] & 0x07);
-  }
+  // Pack two 3-bit pixels in one byte
+  PixelConvert::Rgb3BitPack(data, n);
   // Always Ok
   return Result::RESULT_OK;
 }
@@ -323,6 +260,39 @@ Result ILI9488::WriteDataStream(uint8_t* data, uint32_t n)
   return result;
 }
 
+// *****************************************************************************
+// ***   Public: Write same color to output window   ***************************
+// *****************************************************************************
+Result ILI9488::WriteColor(color_t color, uint32_t n)
+{
+  Result result = Result::RESULT_OK;
+  // Pattern buffer, twice bigger because prepared data can take more space
+  // than colors(16 bit -> 18 bit)
+  color_t buf[DISPLAY_FILL_BUF_PIXELS * 2u];
+  uint32_t buf_cnt = (n < DISPLAY_FILL_BUF_PIXELS) ? n : DISPLAY_FILL_BUF_PIXELS;
+  for(uint32_t i = 0u; i < buf_cnt; i++)
+  {
+    buf[i] = color;
+  }
+  // Convert colors to display format once
+  PrepareData(buf, buf_cnt);
+  // Data
+  display_dc.SetHigh();
+  // Pull down CS
+  display_cs.SetLow();
+  // Send pattern buffer until all pixels are sent
+  while((n != 0u) && result.IsGood())
+  {
+    uint32_t cnt = (n < buf_cnt) ? n : buf_cnt;
+    result = spi.Write((uint8_t*)buf, GetPixelDataCnt(cnt));
+    n -= cnt;
+  }
+  // Pull up CS
+  display_cs.SetHigh();
+  // Return result
+  return result;
+}
+
 // *****************************************************************************
 // ***   Public: Check SPI transfer status   ***********************************
 // *****************************************************************************
@@ -347,24 +317,30 @@ Result ILI9488::StopTransfer(void)
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   Public: Set callback for data stream transfer completion   ************
+// *****************************************************************************
+Result ILI9488::SetTransferCompleteCallback(ICallback* callback)
+{
+  // Data stream sent via SPI, so SPI driver reports transfer completion
+  return spi.SetTransferCompleteCallback(callback);
+}
+
 // *****************************************************************************
 // ***   Public: Set output window   *******************************************
 // *****************************************************************************
 Result ILI9488::SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
-  WriteCommand(CMD_CASET); // Column address set
-  WriteData(x0 >> 8);
-  WriteData(x0 & 0xFF); // XSTART 
-  WriteData(x1 >> 8);
-  WriteData(x1 & 0xFF); // XEND
-
-  WriteCommand(CMD_PASET); // Row address set
-  WriteData(y0 >> 8);
-  WriteData(y0 & 0xFF); // YSTART
-  WriteData(y1 >> 8);
-  WriteData(y1 & 0xFF); // YEND
+  // Column and row address parameters
+  uint8_t col[4u] = {(uint8_t)(x0 >> 8), (uint8_t)x0, (uint8_t)(x1 >> 8), (uint8_t)x1};
+  uint8_t row[4u] = {(uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8), (uint8_t)y1};
 
-  WriteCommand(CMD_RAMWR); // write to RAM
+  // Send window setup in one CS cycle
+  display_cs.SetLow(); // Pull down CS
+  SendCommand(CMD_CASET, col, sizeof(col)); // Column address set
+  SendCommand(CMD_PASET, row, sizeof(row)); // Row address set
+  SendCommand(CMD_RAMWR, nullptr, 0u); // Write to RAM
+  display_cs.SetHigh(); // Pull up CS
 
   // Prepare for write data
   display_dc.SetHigh(); // Data
@@ -378,39 +354,47 @@ Result ILI9488::SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1
 // *****************************************************************************
 Result ILI9488::SetRotation(IDisplay::Rotation r)
 {
+  // Result
+  Result result = Result::RESULT_OK;
+
   rotation = r;
-  WriteCommand(CMD_MADCTL);
   switch (rotation)
   {
     case IDisplay::ROTATION_BOTTOM:
-      WriteData(MADCTL_MX | MADCTL_MY | MADCTL_MV | MADCTL_BGR);
+      madctl = MADCTL_MX | MADCTL_MY | MADCTL_MV | MADCTL_BGR;
       width  = init_width;
       height = init_height;
       break;
 
     case IDisplay::ROTATION_RIGHT:
-      WriteData(MADCTL_MY | MADCTL_BGR);
+      madctl = MADCTL_MY | MADCTL_BGR;
       width  = init_height;
       height = init_width;
       break;
 
     case IDisplay::ROTATION_LEFT:
-      WriteData(MADCTL_MX | MADCTL_BGR);
+      madctl = MADCTL_MX | MADCTL_BGR;
       width  = init_height;
       height = init_width;
       break;
 
     case IDisplay::ROTATION_TOP:
-      WriteData(MADCTL_MV | MADCTL_BGR);
+      madctl = MADCTL_MV | MADCTL_BGR;
       width  = init_width;
       height = init_height;
       break;
 
     default:
+      result = Result::ERR_BAD_PARAMETER;
       break;
   }
-  // Always Ok
-  return Result::RESULT_OK;
+  // Set Memory Access Control register
+  if(result.IsGood())
+  {
+    WriteCommand(CMD_MADCTL, &madctl, sizeof(madctl));
+  }
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -487,21 +471,13 @@ Result ILI9488::DrawPixel(int16_t x, int16_t y, color_t color)
 Result ILI9488::DrawFastVLine(int16_t x, int16_t y, int16_t h, color_t color)
 {
   // Rudimentary clipping
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (h > 0))
   {
     if((y+h-1) >= height) h = height-y;
 
     SetAddrWindow(x, y, x, y+h-1);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    while(h--)
-    {
-      spi.Write(&clr, sizeof(clr));
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of line
+    WriteColor(color, h);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -512,21 +488,13 @@ Result ILI9488::DrawFastVLine(int16_t x, int16_t y, int16_t h, color_t color)
 // *****************************************************************************
 Result ILI9488::DrawFastHLine(int16_t x, int16_t y, int16_t w, color_t color)
 {
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (w > 0))
   {
     if((x+w-1) >= width)  w = width-x;
 
     SetAddrWindow(x, y, x+w-1, y);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    while(w--)
-    {
-      spi.Write(&clr, sizeof(clr));
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of line
+    WriteColor(color, w);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -537,25 +505,14 @@ Result ILI9488::DrawFastHLine(int16_t x, int16_t y, int16_t w, color_t color)
 // *****************************************************************************
 Result ILI9488::FillRect(int16_t x, int16_t y, int16_t w, int16_t h, color_t color)
 {
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (w > 0) && (h > 0))
   {
     if((x + w - 1) >= width)  w = width  - x;
     if((y + h - 1) >= height) h = height - y;
 
     SetAddrWindow(x, y, x+w-1, y+h-1);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    for(y = h; y > 0; y--)
-    {
-      for(x = w; x > 0; x--)
-      {
-        spi.Write(&clr, sizeof(clr));
-      }
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of rectangle
+    WriteColor(color, w * h);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -571,6 +528,73 @@ Result ILI9488::InvertDisplay(bool invert)
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   Public: Set vertical scroll area   ************************************
+// *****************************************************************************
+Result ILI9488::SetScrollArea(uint16_t start, uint16_t end)
+{
+  // Result
+  Result result = Result::ERR_BAD_PARAMETER;
+
+  // Display scrolls memory lines. If rows and columns exchanged, those lines
+  // are columns on the screen.
+  uint16_t len = (madctl & MADCTL_MV) ? width : height;
+  if((start <= end) && (end < len))
+  {
+    // Screen lines to display memory lines
+    uint16_t first = start;
+    uint16_t last = end;
+    // If row address order is reversed, screen area is reversed in memory
+    scroll_start = (madctl & MADCTL_MY) ? (GATE_LINES - 1u - last) : first;
+    scroll_size = last - first + 1u;
+    uint16_t bottom = GATE_LINES - scroll_start - scroll_size;
+    // Top fixed area, vertical scrolling area and bottom fixed area
+    uint8_t data[6u] = {(uint8_t)(scroll_start >> 8), (uint8_t)scroll_start,
+                        (uint8_t)(scroll_size >> 8),  (uint8_t)scroll_size,
+                        (uint8_t)(bottom >> 8),       (uint8_t)bottom};
+    WriteCommand(CMD_VSCRDEF, data, sizeof(data));
+    // Start without offset
+    result = SetScrollOffset(0u);
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Set vertical scroll offset   **********************************
+// *****************************************************************************
+Result ILI9488::SetScrollOffset(uint16_t offset)
+{
+  // Result
+  Result result = Result::ERR_BAD_PARAMETER;
+
+  // Offset should be inside scroll area
+  if(offset < scroll_size)
+  {
+    // If row address order is reversed, content moves in opposite direction
+    if((madctl & MADCTL_MY) && (offset != 0u))
+    {
+      offset = scroll_size - offset;
+    }
+    // Memory line shown at the start of scroll area
+    uint16_t line = scroll_start + offset;
+    uint8_t data[2u] = {(uint8_t)(line >> 8), (uint8_t)line};
+    WriteCommand(CMD_VSAADDR, data, sizeof(data));
+    // Set result
+    result = Result::RESULT_OK;
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Check if display scrolls along X axis   ***********************
+// *****************************************************************************
+bool ILI9488::IsScrollAlongX(void)
+{
+  return ((madctl & MADCTL_MV) != 0u);
+}
+
 // *****************************************************************************
 // ***   Private: Delay in ms    ***********************************************
 // *****************************************************************************
@@ -610,6 +634,58 @@ inline void ILI9488::SpiWrite(uint8_t c)
   display_cs.SetHigh(); // Pull up CS
 }
 
+// *****************************************************************************
+// ***   Private: Write command with parameters to SPI   ***********************
+// *****************************************************************************
+void ILI9488::WriteCommand(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  display_cs.SetLow(); // Pull down CS
+  SendCommand(c, data, n);
+  display_cs.SetHigh(); // Pull up CS
+}
+
+// *****************************************************************************
+// ***   Private: Write list of commands to SPI   ******************************
+// *****************************************************************************
+void ILI9488::WriteCommandList(const uint8_t* list, uint32_t size)
+{
+  // Index of current command in list
+  uint32_t idx = 0u;
+  // Send all commands from list
+  while(idx + 1u < size)
+  {
+    // Get command and number of parameters
+    uint8_t c = list[idx];
+    uint8_t n = list[idx + 1u] & ~CMD_LIST_DELAY;
+    bool need_delay = (list[idx + 1u] & CMD_LIST_DELAY) != 0u;
+    idx += 2u;
+    // Send command with all parameters in one CS cycle
+    WriteCommand(c, &list[idx], n);
+    idx += n;
+    // Wait for execute command if needed
+    if(need_delay)
+    {
+      Delay(list[idx]);
+      idx++;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Send command with parameters   *******************************
+// *****************************************************************************
+inline void ILI9488::SendCommand(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  display_dc.SetLow(); // Command
+  spi.Write(&c, sizeof(c));
+  // All parameters sent in one transfer
+  if(n != 0u)
+  {
+    display_dc.SetHigh(); // Data
+    spi.Write((uint8_t*)data, n);
+  }
+}
+
 // *****************************************************************************
 // ***   Private: Send read command ad read result   ***************************
 // *****************************************************************************
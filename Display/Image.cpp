@@ -19,6 +19,8 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "Image.h"
+#include "AlphaBlend.h"
+#include <cstring> // for memcpy()
 
 // *****************************************************************************
 // *****************************************************************************
@@ -41,6 +43,8 @@ Image::Image(int32_t x, int32_t y, const ImageDesc& img_dsc)
   img = img_dsc.img;
   palette = img_dsc.palette;
   transparent_color = img_dsc.transparent_color;
+  alpha_map = img_dsc.alpha_map;
+  runs = img_dsc.runs;
   hor_mirror = false;
 }
 
@@ -51,7 +55,7 @@ void Image::SetImage(const ImageDesc& img_dsc)
 {
   LockVisObject();
   // Update image only if something changed
-  if((img != img_dsc.img) || (width != img_dsc.width) || (height != img_dsc.height) || (palette != img_dsc.palette) || (transparent_color != img_dsc.transparent_color))
+  if((img != img_dsc.img) || (width != img_dsc.width) || (height != img_dsc.height) || (palette != img_dsc.palette) || (transparent_color != img_dsc.transparent_color) || (alpha_map != img_dsc.alpha_map) || (runs != img_dsc.runs))
   {
     InvalidateObjArea();
     width = img_dsc.width;
@@ -62,23 +66,67 @@ void Image::SetImage(const ImageDesc& img_dsc)
     img = img_dsc.img;
     palette = img_dsc.palette;
     transparent_color = img_dsc.transparent_color;
+    alpha_map = img_dsc.alpha_map;
+    runs = img_dsc.runs;
     InvalidateObjArea();
   }
   UnlockVisObject();
 }
 
+// *****************************************************************************
+// ***   Get size of run table   ***********************************************
+// *****************************************************************************
+uint32_t Image::GetRunsSize(const ImageDesc& img_dsc)
+{
+  return FindRuns(img_dsc, nullptr);
+}
+
+// *****************************************************************************
+// ***   Build run table   *****************************************************
+// *****************************************************************************
+Result Image::BuildRuns(ImageDesc& img_dsc, uint16_t* buf, uint32_t size)
+{
+  Result result = Result::RESULT_OK;
+
+  // Find table size
+  uint32_t runs_size = FindRuns(img_dsc, nullptr);
+  // Check parameters
+  if((img_dsc.img == nullptr) || (buf == nullptr))
+  {
+    result = Result::ERR_NULL_PTR;
+  }
+  else if(runs_size == 0u)
+  {
+    // Error - only palette and bitmap images is supported
+    result = Result::ERR_BAD_PARAMETER;
+  }
+  else if((runs_size > size) || (runs_size > UINT16_MAX))
+  {
+    // Error - table doesn't fit in buffer or can't be indexed by uint16_t
+    result = Result::ERR_INVALID_SIZE;
+  }
+  else
+  {
+    // Build table and use it for image
+    FindRuns(img_dsc, buf);
+    img_dsc.runs = buf;
+  }
+
+  return result;
+}
+
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
 void Image::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 {
   // Draw only if needed
-  if((line >= y_start) && (line <= y_end) && (img != nullptr))
+  if((line >= y_start) && (line <= y_end) && (img != nullptr) && (alpha != 0u))
   {
-    // Find idx in the image buffer
-    uint32_t idx = (line - y_start) * width;
     // Find start x position
     int32_t start = x_start - start_x;
+    // Find idx in the image buffer
+    uint32_t idx = (line - y_start) * width;
     // Prevent write in memory before buffer
     if(start < 0)
     {
@@ -86,49 +134,32 @@ void Image::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
       idx -= start;
       start = 0;
     }
-    // Find start x position
+    // Find end x position
     int32_t end = x_end - start_x;
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
-    // Delta for cycle increment/decrement
-    int32_t delta = 1;
-    // Flip horizontally if needed
-    if(hor_mirror)
+    // Not translucent image with run table draws only runs of the line
+    if((runs != nullptr) && (alpha == 255u) && (alpha_map == nullptr))
     {
-      idx += end - start;
-      // Set delta to minus one for decrement cycle
-      delta = -1;
-    }
-    // Draw image
-    if(palette != nullptr)
-    {
-      // Get pointer to palette image data
-      uint8_t* p_img = (uint8_t*)img;
-      // Pixels data copy cycle
-      for(int32_t i = start; i <= end; i++)
-      {
-        // Get pixel data
-        color_t data = palette[p_img[idx]];
-        // Change index
-        idx += delta;
-        // If not transparent - output to buffer
-        if((int32_t)data != transparent_color) buf[i] = data;
-      }
+      // Position of first image column in buffer, last one if mirrored
+      int32_t offset = hor_mirror ? (x_end - start_x) : (x_start - start_x);
+      // Draw runs
+      PutRunsInBuf(buf, start, end, line - y_start, offset);
     }
     else
     {
-      // Get pointer to image data
-      color_t* p_img = (color_t*)img;
-      // Pixels data copy cycle
-      for(int32_t i = start; i <= end; i++)
+      // Delta for cycle increment/decrement
+      int32_t delta = 1;
+      // Flip horizontally if needed
+      if(hor_mirror)
       {
-        // Get pixel data
-        color_t data = p_img[idx];
-        // Change index
-        idx += delta;
-        // If not transparent - output to buffer
-        if((int32_t)data != transparent_color) buf[i] = data;
+        // First pixel in buffer shows image column counted from the right side
+        idx = (line - y_start) * width + (x_end - start_x - start);
+        // Set delta to minus one for decrement cycle
+        delta = -1;
       }
+      // Draw image
+      PutInBuf(buf, start, end, idx, delta);
     }
   }
 }
@@ -139,24 +170,234 @@ void Image::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 void Image::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
   // Draw only if needed
-  if((row >= x_start) && (row <= x_end))
+  if((row >= x_start) && (row <= x_end) && (img != nullptr) && (alpha != 0u) && ((runs == nullptr) || !(runs[0u] & RUNS_TRANSPARENT)))
   {
-    // Find start x position
+    // Find column in the image, flip horizontally if needed
+    int32_t col = hor_mirror ? (x_end - row) : (row - x_start);
+    // Find idx in the image buffer
+    uint32_t idx = col;
+    // Find start y position
     int32_t start = y_start - start_y;
     // Prevent write in memory before buffer
-    if(start < 0) start = 0;
-    // Find start x position
+    if(start < 0)
+    {
+      // Skip invisible lines of image
+      idx -= start * width;
+      start = 0;
+    }
+    // Find end y position
     int32_t end = y_end - start_y;
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
-    // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    // Draw image column, next pixel is on the next line of image
+    PutInBuf(buf, start, end, idx, width);
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Put pixels of image in buffer   ******************************
+// *****************************************************************************
+void Image::PutInBuf(color_t* buf, int32_t start, int32_t end, uint32_t idx, int32_t delta)
+{
+  if((alpha != 255u) || (alpha_map != nullptr))
+  {
+    // Translucent image
+    BlendInBuf(buf, start, end, idx, delta);
+  }
+  else if(palette != nullptr)
+  {
+    // Get pointer to palette image data
+    uint8_t* p_img = (uint8_t*)img;
+    // Pixels data copy cycle
+    for(int32_t i = start; i <= end; i++)
+    {
+      // Get pixel data
+      color_t data = palette[p_img[idx]];
+      // Change index
+      idx += delta;
+      // If not transparent - output to buffer
+      if((int32_t)data != transparent_color) buf[i] = data;
+    }
+  }
+  else
+  {
+    // Get pointer to image data
+    color_t* p_img = (color_t*)img;
+    // Pixels data copy cycle
+    for(int32_t i = start; i <= end; i++)
+    {
+      // Get pixel data
+      color_t data = p_img[idx];
+      // Change index
+      idx += delta;
+      // If not transparent - output to buffer
+      if((int32_t)data != transparent_color) buf[i] = data;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Blend pixels of image in buffer   ****************************
+// *****************************************************************************
+void Image::BlendInBuf(color_t* buf, int32_t start, int32_t end, uint32_t idx, int32_t delta)
+{
+  // Bitmap line without mirror and transparent color can be blended at once
+  if((palette == nullptr) && (delta == 1) && (transparent_color < 0))
+  {
+    // Have sense draw only if there are pixels in buffer
+    if(start <= end)
     {
-      // Not implemented yet
+      // Get pointer to image data
+      const color_t* p_img = (const color_t*)img + idx;
+      // Blend with alpha map or with object alpha only
+      if(alpha_map != nullptr)
+      {
+        AlphaBlend::BlendPixels(&buf[start], p_img, &alpha_map[idx], end - start + 1, alpha);
+      }
+      else
+      {
+        AlphaBlend::BlendPixels(&buf[start], p_img, end - start + 1, alpha);
+      }
+    }
+  }
+  else
+  {
+    // Pixels data blend cycle
+    for(int32_t i = start; i <= end; i++)
+    {
+      // Get pixel data
+      color_t data = (palette != nullptr) ? palette[((const uint8_t*)img)[idx]] : ((const color_t*)img)[idx];
+      // Get pixel alpha
+      uint8_t a = (alpha_map != nullptr) ? AlphaBlend::Scale(alpha_map[idx], alpha) : alpha;
+      // Change index
+      idx += delta;
+      // If not transparent - blend with buffer
+      if((int32_t)data != transparent_color) buf[i] = AlphaBlend::Blend(data, buf[i], a);
     }
   }
 }
 
+// *****************************************************************************
+// ***   Private: Put runs of image line in buffer   ***************************
+// *****************************************************************************
+void Image::PutRunsInBuf(color_t* buf, int32_t start, int32_t end, int32_t line, int32_t offset)
+{
+  // Image columns visible in buffer
+  int32_t first = hor_mirror ? (offset - end) : (start - offset);
+  int32_t last = hor_mirror ? (offset - start) : (end - offset);
+  // Runs of the line
+  const uint16_t* run = &runs[runs[1u + line]];
+  const uint16_t* run_end = &runs[runs[2u + line]];
+  // Index of the line in the image buffer
+  uint32_t idx = line * width;
+  // Runs are sorted, so stop at first run after visible columns
+  for(; (run < run_end) && (run[0u] <= last); run += 2u)
+  {
+    // Clip run by visible columns
+    int32_t x0 = (run[0u] > first) ? run[0u] : first;
+    int32_t x1 = run[0u] + run[1u] - 1;
+    if(x1 > last) x1 = last;
+    // Skip runs before visible columns
+    if(x0 > x1) continue;
+    // Copy run pixels without transparency check
+    if(palette != nullptr)
+    {
+      const uint8_t* p_img = (const uint8_t*)img + idx;
+      if(hor_mirror)
+      {
+        for(int32_t x = x0; x <= x1; x++) buf[offset - x] = palette[p_img[x]];
+      }
+      else
+      {
+        for(int32_t x = x0; x <= x1; x++) buf[offset + x] = palette[p_img[x]];
+      }
+    }
+    else
+    {
+      const color_t* p_img = (const color_t*)img + idx;
+      if(hor_mirror)
+      {
+        for(int32_t x = x0; x <= x1; x++) buf[offset - x] = p_img[x];
+      }
+      else
+      {
+        memcpy(&buf[offset + x0], &p_img[x0], (x1 - x0 + 1) * sizeof(color_t));
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Find runs of not transparent pixels   ************************
+// *****************************************************************************
+uint32_t Image::FindRuns(const ImageDesc& img_dsc, uint16_t* buf)
+{
+  // Pointers to image data, only one of them is used
+  const uint8_t* p_img = nullptr;
+  const color_t* p_bmp = nullptr;
+  if((img_dsc.bits_per_pixel == sizeof(uint8_t) * 8u) && (img_dsc.palette != nullptr))
+  {
+    p_img = img_dsc.imgp;
+  }
+  else if(img_dsc.bits_per_pixel == sizeof(color_t) * 8u)
+  {
+    p_bmp = img_dsc.imgb;
+  }
+
+  // Table size, zero if image isn't supported
+  uint32_t pos = 0u;
+  if((img_dsc.img != nullptr) && ((p_img != nullptr) || (p_bmp != nullptr)))
+  {
+    // Runs start after flags and line indexes
+    pos = 1u + img_dsc.height + 1u;
+    // Count of not transparent pixels
+    uint32_t opaque_cnt = 0u;
+    // Index in the image buffer
+    uint32_t idx = 0u;
+    for(uint32_t line = 0u; line < img_dsc.height; line++)
+    {
+      // Save index of first run of the line
+      if(buf != nullptr) buf[1u + line] = pos;
+      uint32_t x = 0u;
+      while(x < img_dsc.width)
+      {
+        // Skip transparent pixels, then find end of the run
+        uint32_t run_start = img_dsc.width;
+        for(; x < img_dsc.width; x++)
+        {
+          color_t data = (p_img != nullptr) ? img_dsc.palette[p_img[idx + x]] : p_bmp[idx + x];
+          bool is_transparent = ((int32_t)data == img_dsc.transparent_color);
+          if((run_start == img_dsc.width) && !is_transparent) run_start = x;
+          else if((run_start != img_dsc.width) && is_transparent) break;
+        }
+        // Save run if found
+        if(run_start < x)
+        {
+          if(buf != nullptr)
+          {
+            buf[pos] = run_start;
+            buf[pos + 1u] = x - run_start;
+          }
+          pos += 2u;
+          opaque_cnt += x - run_start;
+        }
+      }
+      idx += img_dsc.width;
+    }
+    // Save end of the table and flags
+    if(buf != nullptr)
+    {
+      buf[1u + img_dsc.height] = pos;
+      buf[0u] = 0u;
+      if(opaque_cnt == (uint32_t)img_dsc.width * img_dsc.height) buf[0u] |= RUNS_OPAQUE;
+      if(opaque_cnt == 0u) buf[0u] |= RUNS_TRANSPARENT;
+    }
+  }
+
+  // Return table size
+  return pos;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // ***   ImagePalette   ********************************************************
@@ -245,7 +486,7 @@ void ImagePalette::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t sta
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
     // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    if(end >= 0)
     {
       // Find idx in the image buffer
       uint32_t idx = (line - y_start) * width;
@@ -274,18 +515,30 @@ void ImagePalette::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t star
   // Draw only if needed
   if((row >= x_start) && (row <= x_end) && (img != nullptr) && (palette != nullptr))
   {
-    // Find start x position
-    int32_t start = y_start - start_y;
-    // Prevent write in memory before buffer
-    if(start < 0) start = 0;
-    // Find start x position
+    // Find end y position
     int32_t end = y_end - start_y;
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
     // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    if(end >= 0)
     {
-      // Not implemented yet
+      // Find idx in the image buffer
+      uint32_t idx = row - x_start;
+      // Find start y position
+      int32_t start = y_start - start_y;
+      // Prevent write in memory before buffer
+      if(start < 0)
+      {
+        // Skip invisible lines of image
+        idx -= start * width;
+        start = 0;
+      }
+      // Next pixel of column is on the next line of image
+      for(int32_t i = start; i <= end; i++)
+      {
+        buf[i] = palette[img[idx]];
+        idx += width;
+      }
     }
   }
 }
@@ -375,7 +628,7 @@ void ImageBitmap::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t star
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
     // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    if(end >= 0)
     {
       // Find idx in the image buffer
       uint32_t idx = (line - y_start) * width;
@@ -404,18 +657,30 @@ void ImageBitmap::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start
   // Draw only if needed
   if((row >= x_start) && (row <= x_end) && (img != nullptr))
   {
-    // Find start x position
-    int32_t start = y_start - start_y;
-    // Prevent write in memory before buffer
-    if(start < 0) start = 0;
-    // Find start x position
+    // Find end y position
     int32_t end = y_end - start_y;
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
     // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    if(end >= 0)
     {
-      // Not implemented yet
+      // Find idx in the image buffer
+      uint32_t idx = row - x_start;
+      // Find start y position
+      int32_t start = y_start - start_y;
+      // Prevent write in memory before buffer
+      if(start < 0)
+      {
+        // Skip invisible lines of image
+        idx -= start * width;
+        start = 0;
+      }
+      // Next pixel of column is on the next line of image
+      for(int32_t i = start; i <= end; i++)
+      {
+        buf[i] = img[idx];
+        idx += width;
+      }
     }
   }
 }
@@ -499,7 +764,7 @@ void ImageBinary::SetImage(const uint8_t* p_img, int32_t w, int32_t h)
 void ImageBinary::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 {
   // Draw only if needed
-  if((line >= y_start) && (line <= y_end) && (img != nullptr))
+  if((line >= y_start) && (line <= y_end) && (img != nullptr) && (alpha != 0u))
   {
     // Find idx in the image buffer. Since it binary image, it can have up to
     // 7 unused "pixels" in the end of line
@@ -522,7 +787,7 @@ void ImageBinary::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t star
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
     // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    if(end >= 0)
     {
       // Draw image
       for(int32_t i = start; i <= end; i++)
@@ -556,9 +821,40 @@ void ImageBinary::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t star
 void ImageBinary::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
   // Draw only if needed
-  if((row >= x_start) && (row <= x_end) && (img != nullptr))
+  if((row >= x_start) && (row <= x_end) && (img != nullptr) && (alpha != 0u))
   {
-    // Not implemented yet
+    // Bytes per line of image, it can have up to 7 unused "pixels" in the end
+    int32_t line_bytes = ((width % 8) == 0) ? (width / 8) : (width / 8 + 1);
+    // Find idx in the image buffer and mask of pixel bit inside byte
+    int32_t idx = (row - x_start) / 8;
+    uint8_t mask = 0x01u << ((row - x_start) % 8);
+    // Find start y position
+    int32_t start = y_start - start_y;
+    // Prevent write in memory before buffer
+    if(start < 0)
+    {
+      // Skip invisible lines of image
+      idx -= start * line_bytes;
+      start = 0;
+    }
+    // Find end y position
+    int32_t end = y_end - start_y;
+    // Prevent buffer overflow
+    if(end >= n) end = n - 1;
+    // Draw image, bit position is the same for whole column
+    for(int32_t i = start; i <= end; i++)
+    {
+      if(img[idx] & mask)
+      {
+        if(color != transparent_color) buf[i] = color;
+      }
+      else
+      {
+        if(bg_color != transparent_color) buf[i] = bg_color;
+      }
+      // Next line of image
+      idx += line_bytes;
+    }
   }
 }
 
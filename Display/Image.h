@@ -87,6 +87,11 @@ typedef struct typeImageDesc
   const color_t* palette = nullptr;
   // Transparent color (-1 no transparent colors)
   int32_t transparent_color = -1;
+  // Pointer to alpha map: one byte of opacity per pixel (nullptr - no map)
+  const uint8_t* alpha_map = nullptr;
+  // Pointer to table of opaque pixel runs (nullptr - no table), see
+  // Image::BuildRuns()
+  const uint16_t* runs = nullptr;
 } ImageDesc;
 
 // *****************************************************************************
@@ -95,6 +100,15 @@ typedef struct typeImageDesc
 class Image : public VisObject
 {
   public:
+    // *************************************************************************
+    // ***   Flags in the first entry of run table   ***************************
+    // *************************************************************************
+    enum RunsFlags : uint16_t
+    {
+      RUNS_OPAQUE      = 0x0001u, // All pixels of image are opaque
+      RUNS_TRANSPARENT = 0x0002u  // All pixels of image are transparent
+    };
+
     // *************************************************************************
     // ***   Constructor   *****************************************************
     // *************************************************************************
@@ -115,6 +129,25 @@ class Image : public VisObject
     // *************************************************************************
     inline void SetHorizontalFlip(bool flip) {if(hor_mirror != flip) {hor_mirror = flip; InvalidateObjArea();}}
 
+    // *************************************************************************
+    // ***   Get size of run table   *******************************************
+    // *************************************************************************
+    // * Returns number of uint16_t entries BuildRuns() needs for the image.
+    static uint32_t GetRunsSize(const ImageDesc& img_dsc);
+
+    // *************************************************************************
+    // ***   Build run table   *************************************************
+    // *************************************************************************
+    // * Finds runs of not transparent pixels in every line of 8-bit palette or
+    // * color_t bitmap image and sets img_dsc.runs to the table in buf. Table
+    // * can be built once at startup or offline, the format is:
+    // *   [0]             - RunsFlags of the whole image
+    // *   [1..height + 1] - index of first run of each line, last entry is the
+    // *                     end of the table
+    // *   [...]           - runs of the line: x of first pixel, pixels count
+    // * Image with table draws lines run by run without transparency checks.
+    static Result BuildRuns(ImageDesc& img_dsc, uint16_t* buf, uint32_t size);
+
     // *************************************************************************
     // ***   Put line in buffer   **********************************************
     // *************************************************************************
@@ -125,6 +158,11 @@ class Image : public VisObject
     // *************************************************************************
     virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t x = 0);
 
+    // *************************************************************************
+    // ***   IsOpaque   ********************************************************
+    // *************************************************************************
+    virtual bool IsOpaque(void) {return (img != nullptr) && ((transparent_color < 0) || ((runs != nullptr) && (runs[0u] & RUNS_OPAQUE))) && (alpha == 255u) && (alpha_map == nullptr);}
+
   protected:
     // Pointer to the image
     const void* img = nullptr;
@@ -132,10 +170,43 @@ class Image : public VisObject
     const color_t* palette = nullptr;
     // Transparent color (-1 no transparent colors)
     int32_t transparent_color = -1;
+    // Pointer to the alpha map
+    const uint8_t* alpha_map = nullptr;
+    // Pointer to the run table
+    const uint16_t* runs = nullptr;
     // Bits per pixel
     uint8_t bits_per_pixel = 0u;
     // Horizontal mirror
     bool hor_mirror = false;
+
+  private:
+    // *************************************************************************
+    // ***   Private: Put pixels of image in buffer   **************************
+    // *************************************************************************
+    // * Puts image pixels idx, idx + delta, ... to buf[start]..buf[end]. Delta
+    // * is +/-1 for line and image width for column.
+    void PutInBuf(color_t* buf, int32_t start, int32_t end, uint32_t idx, int32_t delta);
+
+    // *************************************************************************
+    // ***   Private: Put runs of image line in buffer   ***********************
+    // *************************************************************************
+    // * Puts visible parts of runs of image line to buf[start]..buf[end].
+    // * Offset is position of image column 0 in buffer, or of the last column
+    // * if image is mirrored.
+    void PutRunsInBuf(color_t* buf, int32_t start, int32_t end, int32_t line, int32_t offset);
+
+    // *************************************************************************
+    // ***   Private: Find runs of not transparent pixels   ********************
+    // *************************************************************************
+    // * Writes run table to buf if it isn't nullptr. Returns table size or 0
+    // * if image format isn't supported.
+    static uint32_t FindRuns(const ImageDesc& img_dsc, uint16_t* buf);
+
+    // *************************************************************************
+    // ***   Private: Blend pixels of image in buffer   ************************
+    // *************************************************************************
+    // * Used if image has alpha map or object alpha isn't 255.
+    void BlendInBuf(color_t* buf, int32_t start, int32_t end, uint32_t idx, int32_t delta);
 };
 
 // *****************************************************************************
@@ -174,6 +245,11 @@ class ImagePalette : public VisObject
     // *************************************************************************
     virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t x = 0);
 
+    // *************************************************************************
+    // ***   IsOpaque   ********************************************************
+    // *************************************************************************
+    virtual bool IsOpaque(void) {return (img != nullptr) && (palette != nullptr);}
+
   private:
     // Pointer to the image
     const uint8_t* img = nullptr;
@@ -217,6 +293,11 @@ class ImageBitmap : public VisObject
     // *************************************************************************
     virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t x = 0);
 
+    // *************************************************************************
+    // ***   IsOpaque   ********************************************************
+    // *************************************************************************
+    virtual bool IsOpaque(void) {return img != nullptr;}
+
   private:
     // Pointer to the image
     const color_t* img = nullptr;
@@ -273,6 +354,11 @@ class ImageBinary : public VisObject
     // *************************************************************************
     virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t x = 0);
 
+    // *************************************************************************
+    // ***   IsOpaque   ********************************************************
+    // *************************************************************************
+    virtual bool IsOpaque(void) {return (img != nullptr) && (color != transparent_color) && (bg_color != transparent_color);}
+
   private:
     // Pointer to the image
     const uint8_t* img = nullptr;
@@ -0,0 +1,277 @@
+// *****************************************************************************
+// @file MemoryDisplay.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Memory Display Class, implementation
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "MemoryDisplay.h"
+#include "Math/Crc32.h"
+
+#include <cstdio>
+
+// *****************************************************************************
+// ***   Public: Init screen   *************************************************
+// *****************************************************************************
+Result MemoryDisplay::Init(void)
+{
+  // Clear screen and set window to full screen
+  FillScreen(COLOR_BLACK);
+  return SetAddrWindow(0u, 0u, width - 1u, height - 1u);
+}
+
+// *****************************************************************************
+// ***   Public: Write data stream to memory   *********************************
+// *****************************************************************************
+Result MemoryDisplay::WriteDataStream(uint8_t* data, uint32_t n)
+{
+  // Data stream contains colors as is
+  color_t* color = (color_t*)data;
+  // Write pixels to window
+  for(uint32_t i = 0u; i < n / sizeof(color_t); i++)
+  {
+    PushColor(color[i]);
+  }
+  // Update counters
+  transfers_cnt++;
+  bytes_cnt += n;
+  // Always good
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Public: Write same color to output window   ***************************
+// *****************************************************************************
+Result MemoryDisplay::WriteColor(color_t color, uint32_t n)
+{
+  // Write pixels to window
+  for(uint32_t i = 0u; i < n; i++)
+  {
+    PushColor(color);
+  }
+  // Update counters
+  transfers_cnt++;
+  bytes_cnt += n * sizeof(color_t);
+  // Always good
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Public: Set output window   *******************************************
+// *****************************************************************************
+Result MemoryDisplay::SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  // Save window and set position to its start
+  win_x0 = x0;
+  win_y0 = y0;
+  win_x1 = x1;
+  win_y1 = y1;
+  cur_x = x0;
+  cur_y = y0;
+  // Update counter
+  windows_cnt++;
+  // Always good
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Public: Set screen orientation   **************************************
+// *****************************************************************************
+Result MemoryDisplay::SetRotation(IDisplay::Rotation r)
+{
+  // Swap width and height for left and right rotation
+  if((r == ROTATION_LEFT) || (r == ROTATION_RIGHT))
+  {
+    width = init_height;
+    height = init_width;
+  }
+  else
+  {
+    width = init_width;
+    height = init_height;
+  }
+  // Save rotation
+  rotation = r;
+  // Always good
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Public: Write color to screen   ***************************************
+// *****************************************************************************
+Result MemoryDisplay::PushColor(color_t color)
+{
+  // Pixels after end of window are ignored
+  if(cur_y <= win_y1)
+  {
+    DrawPixel(cur_x, cur_y, color);
+    // Go to next pixel in window
+    cur_x++;
+    if(cur_x > win_x1)
+    {
+      cur_x = win_x0;
+      cur_y++;
+    }
+  }
+  // Always good
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Public: Draw one pixel on  screen   ***********************************
+// *****************************************************************************
+Result MemoryDisplay::DrawPixel(int16_t x, int16_t y, color_t color)
+{
+  Result result = Result::ERR_BAD_PARAMETER;
+  // Check coordinates
+  if((x >= 0) && (y >= 0) && (x < width) && (y < height))
+  {
+    // Map coordinates to buffer in ROTATION_TOP orientation
+    int32_t bx = x;
+    int32_t by = y;
+    if(rotation == ROTATION_LEFT)
+    {
+      bx = y;
+      by = init_height - 1 - x;
+    }
+    else if(rotation == ROTATION_BOTTOM)
+    {
+      bx = init_width - 1 - x;
+      by = init_height - 1 - y;
+    }
+    else if(rotation == ROTATION_RIGHT)
+    {
+      bx = init_width - 1 - y;
+      by = x;
+    }
+    buf[by * init_width + bx] = color;
+    result = Result::RESULT_OK;
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Fill rectangle on screen   ************************************
+// *****************************************************************************
+Result MemoryDisplay::FillRect(int16_t x, int16_t y, int16_t w, int16_t h, color_t color)
+{
+  // Pixels outside of screen are skipped by DrawPixel()
+  for(int32_t i = y; i < y + h; i++)
+  {
+    for(int32_t j = x; j < x + w; j++)
+    {
+      DrawPixel(j, i, color);
+    }
+  }
+  // Always good
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Public: Get pixel color   *********************************************
+// *****************************************************************************
+color_t MemoryDisplay::GetPixel(int32_t x, int32_t y)
+{
+  color_t color = COLOR_BLACK;
+  // Check coordinates
+  if((x >= 0) && (y >= 0) && (x < init_width) && (y < init_height))
+  {
+    color = buf[y * init_width + x];
+  }
+  // Return color
+  return color;
+}
+
+// *****************************************************************************
+// ***   Public: Get pixel color as 8-bit R, G, B   ****************************
+// *****************************************************************************
+void MemoryDisplay::GetPixelRgb(int32_t x, int32_t y, uint8_t& r, uint8_t& g, uint8_t& b)
+{
+  ColorToRgb(GetPixel(x, y), r, g, b);
+  // Inverted display shows inverted colors
+  if(inversion)
+  {
+    r = ~r;
+    g = ~g;
+    b = ~b;
+  }
+}
+
+// *****************************************************************************
+// ***   Public: Get CRC of screen content   ***********************************
+// *****************************************************************************
+uint32_t MemoryDisplay::GetCrc(void)
+{
+  return Crc32((const uint8_t*)buf, init_width * init_height * sizeof(color_t));
+}
+
+// *****************************************************************************
+// ***   Public: Save screen content to PPM file   *****************************
+// *****************************************************************************
+Result MemoryDisplay::SavePpm(const char* file_name)
+{
+  Result result = Result::ERR_NULL_PTR;
+  // Open file
+  FILE* file = fopen(file_name, "wb");
+  if(file != nullptr)
+  {
+    // Binary PPM header
+    fprintf(file, "P6\n%ld %ld\n255\n", (long)init_width, (long)init_height);
+    // Write pixels
+    for(int32_t y = 0; y < init_height; y++)
+    {
+      for(int32_t x = 0; x < init_width; x++)
+      {
+        uint8_t rgb[3u];
+        GetPixelRgb(x, y, rgb[0u], rgb[1u], rgb[2u]);
+        fwrite(rgb, sizeof(rgb), 1u, file);
+      }
+    }
+    // Close file and set result
+    result = (fclose(file) == 0) ? Result::RESULT_OK : Result::ERR_UNHANDLED_REQUEST;
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Convert color to 8-bit R, G, B   ******************************
+// *****************************************************************************
+void MemoryDisplay::ColorToRgb(color_t color, uint8_t& r, uint8_t& g, uint8_t& b)
+{
+#if defined(COLOR_24BIT)
+  // Color stored as R, G, B bytes in memory
+  r = color & 0xFFu;
+  g = (color >> 8u) & 0xFFu;
+  b = (color >> 16u) & 0xFFu;
+#elif defined(COLOR_16BIT)
+  // Color stored as RGB565 with swapped bytes
+  uint16_t rgb565 = (uint16_t)((color << 8u) | (color >> 8u));
+  r = (rgb565 >> 8u) & 0xF8u;
+  g = (rgb565 >> 3u) & 0xFCu;
+  b = (rgb565 << 3u) & 0xF8u;
+  // Replicate high bits to low ones to get full range
+  r |= r >> 5u;
+  g |= g >> 6u;
+  b |= b >> 5u;
+#else
+  // One bit per color component
+  r = (color & 0x04u) ? 0xFFu : 0x00u;
+  g = (color & 0x02u) ? 0xFFu : 0x00u;
+  b = (color & 0x01u) ? 0xFFu : 0x00u;
+#endif
+}
@@ -0,0 +1,214 @@
+// *****************************************************************************
+// @file MemoryDisplay.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Memory Display Class, header
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef MemoryDisplay_h
+#define MemoryDisplay_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <DevCfg.h>
+#include "Interfaces/IDisplay.h"
+
+// *****************************************************************************
+// ***   MemoryDisplay   *******************************************************
+// *****************************************************************************
+// * Display that stores image in memory buffer instead of sending it to panel.
+// * Can be used to run display subsystem without hardware, to capture screen
+// * content(PPM dump, CRC for comparison with golden image) and to count
+// * transfers made by display driver.
+class MemoryDisplay : public IDisplay
+{
+  public:
+    // *************************************************************************
+    // ***   Public: Constructor   *********************************************
+    // *************************************************************************
+    // * Buffer should have space for in_width * in_height pixels.
+    explicit MemoryDisplay(int32_t in_width, int32_t in_height, color_t* in_buf) :
+      IDisplay(in_width, in_height, sizeof(color_t)), buf(in_buf) {};
+
+    // *************************************************************************
+    // ***   Public: Init screen   *********************************************
+    // *************************************************************************
+    virtual Result Init(void);
+
+    // *************************************************************************
+    // ***   Public: Write data stream to memory   *****************************
+    // *************************************************************************
+    virtual Result WriteDataStream(uint8_t* data, uint32_t n);
+
+    // *************************************************************************
+    // ***   Public: Write same color to output window   ***********************
+    // *************************************************************************
+    virtual Result WriteColor(color_t color, uint32_t n);
+
+    // *************************************************************************
+    // ***   Public: Check transfer status  ************************************
+    // *************************************************************************
+    virtual bool IsTransferComplete(void) {return true;}
+
+    // *************************************************************************
+    // ***   Public: Stop transfer   *******************************************
+    // *************************************************************************
+    virtual Result StopTransfer(void) {return Result::RESULT_OK;}
+
+    // *************************************************************************
+    // ***   Public: Set output window   ***************************************
+    // *************************************************************************
+    virtual Result SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+    // *************************************************************************
+    // ***   Public: Set screen orientation   **********************************
+    // *************************************************************************
+    // * Like panel memory, buffer stays in ROTATION_TOP orientation: pixels
+    // * drawn after rotation are mapped to it, so content drawn before
+    // * rotation isn't changed.
+    virtual Result SetRotation(IDisplay::Rotation r);
+
+    // *************************************************************************
+    // ***   Public: Write color to screen   ***********************************
+    // *************************************************************************
+    virtual Result PushColor(color_t color);
+
+    // *************************************************************************
+    // ***   Public: Draw one pixel on  screen   *******************************
+    // *************************************************************************
+    virtual Result DrawPixel(int16_t x, int16_t y, color_t color);
+
+    // *************************************************************************
+    // ***   Public: Draw vertical line   **************************************
+    // *************************************************************************
+    virtual Result DrawFastVLine(int16_t x, int16_t y, int16_t h, color_t color) {return FillRect(x, y, 1, h, color);}
+
+    // *************************************************************************
+    // ***   Public: Draw horizontal line   ************************************
+    // *************************************************************************
+    virtual Result DrawFastHLine(int16_t x, int16_t y, int16_t w, color_t color) {return FillRect(x, y, w, 1, color);}
+
+    // *************************************************************************
+    // ***   Public: Fill rectangle on screen   ********************************
+    // *************************************************************************
+    virtual Result FillRect(int16_t x, int16_t y, int16_t w, int16_t h, color_t color);
+
+    // *************************************************************************
+    // ***   Public: Invert display   ******************************************
+    // *************************************************************************
+    virtual Result InvertDisplay(bool invert) {inversion = invert; return Result::RESULT_OK;}
+
+    // *************************************************************************
+    // ***   Public: Get pixel color   *****************************************
+    // *************************************************************************
+    // * Coordinates are in ROTATION_TOP orientation, as panel shows image.
+    // * Same for GetPixelRgb(), GetCrc() and SavePpm().
+    color_t GetPixel(int32_t x, int32_t y);
+
+    // *************************************************************************
+    // ***   Public: Get pixel color as 8-bit R, G, B   ************************
+    // *************************************************************************
+    void GetPixelRgb(int32_t x, int32_t y, uint8_t& r, uint8_t& g, uint8_t& b);
+
+    // *************************************************************************
+    // ***   Public: Get CRC of screen content   *******************************
+    // *************************************************************************
+    // * Can be compared with CRC of golden image to check that changes in
+    // * rendering code don't change output.
+    uint32_t GetCrc(void);
+
+    // *************************************************************************
+    // ***   Public: Save screen content to PPM file   *************************
+    // *************************************************************************
+    Result SavePpm(const char* file_name);
+
+    // *************************************************************************
+    // ***   Public: Get number of data transfers   ****************************
+    // *************************************************************************
+    inline uint32_t GetTransfersCnt(void) {return transfers_cnt;}
+
+    // *************************************************************************
+    // ***   Public: Get number of bytes transferred   *************************
+    // *************************************************************************
+    inline uint32_t GetBytesCnt(void) {return bytes_cnt;}
+
+    // *************************************************************************
+    // ***   Public: Get number of address windows set   ***********************
+    // *************************************************************************
+    inline uint32_t GetWindowsCnt(void) {return windows_cnt;}
+
+    // *************************************************************************
+    // ***   Public: Clear counters   ******************************************
+    // *************************************************************************
+    void ClearCounters(void) {transfers_cnt = 0u; bytes_cnt = 0u; windows_cnt = 0u;}
+
+    // *************************************************************************
+    // ***   Public: Convert color to 8-bit R, G, B   **************************
+    // *************************************************************************
+    static void ColorToRgb(color_t color, uint8_t& r, uint8_t& g, uint8_t& b);
+
+  private:
+    // Screen buffer
+    color_t* buf = nullptr;
+    // Address window
+    int32_t win_x0 = 0;
+    int32_t win_y0 = 0;
+    int32_t win_x1 = 0;
+    int32_t win_y1 = 0;
+    // Current position in address window
+    int32_t cur_x = 0;
+    int32_t cur_y = 0;
+    // Inversion
+    bool inversion = false;
+    // Counters
+    uint32_t transfers_cnt = 0u;
+    uint32_t bytes_cnt = 0u;
+    uint32_t windows_cnt = 0u;
+};
+
+#endif
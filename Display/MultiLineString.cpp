@@ -59,7 +59,7 @@ void MultiLineString::SetParams(const char* str, int32_t x, int32_t y, color_t t
   font_ptr = &font;
   transpatent_bg = true;
   line_height = font.GetCharH() * scale + spacing;
-  width = font.GetCharW() * GetLongestLineLength(str) * scale;
+  width = GetLongestLineWidth(str) * scale;
   height = (line_height * GetStringCount(str)) - spacing;
   x_end = x + width - 1;
   y_end = y + height - 1;
@@ -89,7 +89,7 @@ void MultiLineString::SetParams(const char* str, int32_t x, int32_t y, color_t t
   font_ptr = &font;
   transpatent_bg = false;
   line_height = font.GetCharH() * scale + spacing;
-  width = font.GetCharW() * GetLongestLineLength(str) * scale;
+  width = GetLongestLineWidth(str) * scale;
   height = (line_height * GetStringCount(str)) - spacing;
   x_end = x + width - 1;
   y_end = y + height - 1;
@@ -133,7 +133,7 @@ void MultiLineString::SetFont(Font& font)
     // Do changes
     font_ptr = &font;
     line_height = font.GetCharH() * scale + spacing;
-    width = font.GetCharW() * GetLongestLineLength(string) * scale;
+    width = GetLongestLineWidth(string) * scale;
     height = (line_height * GetStringCount(string)) - spacing;
     x_end = x_start + width - 1;
     y_end = y_start + height - 1;
@@ -159,7 +159,7 @@ void MultiLineString::SetScale(uint8_t s)
     // Do changes
     scale = s;
     line_height = GetFontH() * scale + spacing;
-    width = GetFontW() * GetLongestLineLength(string) * scale;
+    width = GetLongestLineWidth(string) * scale;
     height = (line_height * GetStringCount(string)) - spacing;
     x_end = x_start + width - 1;
     y_end = y_start + height - 1;
@@ -212,7 +212,7 @@ void MultiLineString::SetString(const char* str, bool force)
     // Recalculate line height
     line_height = scale * GetFontH() + spacing;
     // Recalculate width
-    width = GetFontW() * GetLongestLineLength(string) * scale;
+    width = GetLongestLineWidth(string) * scale;
     // Recalculate height. Spacing exist between lines only, so there one less spacing than lines.
     height = (line_height * GetStringCount(string)) - spacing;
     // Recalculate y_end
@@ -248,7 +248,7 @@ void MultiLineString::SetString(char* buf, uint32_t len, const char* format, ...
   // Recalculate line height
   line_height = scale * GetFontH() + spacing;
   // Recalculate width
-  width = GetFontW() * GetLongestLineLength(string) * scale;
+  width = GetLongestLineWidth(string) * scale;
   // Recalculate height. Spacing exist between lines only, so there one less spacing than lines.
   height = (line_height * GetStringCount(string)) - spacing;
   // Recalculate y_end
@@ -289,8 +289,6 @@ void MultiLineString::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t
     int32_t x = x_start - start_x;
     // Calculate font line to figure out spacing
     uint32_t font_line = ((line - y_start - line_height * txt_line) / scale);
-    // Number of bytes need skipped for draw line
-    uint32_t skip_bytes = font_line * GetFontBytePerChar() / GetFontH();
     // Pointer to string. Will increment for get characters.
     const char* str = str_ptr;
 
@@ -316,15 +314,15 @@ void MultiLineString::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t
       str_len = GetStringLength(str);
     }
 
+    // Length of text line in pixels
+    int32_t len = font_ptr->GetStringW(str, str_len) * scale;
     // Calculate alignment
     if(alignment == CENTER)
     {
-      int32_t len = str_len * GetFontW() * scale;
       x += (width - len) / 2;
     }
     else if(alignment == RIGHT)
     {
-      int32_t len = str_len * GetFontW() * scale;
       x += width - len;
     }
     else
@@ -332,63 +330,25 @@ void MultiLineString::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t
       ; // Do nothing
     }
 
+    // Visible part of text line, it ends before new line character
+    int32_t start = (x < 0) ? 0 : x;
+    int32_t end = (x + len - 1 >= n) ? (n - 1) : (x + len - 1);
+
     // Process spacing
     if(font_line >= GetFontH())
     {
       if(transpatent_bg == false)
       {
-        // While we have symbols
-        while((*str != '\0') && (*str != '\n'))
+        for(int32_t i = start; i <= end; i++)
         {
-          if((x >= 0) && (x < n))
-          {
-            buf[x++] = bg_color;
-          }
+          buf[i] = bg_color;
         }
       }
     }
     else // Process text
     {
-      // While we have symbols
-      while((*str != '\0') && (*str != '\n'))
-      {
-        uint32_t b = 0;
-        uint32_t w = 0;
-        // Get pointer to character data
-        const uint8_t* char_ptr = font_ptr->GetCharGataPtr(*str);
-        // Get all symbol line
-        for(uint32_t i = 0; i < GetFontBytePerChar() / GetFontH(); i++)
-        {
-          b |= char_ptr[skip_bytes + i] << (i*8);
-        }
-        // Output symbol line
-        while(w < GetFontW())
-        {
-          for(uint8_t i = 0u; i < scale; i++)
-          {
-            // Put color in buffer only if visible
-            if((x >= 0) && (x < n))
-            {
-              if((b&1) == 1)
-              {
-                buf[x] = txt_color;
-              }
-              else if(transpatent_bg == false)
-              {
-                buf[x] = bg_color;
-              }
-              else
-              {
-                // Empty statement
-              }
-            }
-            x++;
-          }
-          b >>= 1;
-          w++;
-        }
-        str++;
-      }
+      font_ptr->DrawStringLine(buf, start, end, x, str, font_line, scale,
+                               txt_color, transpatent_bg ? nullptr : &bg_color);
     }
   }
 }
@@ -398,7 +358,59 @@ void MultiLineString::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t
 // *****************************************************************************
 void MultiLineString::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
-  // Not implemented
+  // Draw only if needed
+  if((row >= x_start) && (row <= x_end) && (string != nullptr) && (font_ptr != nullptr))
+  {
+    // Pointer to string. Will increment for get characters.
+    const char* str = string;
+    // Text line Y position
+    int32_t y = y_start - start_y;
+
+    // Process text lines until end of string or buffer
+    while(y < n)
+    {
+      // Find line length in characters and in pixels
+      uint32_t cnt = GetStringLength(str);
+      int32_t len = font_ptr->GetStringW(str, cnt) * scale;
+      // Column of text line
+      int32_t col = row - x_start;
+      // Calculate alignment
+      if(alignment == CENTER)
+      {
+        col -= (width - len) / 2;
+      }
+      else if(alignment == RIGHT)
+      {
+        col -= width - len;
+      }
+      else
+      {
+        ; // Do nothing
+      }
+      // Draw only if column inside text line
+      if((col >= 0) && (col < len))
+      {
+        // Draw column of text line
+        font_ptr->DrawStringColumn(buf, n, y, str, col, scale,
+                                   txt_color, transpatent_bg ? nullptr : &bg_color);
+        // Process spacing
+        if(transpatent_bg == false)
+        {
+          for(int32_t i = y + GetFontH() * scale; i < y + line_height; i++)
+          {
+            if((i >= 0) && (i < n)) buf[i] = bg_color;
+          }
+        }
+      }
+      // Find end of line
+      str += cnt;
+      // Stop at the end of string
+      if(*str == '\0') break;
+      // Skip new line character
+      str++;
+      y += line_height;
+    }
+  }
 }
 
 // *****************************************************************************
@@ -439,22 +451,23 @@ uint32_t MultiLineString::GetStringLength(const char* str)
 }
 
 // *****************************************************************************
-// ***   Private: GetLongestLineLength   ***************************************
+// ***   Private: GetLongestLineWidth   ****************************************
 // *****************************************************************************
-uint32_t MultiLineString::GetLongestLineLength(const char* str)
+uint32_t MultiLineString::GetLongestLineWidth(const char* str)
 {
-  uint32_t cnt = 0u;
+  uint32_t max_w = 0u;
 
-  if(str != nullptr)
+  if((str != nullptr) && (font_ptr != nullptr))
   {
     while(*str != '\0')
     {
       while(*str == '\n') str++;
       uint32_t len = GetStringLength(str);
-      if(len > cnt) cnt = len;
+      uint32_t w = font_ptr->GetStringW(str, len);
+      if(w > max_w) max_w = w;
       str += len;
     }
   }
 
-  return cnt;
+  return max_w;
 }
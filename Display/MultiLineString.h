@@ -220,9 +220,10 @@ class MultiLineString : public VisObject
     uint32_t GetStringLength(const char* str);
 
     // *************************************************************************
-    // ***   Private: GetLongestLineLength   ***********************************
+    // ***   Private: GetLongestLineWidth   ************************************
     // *************************************************************************
-    uint32_t GetLongestLineLength(const char* str);
+    // * Returns width in pixels(not scaled) of longest line of str.
+    uint32_t GetLongestLineWidth(const char* str);
 };
 
 #endif
@@ -0,0 +1,168 @@
+// *****************************************************************************
+// @file NumFormat.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Number Formatting, implementation
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "NumFormat.h"
+
+// *****************************************************************************
+// ***   Public: Signed decimal   **********************************************
+// *****************************************************************************
+NumFormat::Range NumFormat::Int(char* buf, uint32_t n, int32_t value, uint8_t width, uint8_t flags)
+{
+  // Magnitude is taken in unsigned to handle INT32_MIN
+  uint32_t magnitude = (value < 0) ? (0u - (uint32_t)value) : (uint32_t)value;
+  return Format(buf, n, magnitude, (value < 0), 10u, 0u, width, flags);
+}
+
+// *****************************************************************************
+// ***   Public: Unsigned decimal   ********************************************
+// *****************************************************************************
+NumFormat::Range NumFormat::Uint(char* buf, uint32_t n, uint32_t value, uint8_t width, uint8_t flags)
+{
+  return Format(buf, n, value, false, 10u, 0u, width, flags);
+}
+
+// *****************************************************************************
+// ***   Public: Fixed point decimal   *****************************************
+// *****************************************************************************
+NumFormat::Range NumFormat::Fixed(char* buf, uint32_t n, int32_t value, uint8_t decimals, uint8_t width, uint8_t flags)
+{
+  // Magnitude is taken in unsigned to handle INT32_MIN
+  uint32_t magnitude = (value < 0) ? (0u - (uint32_t)value) : (uint32_t)value;
+  return Format(buf, n, magnitude, (value < 0), 10u, (decimals > MAX_DECIMALS) ? MAX_DECIMALS : decimals, width, flags);
+}
+
+// *****************************************************************************
+// ***   Public: Hexadecimal   *************************************************
+// *****************************************************************************
+NumFormat::Range NumFormat::Hex(char* buf, uint32_t n, uint32_t value, uint8_t width, uint8_t flags)
+{
+  return Format(buf, n, value, false, 16u, 0u, width, flags);
+}
+
+// *****************************************************************************
+// ***   Private: Format number   **********************************************
+// *****************************************************************************
+NumFormat::Range NumFormat::Format(char* buf, uint32_t n, uint32_t value, bool negative, uint32_t base, uint8_t decimals, uint8_t width, uint8_t flags)
+{
+  // Nothing changed yet
+  Range range = {INT32_MAX, -1};
+
+  if((buf != nullptr) && (n != 0u))
+  {
+    // Digits
+    const char* digits = (flags & LOWERCASE) ? "0123456789abcdef" : "0123456789ABCDEF";
+    // Digits and decimal point from last one
+    char tmp[MAX_DIGITS];
+    uint32_t cnt = 0u;
+    // At least one digit before decimal point
+    uint32_t min_cnt = (decimals > 0u) ? (decimals + 2u) : 1u;
+    do
+    {
+      if((decimals > 0u) && (cnt == decimals))
+      {
+        tmp[cnt++] = '.';
+      }
+      else
+      {
+        tmp[cnt++] = digits[value % base];
+        value /= base;
+      }
+    }
+    while((value != 0u) || (cnt < min_cnt));
+
+    // Sign character
+    char sign = negative ? '-' : ((flags & SIGN) ? '+' : '\0');
+    // Prefix for hexadecimal numbers
+    bool prefix = (base == 16u) && (flags & PREFIX);
+    // Number of padding characters
+    int32_t pad = (int32_t)width - (int32_t)cnt - ((sign != '\0') ? 1 : 0) - (prefix ? 2 : 0);
+
+    // Length of old string
+    uint32_t old_len = 0u;
+    while((old_len < n - 1u) && (buf[old_len] != '\0')) old_len++;
+
+    // Current position in buffer
+    uint32_t pos = 0u;
+    // Spaces on the left
+    while((pad > 0) && !(flags & (LEFT | ZERO_PAD)))
+    {
+      Put(buf, n, pos, ' ', range);
+      pad--;
+    }
+    // Sign and prefix
+    if(sign != '\0') Put(buf, n, pos, sign, range);
+    if(prefix)
+    {
+      Put(buf, n, pos, '0', range);
+      Put(buf, n, pos, 'x', range);
+    }
+    // Zeros between sign and digits
+    while((pad > 0) && !(flags & LEFT))
+    {
+      Put(buf, n, pos, '0', range);
+      pad--;
+    }
+    // Digits
+    while(cnt > 0u)
+    {
+      cnt--;
+      Put(buf, n, pos, tmp[cnt], range);
+    }
+    // Spaces on the right
+    while(pad > 0)
+    {
+      Put(buf, n, pos, ' ', range);
+      pad--;
+    }
+
+    // Characters between ends of old and new strings changed, bytes after
+    // end of old string can match new characters by chance
+    if(old_len != pos)
+    {
+      if(range.start > (int32_t)MIN(old_len, pos)) range.start = MIN(old_len, pos);
+      if(range.end < (int32_t)MAX(old_len, pos) - 1) range.end = MAX(old_len, pos) - 1u;
+    }
+    // Terminate string
+    buf[pos] = '\0';
+  }
+
+  // Return result
+  return range;
+}
+
+// *****************************************************************************
+// ***   Private: Put character to buffer   ************************************
+// *****************************************************************************
+inline void NumFormat::Put(char* buf, uint32_t n, uint32_t& pos, char ch, Range& range)
+{
+  // Keep space for terminating zero
+  if(pos < n - 1u)
+  {
+    // Write only changed characters
+    if(buf[pos] != ch)
+    {
+      buf[pos] = ch;
+      if(range.start > (int32_t)pos) range.start = pos;
+      range.end = pos;
+    }
+    pos++;
+  }
+}
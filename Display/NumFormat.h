@@ -0,0 +1,138 @@
+// *****************************************************************************
+// @file NumFormat.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Number Formatting, header
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef NumFormat_h
+#define NumFormat_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <DevCfg.h>
+
+// *****************************************************************************
+// ***   NumFormat   ***********************************************************
+// *****************************************************************************
+// * Formats numbers to string buffers without vsnprintf(): no varargs, no
+// * locale, no heap and only few bytes of stack. Characters are written to
+// * buffer only if they differ from characters already there and range of
+// * changed characters is returned, so text objects can invalidate only it.
+// * Buffer should contain string(can be empty) before call. As snprintf(),
+// * functions write at most n - 1 characters and terminate string.
+class NumFormat
+{
+  public:
+    // *************************************************************************
+    // ***   Format flags   ****************************************************
+    // *************************************************************************
+    enum Flags : uint8_t
+    {
+      NONE      = 0x00u, // Pad with spaces on the left
+      SIGN      = 0x01u, // Put '+' before positive numbers and zero
+      ZERO_PAD  = 0x02u, // Pad with zeros between sign and digits
+      LEFT      = 0x04u, // Pad with spaces on the right
+      PREFIX    = 0x08u, // Put "0x" before hexadecimal digits
+      LOWERCASE = 0x10u  // Use lowercase hexadecimal digits
+    };
+
+    // *************************************************************************
+    // ***   Range of changed characters   *************************************
+    // *************************************************************************
+    // * Start is greater than end if nothing changed.
+    struct Range
+    {
+      int32_t start;
+      int32_t end;
+    };
+
+    // *************************************************************************
+    // ***   Public: Signed decimal   ******************************************
+    // *************************************************************************
+    // * Result takes at least width characters.
+    static Range Int(char* buf, uint32_t n, int32_t value, uint8_t width = 0u, uint8_t flags = NONE);
+
+    // *************************************************************************
+    // ***   Public: Unsigned decimal   ****************************************
+    // *************************************************************************
+    static Range Uint(char* buf, uint32_t n, uint32_t value, uint8_t width = 0u, uint8_t flags = NONE);
+
+    // *************************************************************************
+    // ***   Public: Fixed point decimal   *************************************
+    // *************************************************************************
+    // * Value is in units of 10^-decimals: Fixed(buf, n, -297, 1) gives "-29.7".
+    // * Up to 9 decimals are printed.
+    static Range Fixed(char* buf, uint32_t n, int32_t value, uint8_t decimals, uint8_t width = 0u, uint8_t flags = NONE);
+
+    // *************************************************************************
+    // ***   Public: Hexadecimal   *********************************************
+    // *************************************************************************
+    // * Zeros fill width with ZERO_PAD: Hex(buf, n, 0xAB, 4, ZERO_PAD) gives
+    // * "00AB".
+    static Range Hex(char* buf, uint32_t n, uint32_t value, uint8_t width = 0u, uint8_t flags = NONE);
+
+  private:
+    // Maximum number of digits and decimal point
+    static const uint32_t MAX_DIGITS = 12u;
+    // Maximum number of decimals
+    static const uint8_t MAX_DECIMALS = 9u;
+
+    // *************************************************************************
+    // ***   Private: Format number   ******************************************
+    // *************************************************************************
+    // * Value is magnitude, decimal point is put before last decimals digits.
+    static Range Format(char* buf, uint32_t n, uint32_t value, bool negative, uint32_t base, uint8_t decimals, uint8_t width, uint8_t flags);
+
+    // *************************************************************************
+    // ***   Private: Put character to buffer   ********************************
+    // *************************************************************************
+    static inline void Put(char* buf, uint32_t n, uint32_t& pos, char ch, Range& range);
+};
+
+#endif
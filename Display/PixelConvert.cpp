@@ -0,0 +1,152 @@
+// *****************************************************************************
+// @file PixelConvert.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Pixel Format Conversion, implementation
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "PixelConvert.h"
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// Word at a time kernels rely on byte order of loaded words
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define PIXEL_CONVERT_SWAR
+#endif
+
+// *****************************************************************************
+// ***   Public: Expand RGB565 to RGB888   *************************************
+// *****************************************************************************
+void PixelConvert::Rgb565ToRgb888(uint8_t* data, uint32_t n)
+{
+  // Data expands, so conversion goes from the end to not overwrite source
+  uint32_t i = n;
+  // Last pixel if number of pixels is odd
+  if(i & 1u)
+  {
+    i--;
+    uint8_t hi = data[i*2u];
+    uint8_t lo = data[i*2u+1u];
+    data[i*3u+0u] = hi & 0xF8u;
+    data[i*3u+1u] = ((hi & 0x07u) << 5u) | ((lo & 0xE0u) >> 3u);
+    data[i*3u+2u] = (lo & 0x1Fu) << 3u;
+  }
+#if defined(PIXEL_CONVERT_SWAR)
+  // Two pixels per word: A in bytes 0..1, B in bytes 2..3
+  while(i != 0u)
+  {
+    i -= 2u;
+    uint32_t w = Load32(&data[i*2u]);
+    // Each component of pixel A in byte 0 and of pixel B in byte 2
+    uint32_t r = w & 0x00F800F8u;
+    uint32_t g = ((w << 5u) & 0x00E000E0u) | ((w >> 11u) & 0x001C001Cu);
+    uint32_t b = (w >> 5u) & 0x00F800F8u;
+    // Output: R(A), G(A), B(A), R(B), G(B), B(B)
+    Store16(&data[i*3u+4u], (uint16_t)((g >> 16u) | ((b >> 8u) & 0xFF00u)));
+    Store32(&data[i*3u], (r & 0xFFu) | ((g & 0xFFu) << 8u) | ((b & 0xFFu) << 16u) | ((r & 0x00FF0000u) << 8u));
+  }
+#else
+  while(i != 0u)
+  {
+    i--;
+    uint8_t hi = data[i*2u];
+    uint8_t lo = data[i*2u+1u];
+    data[i*3u+2u] = (lo & 0x1Fu) << 3u;
+    data[i*3u+1u] = ((hi & 0x07u) << 5u) | ((lo & 0xE0u) >> 3u);
+    data[i*3u+0u] = hi & 0xF8u;
+  }
+#endif
+}
+
+// *****************************************************************************
+// ***   Public: Pack 32-bit pixels to 24-bit   ********************************
+// *****************************************************************************
+void PixelConvert::Rgb888xToRgb888(uint8_t* data, uint32_t n)
+{
+  // Data shrinks, so conversion goes from the start
+  uint32_t i = 0u;
+#if defined(PIXEL_CONVERT_SWAR)
+  // Four pixels in three words
+  for(; i + 4u <= n; i += 4u)
+  {
+    uint32_t p0 = Load32(&data[i*4u+0u]);
+    uint32_t p1 = Load32(&data[i*4u+4u]);
+    uint32_t p2 = Load32(&data[i*4u+8u]);
+    uint32_t p3 = Load32(&data[i*4u+12u]);
+    Store32(&data[i*3u+0u], (p0 & 0x00FFFFFFu) | (p1 << 24u));
+    Store32(&data[i*3u+4u], ((p1 >> 8u) & 0x0000FFFFu) | (p2 << 16u));
+    Store32(&data[i*3u+8u], ((p2 >> 16u) & 0x000000FFu) | (p3 << 8u));
+  }
+#endif
+  // Remaining pixels
+  for(; i < n; i++)
+  {
+    data[i*3u+0u] = data[i*4u+0u];
+    data[i*3u+1u] = data[i*4u+1u];
+    data[i*3u+2u] = data[i*4u+2u];
+  }
+}
+
+// *****************************************************************************
+// ***   Public: Pack two 3-bit pixels in one byte   ***************************
+// *****************************************************************************
+void PixelConvert::Rgb3BitPack(uint8_t* data, uint32_t n)
+{
+  // Data shrinks, so conversion goes from the start
+  uint32_t i = 0u;
+#if defined(PIXEL_CONVERT_SWAR)
+  // Eight pixels in two words give four bytes
+  for(; i + 8u <= n; i += 8u)
+  {
+    uint32_t w0 = Load32(&data[i+0u]) & 0x07070707u;
+    uint32_t w1 = Load32(&data[i+4u]) & 0x07070707u;
+    // Bytes 0 and 2 get first pixel in bits 5..3 and second in bits 2..0
+    w0 = (w0 << 3u) | (w0 >> 8u);
+    w1 = (w1 << 3u) | (w1 >> 8u);
+    Store32(&data[i/2u], (w0 & 0xFFu) | ((w0 >> 8u) & 0xFF00u) | ((w1 & 0xFFu) << 16u) | ((w1 << 8u) & 0xFF000000u));
+  }
+#endif
+  // Remaining pixels
+  for(; i + 2u <= n; i += 2u)
+  {
+    data[i/2u] = ((data[i] & 0x07u) << 3u) | (data[i+1u] & 0x07u);
+  }
+}
+
+// *****************************************************************************
+// ***   Public: Swap bytes of 16-bit pixels   *********************************
+// *****************************************************************************
+void PixelConvert::SwapBytes16(uint8_t* data, uint32_t n)
+{
+  uint32_t i = 0u;
+#if defined(PIXEL_CONVERT_SWAR)
+  // Two pixels per word
+  for(; i + 2u <= n; i += 2u)
+  {
+    uint32_t w = Load32(&data[i*2u]);
+    Store32(&data[i*2u], ((w & 0x00FF00FFu) << 8u) | ((w >> 8u) & 0x00FF00FFu));
+  }
+#endif
+  // Remaining pixels
+  for(; i < n; i++)
+  {
+    uint8_t tmp = data[i*2u];
+    data[i*2u] = data[i*2u+1u];
+    data[i*2u+1u] = tmp;
+  }
+}
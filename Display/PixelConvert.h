@@ -0,0 +1,116 @@
+// *****************************************************************************
+// @file PixelConvert.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Pixel Format Conversion, header
+//
+// @section COPYRIGHT
+//
+//  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//  All rights reserved.
+//
+// @section LICENSE
+//
+//  SPDX-License-Identifier: BSD-3-Clause
+//
+//  Software License Agreement (BSD 3-Clause License)
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//  3. Neither the name of Devtronic nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+//  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef PixelConvert_h
+#define PixelConvert_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <DevCfg.h>
+
+#include <cstring>
+
+// *****************************************************************************
+// ***   PixelConvert   ********************************************************
+// *****************************************************************************
+// * In place conversion of display data stream to formats required by display
+// * controllers. Used by IDisplay::PrepareData() implementations. Data is
+// * processed word at a time(SWAR) on little-endian CPUs and byte at a time on
+// * others. Buffers don't have to be aligned.
+class PixelConvert
+{
+  public:
+    // *************************************************************************
+    // ***   Public: Expand RGB565 to RGB888   *********************************
+    // *************************************************************************
+    // * Source is n pixels of RGB565 with high byte first(as color_t in memory
+    // * for COLOR_16BIT), result is n pixels of R, G, B bytes with low bits set
+    // * to zero. Buffer should have space for n * 3 bytes.
+    static void Rgb565ToRgb888(uint8_t* data, uint32_t n);
+
+    // *************************************************************************
+    // ***   Public: Pack 32-bit pixels to 24-bit   ****************************
+    // *************************************************************************
+    // * Drops fourth byte of each of n pixels(color_t in memory for
+    // * COLOR_24BIT). Result takes n * 3 bytes.
+    static void Rgb888xToRgb888(uint8_t* data, uint32_t n);
+
+    // *************************************************************************
+    // ***   Public: Pack two 3-bit pixels in one byte   ***********************
+    // *************************************************************************
+    // * Source is n pixels of one byte(color_t for COLOR_3BIT), result is
+    // * n / 2 bytes with first pixel in bits 5..3 and second one in bits 2..0.
+    static void Rgb3BitPack(uint8_t* data, uint32_t n);
+
+    // *************************************************************************
+    // ***   Public: Swap bytes of 16-bit pixels   *****************************
+    // *************************************************************************
+    static void SwapBytes16(uint8_t* data, uint32_t n);
+
+  private:
+    // *************************************************************************
+    // ***   Private: Load word from unaligned address   ***********************
+    // *************************************************************************
+    static inline uint32_t Load32(const uint8_t* ptr) {uint32_t w; memcpy(&w, ptr, sizeof(w)); return w;}
+
+    // *************************************************************************
+    // ***   Private: Store word to unaligned address   ************************
+    // *************************************************************************
+    static inline void Store32(uint8_t* ptr, uint32_t w) {memcpy(ptr, &w, sizeof(w));}
+
+    // *************************************************************************
+    // ***   Private: Store half word to unaligned address   *******************
+    // *************************************************************************
+    static inline void Store16(uint8_t* ptr, uint16_t w) {memcpy(ptr, &w, sizeof(w));}
+};
+
+#endif
@@ -19,6 +19,7 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "Primitives.h"
+#include "AlphaBlend.h"
 
 #include <cstdlib> // for abs()
 
@@ -157,33 +158,40 @@ void Box::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
     // Find start x position
     int32_t end = x_end - start_x;
     // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    if(end >= 0)
     {
-      // If fill or first/last line - must be solid
-      if(fill)
-      {
-        // Prevent buffer overflow
-        if(end >= n) end = n - 1;
-        // Fill the line, start value can't be negative to prevent write in memory before buffer
-        for(int32_t i = (start < 0) ? 0 : start; i <= end; i++) buf[i] = bg_color;
-      }
       // Fill top and bottom border lines (if border exist)
       if((line < y_start + border_width) || (line > y_end - border_width))
       {
         // Prevent buffer overflow
         if(end >= n) end = n - 1;
-        // Fill the line, start value can't be negative to prevent write in memory before buffer
-        for(int32_t i = (start < 0) ? 0 : start; i <= end; i++) buf[i] = color;
+        // Start value can't be negative to prevent write in memory before buffer
+        if(start < 0) start = 0;
+        // Fill the line
+        if(start <= end) AlphaBlend::BlendColor(&buf[start], end - start + 1, color, alpha);
       }
       else
       {
+        // If fill - fill the line between borders. Every pixel must be drawn
+        // once, otherwise translucent box would be blended twice.
+        if(fill)
+        {
+          int32_t fill_start = start + border_width;
+          int32_t fill_end = end - border_width;
+          // Prevent write in memory before buffer
+          if(fill_start < 0) fill_start = 0;
+          // Prevent buffer overflow
+          if(fill_end >= n) fill_end = n - 1;
+          // Fill the line
+          if(fill_start <= fill_end) AlphaBlend::BlendColor(&buf[fill_start], fill_end - fill_start + 1, bg_color, alpha);
+        }
         // Fill left and right borders
         for(int32_t i = 0; i < border_width; i++)
         {
           int32_t front_idx = start + i;
-          int32_t back_idx = (x_end - start_x) - i;
-          if((front_idx >= 0) && (front_idx < n)) buf[front_idx] = color;
-          if((back_idx  >= 0) && (back_idx  < n)) buf[back_idx]  = color;
+          int32_t back_idx = end - i;
+          if((front_idx >= 0) && (front_idx < n)) buf[front_idx] = AlphaBlend::Blend(color, buf[front_idx], alpha);
+          if((back_idx  >= 0) && (back_idx  < n)) buf[back_idx]  = AlphaBlend::Blend(color, buf[back_idx], alpha);
         }
       }
     }
@@ -198,26 +206,46 @@ void Box::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
   // Draw only if needed
   if((row >= x_start) && (row <= x_end))
   {
-    // Find start x position
+    // Find start y position
     int32_t start = y_start - start_y;
-    // Prevent write in memory before buffer
-    if(start < 0) start = 0;
-    // Find start x position
+    // Find end y position
     int32_t end = y_end - start_y;
-    // Prevent buffer overflow
-    if(end >= n) end = n - 1;
     // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    if(end >= 0)
     {
-      // If fill or first/last row - must be solid
-      if(fill || row == x_start || row == x_end)
+      // Fill left and right border rows (if border exist)
+      if((row < x_start + border_width) || (row > x_end - border_width))
       {
-        for(int32_t i = start; i <= end; i++) buf[i] = color;
+        // Prevent buffer overflow
+        if(end >= n) end = n - 1;
+        // Start value can't be negative to prevent write in memory before buffer
+        if(start < 0) start = 0;
+        // Fill the row
+        if(start <= end) AlphaBlend::BlendColor(&buf[start], end - start + 1, color, alpha);
       }
       else
       {
-        if(y_start - start_y >= 0) buf[start] = color;
-        if(y_end   - start_y <  n) buf[end]   = color;
+        // If fill - fill the row between borders. Every pixel must be drawn
+        // once, otherwise translucent box would be blended twice.
+        if(fill)
+        {
+          int32_t fill_start = start + border_width;
+          int32_t fill_end = end - border_width;
+          // Prevent write in memory before buffer
+          if(fill_start < 0) fill_start = 0;
+          // Prevent buffer overflow
+          if(fill_end >= n) fill_end = n - 1;
+          // Fill the row
+          if(fill_start <= fill_end) AlphaBlend::BlendColor(&buf[fill_start], fill_end - fill_start + 1, bg_color, alpha);
+        }
+        // Fill top and bottom borders
+        for(int32_t i = 0; i < border_width; i++)
+        {
+          int32_t front_idx = start + i;
+          int32_t back_idx = end - i;
+          if((front_idx >= 0) && (front_idx < n)) buf[front_idx] = AlphaBlend::Blend(color, buf[front_idx], alpha);
+          if((back_idx  >= 0) && (back_idx  < n)) buf[back_idx]  = AlphaBlend::Blend(color, buf[back_idx], alpha);
+        }
       }
     }
   }
@@ -280,20 +308,8 @@ void ShadowBox::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_
       if(start < 0) start = 0;
       // Prevent buffer overflow
       if(end >= n) end = n - 1;
-      // Fill the line
-      for(int32_t i = start; i <= end; i++)
-      {
-#if defined(COLOR_24BIT)
-        // Convert pointer to uint8_t to process color components individually
-        uint8_t* color = reinterpret_cast<uint8_t*>(&buf[i]);
-        // Process shadow
-        color[0u] /= 2;
-        color[1u] /= 2;
-        color[2u] /= 2;
-#elif defined(COLOR_16BIT)
-        /// TODO: Implement 16 bit shadow processing
-#endif
-      }
+      // Darken the line
+      if(start <= end) AlphaBlend::BlendColor(&buf[start], end - start + 1, COLOR_BLACK, alpha);
     }
   }
 }
@@ -315,17 +331,10 @@ void ShadowBox::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
     // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    if(end >= 0)
     {
-      for(int32_t i = start; i <= end; i++)
-      {
-        // Convert pointer to uint8_t to process color components individually
-        uint8_t* color = reinterpret_cast<uint8_t*>(&buf[i]);
-        // Process shadow
-        color[0u] /= 2;
-        color[1u] /= 2;
-        color[2u] /= 2;
-      }
+      // Darken the row
+      if(start <= end) AlphaBlend::BlendColor(&buf[start], end - start + 1, COLOR_BLACK, alpha);
     }
   }
 }
@@ -407,22 +416,23 @@ void Line::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
     if(y == line)
     {
       // Go and draw line
-      while(x != end_x)
+      do
       {
         if((x >= 0) && (x < n)) buf[x] = color;
         const int32_t error2 = error * 2;
-        if(error2 > -deltaY) 
+        if(error2 > -deltaY)
         {
           error -= deltaY;
           x += signX;
         }
-        if(error2 < deltaX) 
+        if(error2 < deltaX)
         {
           break;
         }
       }
-      // Draw last dot if x is equal to end_x
-      if((x == end_x) && (x >= 0) && (x < n)) buf[x] = color;
+      while((x != end_x) || (y != y_end));
+      // Draw last dot if line ends in this line
+      if((x == end_x) && (y == y_end) && (x >= 0) && (x < n)) buf[x] = color;
     }
   }
 }
@@ -433,7 +443,7 @@ void Line::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 void Line::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
   // Draw only if needed
-  if((row >= x_start) && (row <= x_end))
+  if(((row >= x_start) && (row <= x_end)) || ((row >= x_end) && (row <= x_start)))
   {
     const int32_t deltaX = abs(y_end - y_start);
     const int32_t deltaY = abs(x_end - x_start);
@@ -480,6 +490,8 @@ void Line::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
         }
       }
       while((x != end_x) || (y != x_end));
+      // Draw last dot if line ends in this row
+      if((x == end_x) && (y == x_end) && (x >= 0) && (x < n)) buf[x] = color;
     }
   }
 }
@@ -550,89 +562,7 @@ void Circle::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
   // Draw only if needed
   if((line >= y_start) && (line <= y_end))
   {
-    // We draw circle with center in 0,0 coordinates, those two variables to
-    // calculate actual position
-    int32_t x0 = x_start + radius - start_x;
-    int32_t y0 = y_start + radius;
-    // Variable for calculations, both for two branches
-    int32_t t1 = radius >> 4;
-
-    // Calculate point to chose algorithm. In this point X equal Y(if circle
-    // center in 0,0 point). To calculate it we can use formula: Y = R / sqrt(2);
-    // To avoid square root calculations we can precalculate it: Y = R / 1.4142;
-    // We can replace division by multiplication on 1 / 1.4142: Y = R * 0.7071;
-    // We also need point coordinate from the top of the circle, not from center,
-    // so we need multiply R by 1 - 0.7071: Y = R * 0.2929;
-    // Integer operations calculates faster than float point one, so we can
-    // multiply radius by 2929 instead and then divide it by 10000:
-    // int32_t shift = (radius * 2928) / 10000;
-    // However, we can do better than that. We don't need to use base 10, we can
-    // use base 2. In this case we can multiply radius by 0.2929 * 16384,
-    // or ~4799, then we can divide result by 16384. But because it is power
-    // of 2 number, we can replace division operation by shift operation:
-    int32_t shift = (radius * 4799) >> 14;
-
-    // Top and bottom half of circle(on Y axis)
-    if((line <= y_start + shift) || (line >= y_end - shift - (even ? 1 : 0)))
-    {
-      // X and Y variables
-      int32_t x = 0;
-      int32_t y = radius;
-      // Flag to break the cycle when no more new dots draw
-      bool line_drawed = false;
-      // Calculate cycle
-      while(y >= x)
-      {
-        if((y0 + y == (even ? line + 1 : line)) || (y0 - y == line))
-        {
-          // Update buffer
-          UpdateBuffer(buf, n, x0 - x, x0 + x);
-          // We need this flag because for non-filled circle we draw one pixel
-          // at a time and we may enter this section again and again until we
-          // move to the next line ...
-          line_drawed = true;
-        }
-        else
-        {
-          // ... at which point we have to break the cycle
-          if(line_drawed == true) break;
-        }
-        // Circle calculation: Jesko's Method
-        x++;
-        t1 += x;
-        int32_t t2 = t1 - y;
-        if(t2 >= 0)
-        {
-          t1 = t2;
-          y--;
-        }
-      }
-    }
-    else // Two middle half of circle(on Y axis)
-    {
-      int32_t x = radius;
-      int32_t y = 0;
-      // Calculate cycle
-      while(x >= y)
-      {
-        if((y0 + y == (even ? line + 1 : line)) || (y0 - y == line))
-        {
-          // Update buffer
-          UpdateBuffer(buf, n, x0 - x, x0 + x);
-          // We know for sure, that Y will change at this point, so just break the cycle
-          break;
-        }
-        // Circle calculation: Jesko's Method
-        y++;
-        t1 += y;
-        int32_t t2 = t1 - x;
-        if(t2 >= 0)
-        {
-          t1 = t2;
-          x--;
-        }
-      }
-    }
+    DrawLine(buf, n, line, y_start, y_end, x_start + radius - start_x);
   }
 }
 
@@ -641,20 +571,99 @@ void Circle::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 // *****************************************************************************
 void Circle::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
+  // Draw only if needed. Circle is symmetric, so row can be drawn by the same
+  // algorithm as line with swapped axes.
   if((row >= x_start) && (row <= x_end))
   {
-    // Find start x position
-    int32_t start = y_start - start_y;
-    // Prevent write in memory before buffer
-    if(start < 0) start = 0;
-    // Find start x position
-    int32_t end = y_end - start_y;
-    // Prevent buffer overflow
-    if(end > n) end = n;
-    // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    DrawLine(buf, n, row, x_start, x_end, y_start + radius - start_y);
+  }
+}
+
+// *****************************************************************************
+// ***   Put line or row of circle in buffer   *********************************
+// *****************************************************************************
+void Circle::DrawLine(color_t* buf, int32_t n, int32_t line, int32_t line_start, int32_t line_end, int32_t x0)
+{
+  // We draw circle with center in 0,0 coordinates, find line coordinate of
+  // circle center to calculate actual position
+  int32_t y0 = line_start + radius;
+  // Variable for calculations, both for two branches
+  int32_t t1 = radius >> 4;
+
+  // Calculate point to chose algorithm. In this point X equal Y(if circle
+  // center in 0,0 point). To calculate it we can use formula: Y = R / sqrt(2);
+  // To avoid square root calculations we can precalculate it: Y = R / 1.4142;
+  // We can replace division by multiplication on 1 / 1.4142: Y = R * 0.7071;
+  // We also need point coordinate from the top of the circle, not from center,
+  // so we need multiply R by 1 - 0.7071: Y = R * 0.2929;
+  // Integer operations calculates faster than float point one, so we can
+  // multiply radius by 2929 instead and then divide it by 10000:
+  // int32_t shift = (radius * 2928) / 10000;
+  // However, we can do better than that. We don't need to use base 10, we can
+  // use base 2. In this case we can multiply radius by 0.2929 * 16384,
+  // or ~4799, then we can divide result by 16384. But because it is power
+  // of 2 number, we can replace division operation by shift operation:
+  int32_t shift = (radius * 4799) >> 14;
+
+  // Top and bottom half of circle(on Y axis)
+  if((line <= line_start + shift) || (line >= line_end - shift - (even ? 1 : 0)))
+  {
+    // X and Y variables
+    int32_t x = 0;
+    int32_t y = radius;
+    // Flag to break the cycle when no more new dots draw
+    bool line_drawed = false;
+    // Calculate cycle
+    while(y >= x)
     {
-      for(int32_t i = start; i < end; i++) buf[i] = color;
+      if((y0 + y == (even ? line + 1 : line)) || (y0 - y == line))
+      {
+        // Update buffer
+        UpdateBuffer(buf, n, x0 - x, x0 + x);
+        // We need this flag because for non-filled circle we draw one pixel
+        // at a time and we may enter this section again and again until we
+        // move to the next line ...
+        line_drawed = true;
+      }
+      else
+      {
+        // ... at which point we have to break the cycle
+        if(line_drawed == true) break;
+      }
+      // Circle calculation: Jesko's Method
+      x++;
+      t1 += x;
+      int32_t t2 = t1 - y;
+      if(t2 >= 0)
+      {
+        t1 = t2;
+        y--;
+      }
+    }
+  }
+  else // Two middle half of circle(on Y axis)
+  {
+    int32_t x = radius;
+    int32_t y = 0;
+    // Calculate cycle
+    while(x >= y)
+    {
+      if((y0 + y == (even ? line + 1 : line)) || (y0 - y == line))
+      {
+        // Update buffer
+        UpdateBuffer(buf, n, x0 - x, x0 + x);
+        // We know for sure, that Y will change at this point, so just break the cycle
+        break;
+      }
+      // Circle calculation: Jesko's Method
+      y++;
+      t1 += y;
+      int32_t t2 = t1 - x;
+      if(t2 >= 0)
+      {
+        t1 = t2;
+        x--;
+      }
     }
   }
 }
@@ -675,8 +684,10 @@ void Circle::UpdateBuffer(color_t* buf, int32_t n, int32_t xl, int32_t xr)
   }
   else
   {
-    if((xl > 0) && (xl < n)) buf[xl] = color;
-    if((xr > 0) && (xr < n)) buf[even ? xr - 1 : xr] = color;
+    // Even circle is one pixel narrower
+    if(even) xr--;
+    if((xl >= 0) && (xl < n)) buf[xl] = color;
+    if((xr >= 0) && (xr < n)) buf[xr] = color;
   }
 }
 
@@ -739,8 +750,8 @@ void Triangle::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x
   // Draw only if needed
   if((line >= y_start) && (line <= y_end))
   {
-    int32_t x_min = 10000;
-    int32_t x_max = -1;
+    int32_t x_min = INT32_MAX;
+    int32_t x_max = INT32_MIN;
     // Find minimum and maximum x for given screen line
     for(uint8_t i = 0u; i < 3u; i++)
     {
@@ -779,14 +790,16 @@ void Triangle::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x
           // Go and draw line
           do
           {
-            if((x >= 0) && (x < n))
+            if(fill == false)
             {
-              if(fill == false) buf[x] = color;
-              else
-              {
-                x_min = x_min > x ? x : x_min;
-                x_max = x_max < x ? x : x_max;
-              }
+              if((x >= 0) && (x < n)) buf[x] = color;
+            }
+            else
+            {
+              // Store all points, line between them can be visible even if
+              // points itself outside buffer
+              x_min = x_min > x ? x : x_min;
+              x_max = x_max < x ? x : x_max;
             }
             const int32_t error2 = error * 2;
             if(error2 > -deltaY) 
@@ -805,7 +818,10 @@ void Triangle::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x
     }
     if(fill)
     {
-      for(uint16_t i = x_min; i <= x_max; i++)
+      // Prevent write outside buffer
+      if(x_min < 0) x_min = 0;
+      if(x_max >= n) x_max = n - 1;
+      for(int32_t i = x_min; i <= x_max; i++)
       {
         buf[i] = color;
       }
@@ -818,5 +834,85 @@ void Triangle::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x
 // *****************************************************************************
 void Triangle::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
-  // Not implemented
+  // Draw only if needed
+  if((row >= x_start) && (row <= x_end))
+  {
+    int32_t y_min = INT32_MAX;
+    int32_t y_max = INT32_MIN;
+    // Find minimum and maximum y for given screen row. It is the same as for
+    // line, but with swapped axes.
+    for(uint8_t i = 0u; i < 3u; i++)
+    {
+      // Draw only if needed
+      if(((row >= lines[i].x1) && (row <= lines[i].x2)) || ((row >= lines[i].x2) && (row <= lines[i].x1)))
+      {
+        const int32_t deltaX = abs(lines[i].y2 - lines[i].y1);
+        const int32_t deltaY = abs(lines[i].x2 - lines[i].x1);
+        const int32_t signX = lines[i].y1 < lines[i].y2 ? 1 : -1;
+        const int32_t signY = lines[i].x1 < lines[i].x2 ? 1 : -1;
+
+        int32_t error = deltaX - deltaY;
+
+        int32_t x = lines[i].y1 - start_y;
+        int32_t y = lines[i].x1;
+
+        int32_t end_x = lines[i].y2 - start_y;
+        // Go trough cycle until reach end of line or current row
+        while((x != end_x || y != lines[i].x2) && (y != row))
+        {
+          const int32_t error2 = error * 2;
+          if(error2 > -deltaY)
+          {
+            error -= deltaY;
+            x += signX;
+          }
+          if(error2 < deltaX)
+          {
+            error += deltaX;
+            y += signY;
+          }
+        }
+        // If we found current row
+        if(y == row)
+        {
+          // Go and draw row
+          do
+          {
+            if(fill == false)
+            {
+              if((x >= 0) && (x < n)) buf[x] = color;
+            }
+            else
+            {
+              // Store all points, row between them can be visible even if
+              // points itself outside buffer
+              y_min = y_min > x ? x : y_min;
+              y_max = y_max < x ? x : y_max;
+            }
+            const int32_t error2 = error * 2;
+            if(error2 > -deltaY)
+            {
+              error -= deltaY;
+              x += signX;
+            }
+            if(error2 < deltaX)
+            {
+              break;
+            }
+          }
+          while((x != end_x) || (y != lines[i].x2));
+        }
+      }
+    }
+    if(fill)
+    {
+      // Prevent write outside buffer
+      if(y_min < 0) y_min = 0;
+      if(y_max >= n) y_max = n - 1;
+      for(int32_t i = y_min; i <= y_max; i++)
+      {
+        buf[i] = color;
+      }
+    }
+  }
 }
@@ -124,6 +124,11 @@ class Box : public VisObject
     // *************************************************************************
     virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t x = 0);
 
+    // *************************************************************************
+    // ***   IsOpaque   ********************************************************
+    // *************************************************************************
+    virtual bool IsOpaque(void) {return fill && (alpha == 255u);}
+
   private:
     // Box color
     color_t color = COLOR_BLACK;
@@ -138,6 +143,8 @@ class Box : public VisObject
 // *****************************************************************************
 // ***   ShadowBox Class   *****************************************************
 // *****************************************************************************
+// * Draws black with object alpha. Opaque black by default, SetAlpha() turns
+// * it into shadow that darkens pixels under it(128 - half of brightness).
 #if defined(COLOR_24BIT) || defined(COLOR_16BIT) // Shadow box available only for 24 bit or 16 bit color
 class ShadowBox : public VisObject
 {
@@ -253,6 +260,13 @@ class Circle : public VisObject
     // Is box fill ?
     bool fill = false;
 
+    // *************************************************************************
+    // ***   Put line or row of circle in buffer   *****************************
+    // *************************************************************************
+    // * Line coordinate and circle start/end are on axis across buffer, x0 is
+    // * circle center position in buffer.
+    void DrawLine(color_t* buf, int32_t n, int32_t line, int32_t line_start, int32_t line_end, int32_t x0);
+
     // *************************************************************************
     // ***   Place line or two dots in buffer   ********************************
     // *************************************************************************
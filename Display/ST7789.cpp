@@ -46,9 +46,11 @@
 #define CMD_RAMRD   0x2E
 
 #define CMD_PTLAR   0x30
+#define CMD_VSCRDEF 0x33
 #define CMD_TEOFF   0x34
 #define CMD_TEON    0x35
 #define CMD_MADCTL  0x36
+#define CMD_VSCSAD  0x37
 #define CMD_COLMOD  0x3A
 
 #define MADCTL_MY   0x80 // Row Address Order
@@ -92,8 +94,8 @@ Result ST7789::Init(void)
   Delay(5u); // Delay for execute previous command
 
   // Set color mode
-  WriteCommand(CMD_COLMOD);
-  WriteData(0x55); // 16-bit color
+  const uint8_t colmod = 0x55; // 16-bit color
+  WriteCommand(CMD_COLMOD, &colmod, sizeof(colmod));
 
   // Set rotation and configure CMD_MADCTL register
   SetRotation(IDisplay::ROTATION_TOP);
@@ -130,6 +132,36 @@ Result ST7789::WriteDataStream(uint8_t* data, uint32_t n)
   return result;
 }
 
+// *****************************************************************************
+// ***   Public: Write same color to output window   ***************************
+// *****************************************************************************
+Result ST7789::WriteColor(color_t color, uint32_t n)
+{
+  Result result = Result::RESULT_OK;
+  // Pattern buffer, filled only as much as needed
+  color_t buf[DISPLAY_FILL_BUF_PIXELS];
+  uint32_t buf_cnt = (n < DISPLAY_FILL_BUF_PIXELS) ? n : DISPLAY_FILL_BUF_PIXELS;
+  for(uint32_t i = 0u; i < buf_cnt; i++)
+  {
+    buf[i] = color;
+  }
+  // Data
+  display_dc.SetHigh();
+  // Pull down CS
+  display_cs.SetLow();
+  // Send pattern buffer until all pixels are sent
+  while((n != 0u) && result.IsGood())
+  {
+    uint32_t cnt = (n < buf_cnt) ? n : buf_cnt;
+    result = spi.Write((uint8_t*)buf, cnt * sizeof(color_t));
+    n -= cnt;
+  }
+  // Pull up CS
+  display_cs.SetHigh();
+  // Return result
+  return result;
+}
+
 // *****************************************************************************
 // ***   Public: Check SPI transfer status   ***********************************
 // *****************************************************************************
@@ -154,6 +186,15 @@ Result ST7789::StopTransfer(void)
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   Public: Set callback for data stream transfer completion   ************
+// *****************************************************************************
+Result ST7789::SetTransferCompleteCallback(ICallback* callback)
+{
+  // Data stream sent via SPI, so SPI driver reports transfer completion
+  return spi.SetTransferCompleteCallback(callback);
+}
+
 // *****************************************************************************
 // ***   Public: Set output window   *******************************************
 // *****************************************************************************
@@ -165,19 +206,16 @@ Result ST7789::SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
   x1 += display_x_start;
   y1 += display_y_start;
 
-  WriteCommand(CMD_CASET); // Column address set
-  WriteData(x0 >> 8);
-  WriteData(x0 & 0xFF); // XSTART 
-  WriteData(x1 >> 8);
-  WriteData(x1 & 0xFF); // XEND
+  // Column and row address parameters
+  uint8_t col[4u] = {(uint8_t)(x0 >> 8), (uint8_t)x0, (uint8_t)(x1 >> 8), (uint8_t)x1};
+  uint8_t row[4u] = {(uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8), (uint8_t)y1};
 
-  WriteCommand(CMD_RASET); // Row address set
-  WriteData(y0 >> 8);
-  WriteData(y0);        // YSTART
-  WriteData(y1 >> 8);
-  WriteData(y1);        // YEND
-
-  WriteCommand(CMD_RAMWR); // write to RAM
+  // Send window setup in one CS cycle
+  display_cs.SetLow(); // Pull down CS
+  SendCommand(CMD_CASET, col, sizeof(col)); // Column address set
+  SendCommand(CMD_RASET, row, sizeof(row)); // Row address set
+  SendCommand(CMD_RAMWR, nullptr, 0u); // Write to RAM
+  display_cs.SetHigh(); // Pull up CS
 
   // Prepare for write data
   display_dc.SetHigh(); // Data
@@ -195,12 +233,14 @@ Result ST7789::SetRotation(IDisplay::Rotation r)
   int32_t col_start = ((320 - init_width) / 2);
   int32_t row_start = ((240 - init_height) / 2);
 
+  // Result
+  Result result = Result::RESULT_OK;
+
   rotation = r;
-  WriteCommand(CMD_MADCTL);
   switch (rotation)
   {
     case IDisplay::ROTATION_TOP:
-      WriteData(MADCTL_MX | MADCTL_MV | MADCTL_RGB);
+      madctl = MADCTL_MX | MADCTL_MV | MADCTL_RGB;
       width  = init_width;
       height = init_height;
       display_x_start = col_start;
@@ -208,7 +248,7 @@ Result ST7789::SetRotation(IDisplay::Rotation r)
       break;
 
     case IDisplay::ROTATION_LEFT:
-      WriteData(MADCTL_MX | MADCTL_MY | MADCTL_RGB);
+      madctl = MADCTL_MX | MADCTL_MY | MADCTL_RGB;
       width  = init_height;
       height = init_width;
       display_x_start = row_start;
@@ -216,7 +256,7 @@ Result ST7789::SetRotation(IDisplay::Rotation r)
       break;
 
     case IDisplay::ROTATION_BOTTOM:
-      WriteData(MADCTL_MY | MADCTL_MV | MADCTL_RGB);
+      madctl = MADCTL_MY | MADCTL_MV | MADCTL_RGB;
       width  = init_width;
       height = init_height;
       display_x_start = col_start;
@@ -224,7 +264,7 @@ Result ST7789::SetRotation(IDisplay::Rotation r)
       break;
 
     case IDisplay::ROTATION_RIGHT:
-      WriteData(MADCTL_MX | MADCTL_RGB);
+      madctl = MADCTL_MX | MADCTL_RGB;
       width  = init_height;
       height = init_width;
       display_x_start = row_start;
@@ -232,10 +272,16 @@ Result ST7789::SetRotation(IDisplay::Rotation r)
       break;
 
     default:
+      result = Result::ERR_BAD_PARAMETER;
       break;
   }
-  // Always Ok
-  return Result::RESULT_OK;
+  // Set Memory Access Control register
+  if(result.IsGood())
+  {
+    WriteCommand(CMD_MADCTL, &madctl, sizeof(madctl));
+  }
+  // Return result
+  return result;
 }
 
 // *****************************************************************************
@@ -273,21 +319,13 @@ Result ST7789::DrawPixel(int16_t x, int16_t y, color_t color)
 Result ST7789::DrawFastVLine(int16_t x, int16_t y, int16_t h, color_t color)
 {
   // Rudimentary clipping
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (h > 0))
   {
     if((y+h-1) >= height) h = height-y;
 
     SetAddrWindow(x, y, x, y+h-1);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    while(h--)
-    {
-      spi.Write(&clr, sizeof(clr));
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of line
+    WriteColor(color, h);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -298,21 +336,13 @@ Result ST7789::DrawFastVLine(int16_t x, int16_t y, int16_t h, color_t color)
 // *****************************************************************************
 Result ST7789::DrawFastHLine(int16_t x, int16_t y, int16_t w, color_t color)
 {
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (w > 0))
   {
     if((x+w-1) >= width)  w = width-x;
 
     SetAddrWindow(x, y, x+w-1, y);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    while(w--)
-    {
-      spi.Write(&clr, sizeof(clr));
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of line
+    WriteColor(color, w);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -323,25 +353,14 @@ Result ST7789::DrawFastHLine(int16_t x, int16_t y, int16_t w, color_t color)
 // *****************************************************************************
 Result ST7789::FillRect(int16_t x, int16_t y, int16_t w, int16_t h, color_t color)
 {
-  if((x < width) && (y < height))
+  if((x < width) && (y < height) && (w > 0) && (h > 0))
   {
     if((x + w - 1) >= width)  w = width  - x;
     if((y + h - 1) >= height) h = height - y;
 
     SetAddrWindow(x, y, x+w-1, y+h-1);
-
-    // Swap bytes
-    uint8_t clr = ((color >> 8) & 0x00FF) | ((color << 8) & 0xFF00);
-
-    display_cs.SetLow(); // Pull down CS
-    for(y = h; y > 0; y--)
-    {
-      for(x = w; x > 0; x--)
-      {
-        spi.Write(&clr, sizeof(clr));
-      }
-    }
-    display_cs.SetHigh(); // Pull up CS
+    // Send color for all pixels of rectangle
+    WriteColor(color, w * h);
   }
   // Always Ok
   return Result::RESULT_OK;
@@ -357,6 +376,74 @@ Result ST7789::InvertDisplay(bool invert)
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   Public: Set vertical scroll area   ************************************
+// *****************************************************************************
+Result ST7789::SetScrollArea(uint16_t start, uint16_t end)
+{
+  // Result
+  Result result = Result::ERR_BAD_PARAMETER;
+
+  // Display scrolls memory lines. If rows and columns exchanged, those lines
+  // are columns on the screen.
+  uint16_t len = (madctl & MADCTL_MV) ? width : height;
+  if((start <= end) && (end < len))
+  {
+    // Screen lines to display memory lines, panel can be smaller than controller
+    uint16_t offset = (madctl & MADCTL_MV) ? display_x_start : display_y_start;
+    uint16_t first = start + offset;
+    uint16_t last = end + offset;
+    // If row address order is reversed, screen area is reversed in memory
+    scroll_start = (madctl & MADCTL_MY) ? (GATE_LINES - 1u - last) : first;
+    scroll_size = last - first + 1u;
+    uint16_t bottom = GATE_LINES - scroll_start - scroll_size;
+    // Top fixed area, vertical scrolling area and bottom fixed area
+    uint8_t data[6u] = {(uint8_t)(scroll_start >> 8), (uint8_t)scroll_start,
+                        (uint8_t)(scroll_size >> 8),  (uint8_t)scroll_size,
+                        (uint8_t)(bottom >> 8),       (uint8_t)bottom};
+    WriteCommand(CMD_VSCRDEF, data, sizeof(data));
+    // Start without offset
+    result = SetScrollOffset(0u);
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Set vertical scroll offset   **********************************
+// *****************************************************************************
+Result ST7789::SetScrollOffset(uint16_t offset)
+{
+  // Result
+  Result result = Result::ERR_BAD_PARAMETER;
+
+  // Offset should be inside scroll area
+  if(offset < scroll_size)
+  {
+    // If row address order is reversed, content moves in opposite direction
+    if((madctl & MADCTL_MY) && (offset != 0u))
+    {
+      offset = scroll_size - offset;
+    }
+    // Memory line shown at the start of scroll area
+    uint16_t line = scroll_start + offset;
+    uint8_t data[2u] = {(uint8_t)(line >> 8), (uint8_t)line};
+    WriteCommand(CMD_VSCSAD, data, sizeof(data));
+    // Set result
+    result = Result::RESULT_OK;
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Check if display scrolls along X axis   ***********************
+// *****************************************************************************
+bool ST7789::IsScrollAlongX(void)
+{
+  return ((madctl & MADCTL_MV) != 0u);
+}
+
 // *****************************************************************************
 // ***   Private: Delay in ms    ***********************************************
 // *****************************************************************************
@@ -396,6 +483,31 @@ inline void ST7789::SpiWrite(uint8_t c)
   display_cs.SetHigh(); // Pull up CS
 }
 
+// *****************************************************************************
+// ***   Private: Write command with parameters to SPI   ***********************
+// *****************************************************************************
+void ST7789::WriteCommand(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  display_cs.SetLow(); // Pull down CS
+  SendCommand(c, data, n);
+  display_cs.SetHigh(); // Pull up CS
+}
+
+// *****************************************************************************
+// ***   Private: Send command with parameters   *******************************
+// *****************************************************************************
+inline void ST7789::SendCommand(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  display_dc.SetLow(); // Command
+  spi.Write(&c, sizeof(c));
+  // All parameters sent in one transfer
+  if(n != 0u)
+  {
+    display_dc.SetHigh(); // Data
+    spi.Write((uint8_t*)data, n);
+  }
+}
+
 // *****************************************************************************
 // ***   Private: Send read command ad read result   ***************************
 // *****************************************************************************
@@ -36,7 +36,7 @@ StringAligned::StringAligned(const char* str, alignment_t algnmnt, int32_t x, in
 // *****************************************************************************
 StringAligned::StringAligned(const char* str, alignment_t algnmnt, int32_t x, int32_t y, uint32_t w, color_t tc, color_t bgc, Font& font)
 {
-  SetParams(str, algnmnt, x, y, tc, bgc, font);
+  SetParams(str, algnmnt, x, y, w, tc, bgc, font);
 }
 
 // *****************************************************************************
@@ -179,19 +179,30 @@ void StringAligned::SetString(const char* str, bool force)
   // Lock object for changes
   LockVisObject();
   // Ignore if same string set again
-  if((string != str) || force)
+  if(string != str)
   {
-    // Invalidate area for old string(needed if old string longer than new)
-    InvalidateObjArea();
+    // Old string is still there - invalidate only changed characters
+    InvalidateChangedChars(string, str);
     // Set new pointer to string
     string = str;
     // Since this function accept only pointer to constant string - clear length
     length = 0u;
     // Recalculate size based on font and scale
     RecalculateSize();
-    // Invalidate area for new string(needed if new string longer than old)
+  }
+  else if(force)
+  {
+    // Since this function accept only pointer to constant string - clear length
+    length = 0u;
+    // Recalculate size based on font and scale
+    RecalculateSize();
+    // Invalidate area for new string, it covers old one
     InvalidateObjArea();
   }
+  else
+  {
+    ; // Do nothing
+  }
   // Unlock object after changes
   UnlockVisObject();
 }
@@ -236,36 +247,89 @@ void StringAligned::Printf(const char* format, ...)
   }
 }
 
+// *****************************************************************************
+// ***   SetBuffer   ***********************************************************
+// *****************************************************************************
+void StringAligned::SetBuffer(char* buffer, uint32_t n)
+{
+  if((buffer != nullptr) && (n != 0u))
+  {
+    // Lock object for changes
+    LockVisObject();
+    // Invalidate area for old string
+    InvalidateObjArea();
+    // Set empty string
+    buffer[0u] = '\0';
+    string = buffer;
+    length = n;
+    // Recalculate size based on font and scale
+    RecalculateSize();
+    // Unlock object after changes
+    UnlockVisObject();
+  }
+}
+
+// *****************************************************************************
+// ***   SetNumber   ***********************************************************
+// *****************************************************************************
+void StringAligned::SetNumber(int32_t value, uint8_t width, uint8_t flags)
+{
+  // If we don't have valid buffer - don't do anything
+  if((string != nullptr) && (length != 0u))
+  {
+    // Lock object for changes
+    LockVisObject();
+    // Format number and invalidate changed characters
+    InvalidateChars(NumFormat::Int((char*)string, length, value, width, flags));
+    // Unlock object after changes
+    UnlockVisObject();
+  }
+}
+
+// *****************************************************************************
+// ***   SetFixed   ************************************************************
+// *****************************************************************************
+void StringAligned::SetFixed(int32_t value, uint8_t decimals, uint8_t width, uint8_t flags)
+{
+  // If we don't have valid buffer - don't do anything
+  if((string != nullptr) && (length != 0u))
+  {
+    // Lock object for changes
+    LockVisObject();
+    // Format number and invalidate changed characters
+    InvalidateChars(NumFormat::Fixed((char*)string, length, value, decimals, width, flags));
+    // Unlock object after changes
+    UnlockVisObject();
+  }
+}
+
+// *****************************************************************************
+// ***   SetHex   **************************************************************
+// *****************************************************************************
+void StringAligned::SetHex(uint32_t value, uint8_t width, uint8_t flags)
+{
+  // If we don't have valid buffer - don't do anything
+  if((string != nullptr) && (length != 0u))
+  {
+    // Lock object for changes
+    LockVisObject();
+    // Format number and invalidate changed characters
+    InvalidateChars(NumFormat::Hex((char*)string, length, value, width, flags));
+    // Unlock object after changes
+    UnlockVisObject();
+  }
+}
+
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
 void StringAligned::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 {
-  // Pointer to string. Will increment for get characters. Placed there because
-  // of SetStringPtr() function existence.
-  register const char* str = string;
-
   // Draw only if needed
-  if((line >= y_start) && (line <= y_end) && (str != nullptr) && (font_ptr != nullptr))
+  if((line >= y_start) && (line <= y_end) && (string != nullptr) && (font_ptr != nullptr))
   {
-    // Current symbol X position
-    int32_t x = x_start - start_x;
-    // Number of bytes need skipped for draw line
-    uint32_t skip_bytes = ((line - y_start) / scale) * GetFontBytePerChar() / GetFontH();
-
-    // Calculate alignment
-    if(alignment == CENTER)
-    {
-      x += (width - length_pixels) / 2;
-    }
-    else if(alignment == RIGHT)
-    {
-      x += width - length_pixels;
-    }
-    else
-    {
-      ; // Do nothing
-    }
+    // First symbol X position
+    int32_t x = GetAlignedX(length_pixels) - start_x;
 
     // Find valid visible boundary
     int32_t visible_x_start = x_start - start_x;
@@ -273,46 +337,9 @@ void StringAligned::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t st
     if(visible_x_start < 0) visible_x_start = 0;
     if(visible_x_end >= n) visible_x_end = n - 1;
 
-    // While we have symbols and still didn't reach object end
-    while((*str != '\0') && (x < visible_x_end))
-    {
-      uint32_t b = 0;
-      uint32_t w = 0;
-      // Get pointer to character data
-      const uint8_t* char_ptr = font_ptr->GetCharGataPtr(*str);
-      // Get all symbol line
-      for(uint32_t i = 0; i < GetFontBytePerChar() / GetFontH(); i++)
-      {
-        b |= char_ptr[skip_bytes + i] << (i*8);
-      }
-      // Output symbol line
-      while(w < GetFontW())
-      {
-        for(uint8_t i = 0u; i < scale; i++)
-        {
-          // Put color in buffer only if visible
-          if((x >= visible_x_start) && (x <= visible_x_end))
-          {
-            if((b&1) == 1)
-            {
-              buf[x] = txt_color;
-            }
-            else if(transpatent_bg == false)
-            {
-              buf[x] = bg_color;
-            }
-            else
-            {
-              // Empty statement
-            }
-          }
-          x++;
-        }
-        b >>= 1;
-        w++;
-      }
-      str++;
-    }
+    // Draw line of characters
+    font_ptr->DrawStringLine(buf, visible_x_start, visible_x_end, x, string, (line - y_start) / scale, scale,
+                             txt_color, transpatent_bg ? nullptr : &bg_color);
   }
 }
 
@@ -321,50 +348,15 @@ void StringAligned::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t st
 // *****************************************************************************
 void StringAligned::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
-  // Pointer to string
-  register const char* str = string;
-
   // Draw only if needed
-  if((row >= x_start) && (row <= x_end) && (str != nullptr) && (font_ptr != nullptr))
+  if((row >= x_start) && (row <= x_end) && (string != nullptr) && (font_ptr != nullptr))
   {
-    // Find line in symbol
-    int16_t start = y_start - start_y;
-    // Find line in symbol
-    int16_t line = (row - x_start);
-
-    if(line >= 0)
-    {
-      // Get symbol
-      uint8_t c = str[line / GetFontW()];
-      // Get pointer to character data
-      const uint8_t* char_ptr = font_ptr->GetCharGataPtr(c);
-      // Find line in symbol
-      line %= GetFontW();
-      // Index to symbol in data array
-      uint16_t bytes_per_line = GetFontBytePerChar() / GetFontH();
-      // Get symbols lines
-      for(int32_t i = 0; i < (int32_t)GetFontH(); i++)
-      {
-        if((start+i > 0) && (start+i < n))
-        {
-          // Find byte that contains line data
-          uint8_t b = char_ptr[i * bytes_per_line + line/8u];
-          // Draw a pixel
-          if(b & (1u << (line%8u)))
-          {
-            buf[start+i] = txt_color;
-          }
-          else if(transpatent_bg == false)
-          {
-            buf[start+i] = bg_color;
-          }
-          else
-          {
-            // Empty statement
-          }
-        }
-      }
-    }
+    // Column of string. Font draws nothing for column outside text, except
+    // pixels of glyphs that are wider than their cells.
+    int32_t col = row - GetAlignedX(length_pixels);
+    // Draw column of string
+    font_ptr->DrawStringColumn(buf, n, y_start - start_y, string, col, scale,
+                               txt_color, transpatent_bg ? nullptr : &bg_color);
   }
 }
 
@@ -375,28 +367,143 @@ void StringAligned::SetString(char* buf, uint32_t len, const char* format, va_li
 {
   if((buf != nullptr) && (len != 0u))
   {
-    // Invalidate area for old string(needed if old string longer than new)
-    InvalidateObjArea();
-    // Create string
-    vsnprintf(buf, len, format, arglist);
+    // Old string is in the buffer - create new one aside to compare
+    if((buf == string) && (len <= STRING_DIFF_BUF_SIZE))
+    {
+      char tmp[STRING_DIFF_BUF_SIZE];
+      // Create string
+      vsnprintf(tmp, len, format, arglist);
+      // Invalidate only changed characters
+      InvalidateChangedChars(string, tmp);
+      // Copy new string to buffer
+      memcpy(buf, tmp, strlen(tmp) + 1u);
+    }
+    else if(buf == string)
+    {
+      // Create string
+      vsnprintf(buf, len, format, arglist);
+      // Invalidate area of object, it covers old and new strings
+      InvalidateObjArea();
+    }
+    else
+    {
+      // Create string
+      vsnprintf(buf, len, format, arglist);
+      // Old string is still there - invalidate only changed characters
+      InvalidateChangedChars(string, buf);
+    }
     // Set new pointer to string
     string = buf;
     // Set length to use PrintString() function later
     length = len;
     // Recalculate size based on font and scale
     RecalculateSize();
-    // Invalidate area for new string(needed if new string longer than old)
-    InvalidateObjArea();
   }
 }
 
+// *****************************************************************************
+// ***   Private: InvalidateChangedChars   *************************************
+// *****************************************************************************
+void StringAligned::InvalidateChangedChars(const char* old_str, const char* new_str)
+{
+  // Changed pixels
+  int32_t start = 0;
+  int32_t end = 0;
+  // Without font nothing is drawn, so nothing can change
+  if(font_ptr != nullptr)
+  {
+    // Length of new string in pixels
+    int32_t new_pixels = font_ptr->GetStringW(new_str) * scale;
+    // Compare strings at aligned positions, alignment can shift characters
+    if(font_ptr->FindChangedChars(old_str, GetAlignedX(length_pixels), new_str, GetAlignedX(new_pixels), scale, start, end))
+    {
+      // Characters outside object aren't drawn
+      if(start < x_start) start = x_start;
+      if(end > x_end) end = x_end;
+      // Invalidate changed characters
+      InvalidateObjArea(start, y_start, end, y_end);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: InvalidateChars   ********************************************
+// *****************************************************************************
+void StringAligned::InvalidateChars(const NumFormat::Range& range)
+{
+  // Old position and length of string in pixels
+  int32_t old_x = GetAlignedX(length_pixels);
+  int32_t old_pixels = length_pixels;
+  // Recalculate size based on font and scale
+  RecalculateSize();
+  // Without font nothing is drawn, so nothing can change
+  if((range.start <= range.end) && (font_ptr != nullptr))
+  {
+    // New position of string
+    int32_t new_x = GetAlignedX(length_pixels);
+    // Changed pixels
+    int32_t start = 0;
+    int32_t end = 0;
+    // Pixels that glyphs can draw outside of their cells
+    int32_t left = 0;
+    int32_t right = 0;
+    font_ptr->GetOverhang(left, right);
+    // If string isn't moved by alignment - only changed characters
+    if(old_x == new_x)
+    {
+      font_ptr->GetCharsPixels(string, range.start, range.end, start, end);
+      start = new_x + start * scale;
+      end = new_x + (end + 1) * scale - 1;
+      // If length changed, characters after changed ones moved
+      if(old_pixels != length_pixels) end = new_x + MAX(old_pixels, length_pixels) - 1 + right * scale;
+    }
+    else
+    {
+      // Characters shifted - area of both strings
+      start = MIN(old_x, new_x) - left * scale;
+      end = MAX(old_x + old_pixels, new_x + length_pixels) - 1 + right * scale;
+    }
+    // Characters outside object aren't drawn
+    if(start < x_start) start = x_start;
+    if(end > x_end) end = x_end;
+    // Invalidate changed characters
+    InvalidateObjArea(start, y_start, end, y_end);
+  }
+}
+
+// *****************************************************************************
+// ***   Private: GetAlignedX   ************************************************
+// *****************************************************************************
+int32_t StringAligned::GetAlignedX(int32_t pixels)
+{
+  // First symbol X position
+  int32_t x = x_start;
+
+  // Calculate alignment
+  if(alignment == CENTER)
+  {
+    x += (width - pixels) / 2;
+  }
+  else if(alignment == RIGHT)
+  {
+    x += width - pixels;
+  }
+  else
+  {
+    ; // Do nothing
+  }
+
+  // Return result
+  return x;
+}
+
 // *****************************************************************************
 // ***   Private: RecalculateSize   ********************************************
 // *****************************************************************************
 void StringAligned::RecalculateSize()
 {
   // Calculated string full length in pixels
-  length_pixels = strlen(string) * GetFontW() * scale;
+  length_pixels = ((font_ptr == nullptr) ? 0 : font_ptr->GetStringW(string)) * scale;
   // Calculate height
   height = GetFontH() * scale;
   // Calculate end X and Y
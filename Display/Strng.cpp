@@ -160,19 +160,32 @@ void String::SetString(const char* str, bool force)
   // Lock object for changes
   LockVisObject();
   // Ignore if same string set again
-  if((string != str) || force)
+  if(string != str)
   {
-    // Invalidate area for old string(needed if old string longer than new)
-    InvalidateObjArea();
+    // Old string is still there - invalidate only changed characters
+    InvalidateChangedChars(string, str);
     // Set new pointer to string
     string = str;
     // Since this function accept only pointer to constant string - clear length
     length = 0u;
     // Recalculate size based on string length, font and scale
     RecalculateSize();
+  }
+  else if(force)
+  {
+    // Invalidate area for old string(needed if old string longer than new)
+    InvalidateObjArea();
+    // Since this function accept only pointer to constant string - clear length
+    length = 0u;
+    // Recalculate size based on string length, font and scale
+    RecalculateSize();
     // Invalidate area for new string(needed if new string longer than old)
     InvalidateObjArea();
   }
+  else
+  {
+    ; // Do nothing
+  }
   // Unlock object after changes
   UnlockVisObject();
 }
@@ -217,63 +230,95 @@ void String::Printf(const char* format, ...)
   }
 }
 
+// *****************************************************************************
+// ***   SetBuffer   ***********************************************************
+// *****************************************************************************
+void String::SetBuffer(char* buffer, uint32_t n)
+{
+  if((buffer != nullptr) && (n != 0u))
+  {
+    // Lock object for changes
+    LockVisObject();
+    // Invalidate area for old string
+    InvalidateObjArea();
+    // Set empty string
+    buffer[0u] = '\0';
+    string = buffer;
+    length = n;
+    // Recalculate size based on font and scale
+    RecalculateSize();
+    // Unlock object after changes
+    UnlockVisObject();
+  }
+}
+
+// *****************************************************************************
+// ***   SetNumber   ***********************************************************
+// *****************************************************************************
+void String::SetNumber(int32_t value, uint8_t width, uint8_t flags)
+{
+  // If we don't have valid buffer - don't do anything
+  if((string != nullptr) && (length != 0u))
+  {
+    // Lock object for changes
+    LockVisObject();
+    // Format number and invalidate changed characters
+    InvalidateChars(NumFormat::Int((char*)string, length, value, width, flags));
+    // Unlock object after changes
+    UnlockVisObject();
+  }
+}
+
+// *****************************************************************************
+// ***   SetFixed   ************************************************************
+// *****************************************************************************
+void String::SetFixed(int32_t value, uint8_t decimals, uint8_t width, uint8_t flags)
+{
+  // If we don't have valid buffer - don't do anything
+  if((string != nullptr) && (length != 0u))
+  {
+    // Lock object for changes
+    LockVisObject();
+    // Format number and invalidate changed characters
+    InvalidateChars(NumFormat::Fixed((char*)string, length, value, decimals, width, flags));
+    // Unlock object after changes
+    UnlockVisObject();
+  }
+}
+
+// *****************************************************************************
+// ***   SetHex   **************************************************************
+// *****************************************************************************
+void String::SetHex(uint32_t value, uint8_t width, uint8_t flags)
+{
+  // If we don't have valid buffer - don't do anything
+  if((string != nullptr) && (length != 0u))
+  {
+    // Lock object for changes
+    LockVisObject();
+    // Format number and invalidate changed characters
+    InvalidateChars(NumFormat::Hex((char*)string, length, value, width, flags));
+    // Unlock object after changes
+    UnlockVisObject();
+  }
+}
+
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
 void String::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 {
-  // Pointer to string. Will increment for get characters. Placed there because
-  // of SetStringPtr() function existence.
-  register const char* str = string;
-
   // Draw only if needed
-  if((line >= y_start) && (line <= y_end) && (str != nullptr) && (font_ptr != nullptr))
+  if((line >= y_start) && (line <= y_end) && (string != nullptr) && (font_ptr != nullptr))
   {
-    // Current symbol X position
-    int32_t x = x_start - start_x;
-    // Number of bytes need skipped for draw line
-    uint32_t skip_bytes = ((line - y_start) / scale) * GetFontBytePerChar() / GetFontH();
-
-    // While we have symbols
-    while(*str != '\0')
-    {
-      uint32_t b = 0;
-      uint32_t w = 0;
-      // Get pointer to character data
-      const uint8_t* char_ptr = font_ptr->GetCharGataPtr(*str);
-      // Get all symbol line
-      for(uint32_t i = 0; i < GetFontBytePerChar() / GetFontH(); i++)
-      {
-        b |= char_ptr[skip_bytes + i] << (i*8);
-      }
-      // Output symbol line
-      while(w < GetFontW())
-      {
-        for(uint8_t i = 0u; i < scale; i++)
-        {
-          // Put color in buffer only if visible
-          if((x >= 0) && (x < n))
-          {
-            if((b&1) == 1)
-            {
-              buf[x] = txt_color;
-            }
-            else if(transpatent_bg == false)
-            {
-              buf[x] = bg_color;
-            }
-            else
-            {
-              // Empty statement
-            }
-          }
-          x++;
-        }
-        b >>= 1;
-        w++;
-      }
-      str++;
-    }
+    // Find visible part of string
+    int32_t start = x_start - start_x;
+    if(start < 0) start = 0;
+    int32_t end = x_end - start_x;
+    if(end >= n) end = n - 1;
+    // Draw line of characters
+    font_ptr->DrawStringLine(buf, start, end, x_start - start_x, string, (line - y_start) / scale, scale,
+                             txt_color, transpatent_bg ? nullptr : &bg_color);
   }
 }
 
@@ -282,50 +327,12 @@ void String::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 // *****************************************************************************
 void String::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
-  // Pointer to string
-  register const char* str = string;
-
   // Draw only if needed
-  if((row >= x_start) && (row <= x_end) && (str != nullptr) && (font_ptr != nullptr))
+  if((row >= x_start) && (row <= x_end) && (string != nullptr) && (font_ptr != nullptr))
   {
-    // Find line in symbol
-    int16_t start = y_start - start_y;
-    // Find line in symbol
-    int16_t line = (row - x_start);
-
-    if(line >= 0)
-    {
-      // Get symbol
-      uint8_t c = str[line / GetFontW()];
-      // Get pointer to character data
-      const uint8_t* char_ptr = font_ptr->GetCharGataPtr(c);
-      // Find line in symbol
-      line %= GetFontW();
-      // Index to symbol in data array
-      uint16_t bytes_per_line = GetFontBytePerChar() / GetFontH();
-      // Get symbols lines
-      for(int32_t i = 0; i < (int32_t)GetFontH(); i++)
-      {
-        if((start+i > 0) && (start+i < n))
-        {
-          // Find byte that contains line data
-          uint8_t b = char_ptr[i * bytes_per_line + line/8u];
-          // Draw a pixel
-          if(b & (1u << (line%8u)))
-          {
-            buf[start+i] = txt_color;
-          }
-          else if(transpatent_bg == false)
-          {
-            buf[start+i] = bg_color;
-          }
-          else
-          {
-            // Empty statement
-          }
-        }
-      }
-    }
+    // Draw column of string
+    font_ptr->DrawStringColumn(buf, n, y_start - start_y, string, row - x_start, scale,
+                               txt_color, transpatent_bg ? nullptr : &bg_color);
   }
 }
 
@@ -336,18 +343,86 @@ void String::SetString(char* buf, uint32_t len, const char* format, va_list& arg
 {
   if((buf != nullptr) && (len != 0u))
   {
-    // Invalidate area for old string(needed if old string longer than new)
-    InvalidateObjArea();
-    // Create string
-    vsnprintf(buf, len, format, arglist);
+    // Old string is in the buffer - create new one aside to compare
+    if((buf == string) && (len <= STRING_DIFF_BUF_SIZE))
+    {
+      char tmp[STRING_DIFF_BUF_SIZE];
+      // Create string
+      vsnprintf(tmp, len, format, arglist);
+      // Invalidate only changed characters
+      InvalidateChangedChars(string, tmp);
+      // Copy new string to buffer
+      memcpy(buf, tmp, strlen(tmp) + 1u);
+    }
+    else if(buf == string)
+    {
+      // Invalidate area for old string(needed if old string longer than new)
+      InvalidateObjArea();
+      // Create string
+      vsnprintf(buf, len, format, arglist);
+      // Recalculate size to invalidate area for new string
+      RecalculateSize();
+      // Invalidate area for new string(needed if new string longer than old)
+      InvalidateObjArea();
+    }
+    else
+    {
+      // Create string
+      vsnprintf(buf, len, format, arglist);
+      // Old string is still there - invalidate only changed characters
+      InvalidateChangedChars(string, buf);
+    }
     // Set new pointer to string
     string = buf;
     // Set length to use PrintString() function later
     length = len;
     // Recalculate size based on string length, font and scale
     RecalculateSize();
-    // Invalidate area for new string(needed if new string longer than old)
-    InvalidateObjArea();
+  }
+}
+
+// *****************************************************************************
+// ***   Private: InvalidateChangedChars   *************************************
+// *****************************************************************************
+void String::InvalidateChangedChars(const char* old_str, const char* new_str)
+{
+  // Changed pixels
+  int32_t start = 0;
+  int32_t end = 0;
+  // Without font nothing is drawn, so nothing can change
+  if((font_ptr != nullptr) && font_ptr->FindChangedChars(old_str, x_start, new_str, x_start, scale, start, end))
+  {
+    // Invalidate changed characters
+    InvalidateObjArea(start, y_start, end, y_end);
+  }
+}
+
+// *****************************************************************************
+// ***   Private: InvalidateChars   ********************************************
+// *****************************************************************************
+void String::InvalidateChars(const NumFormat::Range& range)
+{
+  // Old width of string
+  int32_t old_width = width;
+  // Recalculate size based on string length, font and scale
+  RecalculateSize();
+  // Without font nothing is drawn, so nothing can change
+  if((range.start <= range.end) && (font_ptr != nullptr))
+  {
+    // Pixels of changed characters
+    int32_t start = 0;
+    int32_t end = 0;
+    font_ptr->GetCharsPixels(string, range.start, range.end, start, end);
+    start = x_start + start * scale;
+    end = x_start + (end + 1) * scale - 1;
+    // Last pixel of old and new string
+    int32_t last = x_start + MAX(width, old_width) - 1;
+    // If width changed, characters after changed ones moved. Characters
+    // outside object aren't drawn.
+    if((end > last) || (width != old_width)) end = last;
+    if(start < x_start) start = x_start;
+    // Invalidate changed characters
+    InvalidateObjArea(start, y_start, end, y_end);
   }
 }
 
@@ -356,7 +431,7 @@ void String::SetString(char* buf, uint32_t len, const char* format, va_list& arg
 // *****************************************************************************
 void String::RecalculateSize()
 {
-  width = GetFontW() * ((string == nullptr) ? 0 : strlen(string)) * scale;
+  width = ((font_ptr == nullptr) ? 0 : font_ptr->GetStringW(string)) * scale;
   height = GetFontH() * scale;
   x_end = x_start + width - 1;
   y_end = y_start + height - 1;
@@ -59,6 +59,7 @@
 #include "Interfaces/IDisplay.h"
 #include "Display/VisObject.h"
 #include "Display/Font.h"
+#include "Display/NumFormat.h"
 #include "Display/Fonts/Font_4x6.h"
 #include "Display/Fonts/Font_6x8.h"
 #include "Display/Fonts/Font_8x8.h"
@@ -107,6 +108,9 @@ class String : public VisObject
     // *************************************************************************
     // ***   Public: SetString   ***********************************************
     // *************************************************************************
+    // * Only characters that differ from current string are invalidated. If
+    // * content of current string was changed in place, pass it with force to
+    // * invalidate whole string.
     void SetString(const char* str, bool force = false);
 
     // *************************************************************************
@@ -119,6 +123,33 @@ class String : public VisObject
     // *************************************************************************
     void Printf(const char* format, ...);
 
+    // *************************************************************************
+    // ***   Public: SetBuffer   ***********************************************
+    // *************************************************************************
+    // * Sets empty string in buffer of n bytes for SetNumber(), SetFixed(),
+    // * SetHex() and Printf().
+    void SetBuffer(char* buffer, uint32_t n);
+
+    // *************************************************************************
+    // ***   Public: SetNumber   ***********************************************
+    // *************************************************************************
+    // * Formats value to buffer set by SetBuffer() or SetString(buffer, ...)
+    // * without vsnprintf(), see NumFormat for width and flags. Only changed
+    // * characters are written and invalidated.
+    void SetNumber(int32_t value, uint8_t width = 0u, uint8_t flags = NumFormat::NONE);
+
+    // *************************************************************************
+    // ***   Public: SetFixed   ************************************************
+    // *************************************************************************
+    // * Value is in units of 10^-decimals, see SetNumber().
+    void SetFixed(int32_t value, uint8_t decimals, uint8_t width = 0u, uint8_t flags = NumFormat::NONE);
+
+    // *************************************************************************
+    // ***   Public: SetHex   **************************************************
+    // *************************************************************************
+    // * See SetNumber().
+    void SetHex(uint32_t value, uint8_t width = 0u, uint8_t flags = NumFormat::NONE);
+
     // *************************************************************************
     // ***   Public: SetStringPtr   ********************************************
     // *************************************************************************
@@ -195,6 +226,19 @@ class String : public VisObject
     // *************************************************************************
     void SetString(char* buf, uint32_t len, const char* format, va_list& arglist);
 
+    // *************************************************************************
+    // ***   Private: InvalidateChangedChars   *********************************
+    // *************************************************************************
+    // * Invalidates character cells that differ between old_str and new_str,
+    // * old_str should still contain string that is on the screen.
+    void InvalidateChangedChars(const char* old_str, const char* new_str);
+
+    // *************************************************************************
+    // ***   Private: InvalidateChars   ****************************************
+    // *************************************************************************
+    // * Invalidates characters changed in place and recalculates size.
+    void InvalidateChars(const NumFormat::Range& range);
+
     // *************************************************************************
     // ***   Private: RecalculateSize   ****************************************
     // *************************************************************************
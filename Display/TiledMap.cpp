@@ -56,8 +56,8 @@ void TiledMap::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x
     int32_t start = x_start - start_x;
     // Prevent write in memory before buffer
     if(start < 0) start = 0;
-    // Find end x position
-    int32_t end = x_end - start_x;
+    // Find end x position(exclusive)
+    int32_t end = x_end - start_x + 1;
     // Prevent buffer overflow
     if(end > n) end = n;
 
@@ -66,7 +66,8 @@ void TiledMap::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x
     int32_t y_tile_idx = (y_pos + line - y_start) / tile_height;
     int32_t tile_idx = y_tile_idx * map_width + x_tile_idx;
     int32_t x_tile_offset = (x_pos  + start_x) % tile_width;
-    int32_t y_tile_offset = ((y_pos + line - y_start) % tile_height) * tile_width;
+    int32_t tile_line = (y_pos + line - y_start) % tile_height;
+    int32_t y_tile_offset = tile_line * tile_width;
 
     // If default color is 0 or greater
     if(bg_color >= 0)
@@ -81,37 +82,67 @@ void TiledMap::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x
     int32_t pix_idx = start;
     int32_t tile_pix_idx = x_tile_offset;
     // Draw line with tiles
-    while(pix_idx < n)
+    while(pix_idx < end)
     {
       // Get tile value
       uint8_t tile_val = tiles_map[tile_idx] & tile_bitmask;
-      // Skip empty tiles
-      if(tile_val >= tiles_cnt)
+      // Get tile run table and its flags
+      const uint16_t* runs = (tile_val < tiles_cnt) ? tiles_img[tile_val].runs : nullptr;
+      uint16_t flags = (runs != nullptr) ? runs[0u] : 0u;
+      // Count of tile pixels in buffer
+      int32_t cnt = tile_width - tile_pix_idx;
+      if(cnt > end - pix_idx) cnt = end - pix_idx;
+      // Skip empty and fully transparent tiles
+      if((tile_val < tiles_cnt) && !(flags & Image::RUNS_TRANSPARENT))
       {
-        pix_idx += tile_width - tile_pix_idx;
-        tile_idx++;
-        tile_pix_idx = 0;
-        tile_val = tiles_map[tile_idx] & tile_bitmask;
-        continue;
+        // Get pointer to the current tile image
+        const uint8_t* tile_ptr = &tiles_img[tile_val].imgp[y_tile_offset];
+        // Get pointer to the current tile palette
+        const color_t* palette_ptr = tiles_img[tile_val].palette;
+        // Buffer position of the first tile pixel
+        color_t* tile_buf = &buf[pix_idx - tile_pix_idx];
+        if(flags & Image::RUNS_OPAQUE)
+        {
+          // Opaque tile - no need to check transparency
+          for(int32_t x = tile_pix_idx; x < tile_pix_idx + cnt; x++)
+          {
+            tile_buf[x] = palette_ptr[tile_ptr[x]];
+          }
+        }
+        else if(runs != nullptr)
+        {
+          // Draw only runs of the tile line
+          const uint16_t* run = &runs[runs[1u + tile_line]];
+          const uint16_t* run_end = &runs[runs[2u + tile_line]];
+          for(; (run < run_end) && (run[0u] < tile_pix_idx + cnt); run += 2u)
+          {
+            // Clip run by visible part of the tile
+            int32_t x = (run[0u] > tile_pix_idx) ? run[0u] : tile_pix_idx;
+            int32_t x_stop = run[0u] + run[1u];
+            if(x_stop > tile_pix_idx + cnt) x_stop = tile_pix_idx + cnt;
+            for(; x < x_stop; x++)
+            {
+              tile_buf[x] = palette_ptr[tile_ptr[x]];
+            }
+          }
+        }
+        else
+        {
+          // Get transparent color
+          const int32_t transparent_color = tiles_img[tile_val].transparent_color;
+          // Draw tile
+          for(int32_t x = tile_pix_idx; x < tile_pix_idx + cnt; x++)
+          {
+            // Get pixel data
+            color_t data = palette_ptr[tile_ptr[x]];
+            // If not transparent - output to buffer
+            if((int32_t)data != transparent_color) tile_buf[x] = data;
+          }
+        }
       }
-      // Get pointer to the current tile image
-      const uint8_t* tile_ptr = &tiles_img[tile_val].imgp[y_tile_offset];
-      // Get pointer to the current tile palette
-      const color_t* palette_ptr = tiles_img[tile_val].palette;
-      // Get transparent color
-      const int32_t transparent_color = tiles_img[tile_val].transparent_color;
-      // Draw tile
-      for(;(tile_pix_idx < (int32_t)tile_width) && (pix_idx < end); tile_pix_idx++)
-      {
-        // Get pixel data
-        color_t data = palette_ptr[tile_ptr[tile_pix_idx]];
-        // If not transparent - output to buffer
-        if((int32_t)data != transparent_color) buf[pix_idx] = data;
-        pix_idx++; 
-      }
-      // Increase tile index
+      // Move to the next tile in line
+      pix_idx += cnt;
       tile_idx++;
-      // Clear tile pixel counter
       tile_pix_idx = 0;
     }
   }
@@ -122,7 +153,69 @@ void TiledMap::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x
 // *****************************************************************************
 void TiledMap::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
-   // Not implemented yet
+  // Draw only if needed
+  if((row >= x_start) && (row <= x_end))
+  {
+    // Find start y position
+    int32_t start = y_start - start_y;
+    // Prevent write in memory before buffer
+    if(start < 0) start = 0;
+    // Find end y position
+    int32_t end = y_end - start_y;
+    // Prevent buffer overflow
+    if(end >= n) end = n - 1;
+
+    // Find column of tiles and offset inside tile
+    int32_t x_tile_idx = (x_pos + row - x_start) / tile_width;
+    int32_t x_tile_offset = (x_pos + row - x_start) % tile_width;
+    // Find start tile index and line inside tile
+    int32_t y_tile_idx = (y_pos + start_y + start - y_start) / tile_height;
+    int32_t tile_idx = y_tile_idx * map_width + x_tile_idx;
+    int32_t tile_line = (y_pos + start_y + start - y_start) % tile_height;
+
+    // If default color is 0 or greater
+    if(bg_color >= 0)
+    {
+      // Fill buffer by default color
+      for(int32_t i = start; i <= end; i++)
+      {
+        buf[i] = bg_color;
+      }
+    }
+    // Prepare variables for first cycle
+    int32_t pix_idx = start;
+    // Draw column with tiles
+    while(pix_idx <= end)
+    {
+      // Get tile value
+      uint8_t tile_val = tiles_map[tile_idx] & tile_bitmask;
+      // Get tile run table flags
+      const uint16_t* runs = (tile_val < tiles_cnt) ? tiles_img[tile_val].runs : nullptr;
+      uint16_t flags = (runs != nullptr) ? runs[0u] : 0u;
+      // Draw only not empty and not fully transparent tiles
+      if((tile_val < tiles_cnt) && !(flags & Image::RUNS_TRANSPARENT))
+      {
+        // Get pointer to the current tile image column
+        const uint8_t* tile_ptr = &tiles_img[tile_val].imgp[x_tile_offset];
+        // Get pointer to the current tile palette
+        const color_t* palette_ptr = tiles_img[tile_val].palette;
+        // Get transparent color, opaque tile doesn't need check
+        const int32_t transparent_color = (flags & Image::RUNS_OPAQUE) ? -1 : tiles_img[tile_val].transparent_color;
+        // Draw tile column
+        for(int32_t i = pix_idx, y = tile_line; (y < (int32_t)tile_height) && (i <= end); y++, i++)
+        {
+          // Get pixel data
+          color_t data = palette_ptr[tile_ptr[y * tile_width]];
+          // If not transparent - output to buffer
+          if((int32_t)data != transparent_color) buf[i] = data;
+        }
+      }
+      // Move to the next tile in column
+      pix_idx += tile_height - tile_line;
+      tile_idx += map_width;
+      tile_line = 0;
+    }
+  }
 }
 
 // *****************************************************************************
@@ -2,7 +2,7 @@
 // @file UpdateAreaProcessor.h
 // @author Nicolai Shlapunov
 //
-// @details Circular Buffer template class, header
+// @details Update Area Processor template class, header
 //
 // @section COPYRIGHT
 //
@@ -72,13 +72,17 @@ typedef struct UpdateArea
 #if defined(MULTIPLE_UPDATE_AREAS)
 
 // *****************************************************************************
-// ***   Circular Buffer template class   **************************************
+// ***   Update Area Processor template class   ********************************
 // *****************************************************************************
+// * Keeps up to N non-overlapping update areas. Two areas merged only if it is
+// * cheaper to send one window that covers both than two separate ones. Cost
+// * of the window is window_cost plus number of pixels in it. Overlapping areas
+// * that aren't worth merging are split into non-overlapping bands.
 template <int N> class UpdateAreaProcessor
 {
   public:
     // *************************************************************************
-    // ***   Public: FIFO   ****************************************************
+    // ***   Public: UpdateAreaProcessor   *************************************
     // *************************************************************************
     UpdateAreaProcessor()
     {
@@ -87,35 +91,139 @@ template <int N> class UpdateAreaProcessor
     }
 
     // *************************************************************************
-    // ***   Public: ~FIFO   ***************************************************
+    // ***   Public: ~UpdateAreaProcessor   ************************************
     // *************************************************************************
     ~UpdateAreaProcessor() {};
 
+    // *************************************************************************
+    // ***   Public: SetWindowCost   *******************************************
+    // *************************************************************************
+    // * Set overhead of one update window(address window setup, transfer
+    // * start, etc.) in pixels.
+    void SetWindowCost(uint32_t cost) {window_cost = cost;}
+
     // *************************************************************************
     // ***   Public: Push   ****************************************************
     // *************************************************************************
     bool Push(UpdateArea_t& value)
-{
-      // Find empty spot
-      uint32_t idx = GetFirstEmptySpot();
-      // Check if there an empty spot in the list
-      if(idx < N)
+    {
+      // Areas waiting for processing stored in the end of array, starting
+      // from index top. Stored areas are in the beginning of array.
+      uint32_t top = N;
+      // If there no empty spot
+      if(cnt >= N)
       {
-        // Store new value in array
-        array[idx] = value;
+        // Merge two areas with minimal cost increase. New area also counts.
+        uint32_t best_i = 0u;
+        uint32_t best_j = N;
+        int32_t best_cost = INT32_MAX;
+        for(uint32_t i = 0u; i < N; i++)
+        {
+          for(uint32_t j = i + 1u; j <= N; j++)
+          {
+            UpdateArea_t& area_j = (j < N) ? array[j] : value;
+            int32_t cost = (int32_t)GetCost(Union(array[i], area_j)) - (int32_t)GetCost(array[i]) - (int32_t)GetCost(area_j);
+            if(cost < best_cost)
+            {
+              best_cost = cost;
+              best_i = i;
+              best_j = j;
+            }
+          }
+        }
+        // Merged area have to be checked against others again. Areas removed
+        // before storing merged one since last spot used for it.
+        merges_cnt++;
+        if(best_j < N)
+        {
+          UpdateArea_t u = Union(array[best_i], array[best_j]);
+          Remove(best_j); // Remove greater index first
+          Remove(best_i);
+          array[--top] = u;
+          array[--top] = value;
+        }
+        else
+        {
+          UpdateArea_t u = Union(array[best_i], value);
+          Remove(best_i);
+          array[--top] = u;
+        }
+      }
+      else
+      {
+        // Store new area for processing
+        array[--top] = value;
       }
-      else // otherwise
+
+      // Process all areas waiting for processing
+      while(top < N)
       {
-        // Add new area to the first existing one
-        if(value.start_x < array[0].start_x) array[0].start_x = value.start_x;
-        if(value.start_y < array[0].start_y) array[0].start_y = value.start_y;
-        if(value.end_x > array[0].end_x) array[0].end_x = value.end_x;
-        if(value.end_y > array[0].end_y) array[0].end_y = value.end_y;
+        // Get area. It frees spot, so there always space to store it.
+        UpdateArea_t area = array[top++];
+        // Flag that area is already covered by stored ones
+        bool is_covered = false;
+        // Flag that area can be split. Once area merged because there no
+        // space for parts it only can be merged.
+        bool is_split_allowed = true;
+        // Check area against all stored ones
+        uint32_t i = 0u;
+        while(i < cnt)
+        {
+          // If area inside stored one - nothing to do
+          if(IsInside(area, array[i]))
+          {
+            is_covered = true;
+            break;
+          }
+          // Find union of areas
+          UpdateArea_t u = Union(area, array[i]);
+          // Merge areas if one window is cheaper than two. Merged area can't
+          // overlap other stored areas, otherwise split parts can be merged
+          // back over the area they were split around.
+          if((GetCost(u) <= GetCost(area) + GetCost(array[i])) && !IsIntersectOthers(u, i))
+          {
+            Remove(i);
+            area = u;
+            merges_cnt++;
+            // Merged area have to be checked against all stored ones again
+            i = 0u;
+            continue;
+          }
+          // Overlapping areas that isn't worth merging
+          if(IsIntersect(area, array[i]))
+          {
+            // Split area to parts outside of stored one
+            UpdateArea_t parts[4u];
+            uint32_t parts_cnt = is_split_allowed ? Split(area, array[i], parts) : 0u;
+            // If area can be split and there enough space - store parts for
+            // processing
+            if((parts_cnt > 0u) && (parts_cnt <= top - cnt))
+            {
+              for(uint32_t p = 0u; p < parts_cnt; p++) array[--top] = parts[p];
+              is_covered = true;
+              break;
+            }
+            else
+            {
+              // Otherwise merge areas
+              Remove(i);
+              area = u;
+              merges_cnt++;
+              is_split_allowed = false;
+              // Merged area have to be checked against all stored ones again
+              i = 0u;
+              continue;
+            }
+          }
+          // Check next area
+          i++;
+        }
+        // Store area if needed
+        if(!is_covered)
+        {
+          array[cnt++] = area;
+        }
       }
-      // Merge all areas
-      while(ReMerge());
-      // Eliminate empty spots between areas in list that can happen after the merge process
-      Compact();
       // Return result
       return true;
     }
@@ -127,17 +235,11 @@ template <int N> class UpdateAreaProcessor
     {
       // False by default
       bool result = false;
-      // Find filled spot
-      uint32_t idx = GetFirstFilledSpot();
-      // If we have one
-      if(idx < N)
+      // If we have area
+      if(cnt > 0u)
       {
         // Store value
-        val = array[idx];
-        // Clear the spot
-        array[idx] = {0};
-        // Move other records to beginning
-        Compact();
+        val = array[--cnt];
         // Set result
         result = true;
       }
@@ -148,181 +250,298 @@ template <int N> class UpdateAreaProcessor
     // *************************************************************************
     // ***   Public: IsEmpty   *************************************************
     // *************************************************************************
-    bool IsEmpty(uint32_t idx)
+    bool IsEmpty(void) {return (cnt == 0u);}
+
+    // *************************************************************************
+    // ***   Public: IsFull   **************************************************
+    // *************************************************************************
+    bool IsFull(void) {return (cnt >= N);}
+
+    // *************************************************************************
+    // ***   Public: GetItemsCnt   *********************************************
+    // *************************************************************************
+    uint32_t GetItemsCnt(void) {return cnt;}
+
+    // *************************************************************************
+    // ***   Public: Clear   ***************************************************
+    // *************************************************************************
+    void Clear(void) {cnt = 0u;}
+
+    // *************************************************************************
+    // ***   Public: Get number of merges since last call   ********************
+    // *************************************************************************
+    uint32_t GetMergesCnt(void)
     {
-      return ( (array[idx].start_x == 0) && (array[idx].start_y == 0) &&
-               (array[idx].end_x == 0) && (array[idx].end_y == 0) );
+      uint32_t result = merges_cnt;
+      merges_cnt = 0u;
+      return result;
     }
 
+  private:
+    // Array of update areas
+    UpdateArea_t array[N];
+    // Number of stored areas
+    uint32_t cnt = 0u;
+    // Number of merged areas
+    uint32_t merges_cnt = 0u;
+    // Cost of one window in pixels
+    uint32_t window_cost = UPDATE_AREA_WINDOW_COST;
+
     // *************************************************************************
-    // ***   Public: IsEmpty   *************************************************
+    // ***   Private: Remove   *************************************************
     // *************************************************************************
-    bool IsEmpty(void)
+    void Remove(uint32_t idx)
     {
-      // Empty by default
-      bool flag = true;
-      // Try to find filled spot
-      for(uint32_t i = 0u; i < N; i++)
-      {
-        if( (array[i].start_x != 0) || (array[i].start_y != 0) ||
-            (array[i].end_x != 0) || (array[i].end_y != 0) )
-        {
-          flag = false;
-          break;
-        }
-      }
-      return flag;
+      // Move last area in place of removed one
+      array[idx] = array[--cnt];
     }
 
     // *************************************************************************
-    // ***   Public: IsFull   **************************************************
+    // ***   Private: GetCost   ************************************************
     // *************************************************************************
-    bool IsFull(void)
+    uint32_t GetCost(const UpdateArea_t& a)
     {
-      // Full by default
-      bool flag = true;
-      // try to find empty spot
-      for(uint32_t i = 0u; i < N; i++)
+      return window_cost + (uint32_t)(a.end_x - a.start_x + 1u) * (uint32_t)(a.end_y - a.start_y + 1u);
+    }
+
+    // *************************************************************************
+    // ***   Private: Union   **************************************************
+    // *************************************************************************
+    static UpdateArea_t Union(const UpdateArea_t& a, const UpdateArea_t& b)
+    {
+      UpdateArea_t u;
+      u.start_x = MIN(a.start_x, b.start_x);
+      u.start_y = MIN(a.start_y, b.start_y);
+      u.end_x = MAX(a.end_x, b.end_x);
+      u.end_y = MAX(a.end_y, b.end_y);
+      return u;
+    }
+
+    // *************************************************************************
+    // ***   Private: IsIntersect   ********************************************
+    // *************************************************************************
+    static bool IsIntersect(const UpdateArea_t& a, const UpdateArea_t& b)
+    {
+      return (a.start_x <= b.end_x) && (a.end_x >= b.start_x) && (a.start_y <= b.end_y) && (a.end_y >= b.start_y);
+    }
+
+    // *************************************************************************
+    // ***   Private: IsIntersectOthers   **************************************
+    // *************************************************************************
+    bool IsIntersectOthers(const UpdateArea_t& a, uint32_t skip)
+    {
+      bool result = false;
+      // Check all stored areas except skipped one
+      for(uint32_t i = 0u; i < cnt; i++)
       {
-        if( (array[i].start_x == 0) && (array[i].start_y == 0) &&
-            (array[i].end_x == 0) && (array[i].end_y == 0) )
+        if((i != skip) && IsIntersect(a, array[i]))
         {
-          flag = false;
+          result = true;
           break;
         }
       }
-      return flag;
+      return result;
     }
 
     // *************************************************************************
-    // ***   Public: GetItemsCnt   *********************************************
+    // ***   Private: IsInside   ***********************************************
     // *************************************************************************
-    uint32_t GetItemsCnt(void)
+    static bool IsInside(const UpdateArea_t& a, const UpdateArea_t& b)
+    {
+      return (a.start_x >= b.start_x) && (a.end_x <= b.end_x) && (a.start_y >= b.start_y) && (a.end_y <= b.end_y);
+    }
+
+    // *************************************************************************
+    // ***   Private: Split   **************************************************
+    // *************************************************************************
+    // * Split area a to non-overlapping parts outside of area b: bands above
+    // * and below b and parts at left and right side of b. Returns number of
+    // * parts. In 3 bit color mode areas can't be split since each byte
+    // * contains two pixels, zero returned in this case.
+    static uint32_t Split(const UpdateArea_t& a, const UpdateArea_t& b, UpdateArea_t* parts)
     {
-      uint32_t n = 0;
-      // Count filled spots
-      for(uint32_t i = 0u; i < N; i++)
+      uint32_t n = 0u;
+#if defined(COLOR_3BIT)
+      // Unused in 3 bit color mode
+      (void)a;
+      (void)b;
+      (void)parts;
+#else
+      // Band above
+      if(a.start_y < b.start_y)
       {
-        if( (array[i].start_x != 0) || (array[i].start_y != 0) ||
-            (array[i].end_x != 0) || (array[i].end_y != 0) )
-        {
-          n++;
-        }
+        parts[n] = a;
+        parts[n].end_y = b.start_y - 1u;
+        n++;
       }
-      // Return result
+      // Band below
+      if(a.end_y > b.end_y)
+      {
+        parts[n] = a;
+        parts[n].start_y = b.end_y + 1u;
+        n++;
+      }
+      // Lines that present in both areas
+      uint16_t start_y = MAX(a.start_y, b.start_y);
+      uint16_t end_y = MIN(a.end_y, b.end_y);
+      // Left part
+      if(a.start_x < b.start_x)
+      {
+        parts[n] = a;
+        parts[n].end_x = b.start_x - 1u;
+        parts[n].start_y = start_y;
+        parts[n].end_y = end_y;
+        n++;
+      }
+      // Right part
+      if(a.end_x > b.end_x)
+      {
+        parts[n] = a;
+        parts[n].start_x = b.end_x + 1u;
+        parts[n].start_y = start_y;
+        parts[n].end_y = end_y;
+        n++;
+      }
+#endif
+      // Return number of parts
       return n;
     }
+};
+
+#endif
 
+#if defined(UPDATE_AREA_TILES)
+
+// *****************************************************************************
+// ***   Update Area Tiles template class   ************************************
+// *****************************************************************************
+// * Keeps dirty tiles of T x T pixels in bitmap: one 64 bit mask per row of
+// * tiles. Push just sets bits for tiles covered by area, Pop returns run of
+// * dirty tiles in a row merged with the same runs in following rows. Memory
+// * cost doesn't depend on number of areas.
+template <int T> class UpdateAreaTiles
+{
+  public:
     // *************************************************************************
-    // ***   Public: GetFirstEmptySpot   ***************************************
+    // ***   Public: UpdateAreaTiles   *****************************************
     // *************************************************************************
-    uint32_t GetFirstEmptySpot(void)
+    UpdateAreaTiles()
     {
-      uint32_t idx = 0;
-      // Count filled spots
-      for(; idx < N; idx++)
-      {
-        if( (array[idx].start_x == 0) && (array[idx].start_y == 0) &&
-            (array[idx].end_x == 0) && (array[idx].end_y == 0) )
-        {
-          break;
-        }
-      }
-      // Return result
-      return idx;
+      // Clear bitmap
+      Clear();
     }
 
     // *************************************************************************
-    // ***   Public: GetFirstFilledSpot   **************************************
+    // ***   Public: ~UpdateAreaTiles   ****************************************
     // *************************************************************************
-    uint32_t GetFirstFilledSpot(void)
+    ~UpdateAreaTiles() {};
+
+    // *************************************************************************
+    // ***   Public: Push   ****************************************************
+    // *************************************************************************
+    bool Push(UpdateArea_t& value)
     {
-      uint32_t idx = 0;
-      // Count filled spots
-      for(; idx < N; idx++)
+      // Update bounds of all pushed areas
+      if(IsEmpty())
       {
-        if( (array[idx].start_x != 0) || (array[idx].start_y != 0) ||
-            (array[idx].end_x != 0) || (array[idx].end_y != 0) )
-        {
-          break;
-        }
+        bounds = value;
+      }
+      else
+      {
+        if(value.start_x < bounds.start_x) bounds.start_x = value.start_x;
+        if(value.start_y < bounds.start_y) bounds.start_y = value.start_y;
+        if(value.end_x > bounds.end_x) bounds.end_x = value.end_x;
+        if(value.end_y > bounds.end_y) bounds.end_y = value.end_y;
       }
+      // Find tiles. Areas outside of bitmap go to last tile.
+      uint32_t start_tx = MIN(value.start_x / T, TILES_CNT - 1u);
+      uint32_t start_ty = MIN(value.start_y / T, TILES_CNT - 1u);
+      uint32_t end_tx = MIN(value.end_x / T, TILES_CNT - 1u);
+      uint32_t end_ty = MIN(value.end_y / T, TILES_CNT - 1u);
+      // Mask of dirty tiles in the row
+      uint64_t mask = GetMask(start_tx, end_tx);
+      // Set tiles
+      for(uint32_t ty = start_ty; ty <= end_ty; ty++)
+      {
+        tiles[ty] |= mask;
+      }
+      // Set rows
+      rows |= GetMask(start_ty, end_ty);
       // Return result
-      return idx;
+      return true;
     }
 
     // *************************************************************************
-    // ***   Public: ReMerge   *************************************************
+    // ***   Public: Pop   *****************************************************
     // *************************************************************************
-    bool ReMerge(void)
+    bool Pop(UpdateArea_t& val)
     {
-      // No merge happened
+      // False by default
       bool result = false;
-      // Count filled spots
-      for(uint32_t idx = 0; idx < N; idx++)
+      // If we have dirty tiles
+      if(rows != 0u)
       {
-        // If current record isn't empty
-        if(!IsEmpty(idx))
+        // Find first dirty row
+        uint32_t start_ty = GetFirstBit(rows);
+        // Find first run of dirty tiles in the row
+        uint32_t start_tx = GetFirstBit(tiles[start_ty]);
+        uint32_t end_tx = start_tx;
+        while((end_tx + 1u < TILES_CNT) && (tiles[start_ty] & (1ull << (end_tx + 1u))))
         {
-          // Check the rest
-          for(uint32_t n = idx + 1u; n < N; n++)
-          {
-            // If we found isn't empty area - try to merge it
-            if(!IsEmpty(n))
-            {
-              // Check intersection
-              bool width_is_positive  = MIN(array[n].end_x, array[idx].end_x) > MAX(array[n].start_x, array[idx].start_x);
-              bool height_is_positive = MIN(array[n].end_y, array[idx].end_y) > MAX(array[n].start_y, array[idx].start_y);
-              // Merge areas if intersects
-              if(width_is_positive && height_is_positive)
-              {
-                // Add new area to existing one
-                if(array[n].start_x < array[idx].start_x) array[idx].start_x = array[n].start_x;
-                if(array[n].start_y < array[idx].start_y) array[idx].start_y = array[n].start_y;
-                if(array[n].end_x > array[idx].end_x) array[idx].end_x = array[n].end_x;
-                if(array[n].end_y > array[idx].end_y) array[idx].end_y = array[n].end_y;
-                // Clear merged record
-                array[n] = {0};
-                // Set result
-                result = true;
-                // Already merged, break the cycle
-                break;
-              }
-            }
-          }
+          end_tx++;
         }
+        uint64_t mask = GetMask(start_tx, end_tx);
+        // Merge the same run in following rows
+        uint32_t end_ty = start_ty;
+        while((end_ty + 1u < TILES_CNT) && ((tiles[end_ty + 1u] & mask) == mask))
+        {
+          end_ty++;
+        }
+        // Clear tiles
+        for(uint32_t ty = start_ty; ty <= end_ty; ty++)
+        {
+          tiles[ty] &= ~mask;
+          // Clear row if there no more dirty tiles in it
+          if(tiles[ty] == 0u) rows &= ~(1ull << ty);
+        }
+        // Find area in pixels. It can't be greater than bounds of pushed areas.
+        val.start_x = MAX(start_tx * T, bounds.start_x);
+        val.start_y = MAX(start_ty * T, bounds.start_y);
+        val.end_x = (end_tx == TILES_CNT - 1u) ? bounds.end_x : MIN((end_tx + 1u) * T - 1u, bounds.end_x);
+        val.end_y = (end_ty == TILES_CNT - 1u) ? bounds.end_y : MIN((end_ty + 1u) * T - 1u, bounds.end_y);
+        // Set result
+        result = true;
       }
       // Return result
       return result;
     }
 
     // *************************************************************************
-    // ***   Public: Compact   *************************************************
+    // ***   Public: IsEmpty   *************************************************
+    // *************************************************************************
+    bool IsEmpty(void) {return (rows == 0u);}
+
+    // *************************************************************************
+    // ***   Public: GetItemsCnt   *********************************************
     // *************************************************************************
-    void Compact(void)
+    // * Returns number of runs of dirty tiles. Pop can return less areas since
+    // * it merges the same runs in following rows.
+    uint32_t GetItemsCnt(void)
     {
-      // Count all records
-      for(uint32_t idx = 0; idx < N; idx++)
+      uint32_t n = 0u;
+      // Count runs in each row: run starts at dirty tile without dirty one
+      // before it
+      for(uint32_t ty = 0u; ty < TILES_CNT; ty++)
       {
-        // If current record is empty
-        if(IsEmpty(idx))
+        uint64_t starts = tiles[ty] & ~(tiles[ty] << 1u);
+        while(starts != 0u)
         {
-          // Check the rest
-          for(uint32_t n = idx + 1u; n < N; n++)
-          {
-            // If we found isn't empty area - copy and clear it
-            if(!IsEmpty(n))
-            {
-              // Copy record closer to beginning of array
-              array[idx] = array[n];
-              // Clear merged record
-              array[n] = {0};
-              // Break cycle
-              break;
-            }
-          }
+          starts &= starts - 1u;
+          n++;
         }
       }
+      // Return result
+      return n;
     }
 
     // *************************************************************************
@@ -330,18 +549,44 @@ template <int N> class UpdateAreaProcessor
     // *************************************************************************
     void Clear(void)
     {
-      // Clear array
-      for(uint32_t i = 0U; i < N; i++)
+      for(uint32_t i = 0u; i < TILES_CNT; i++)
       {
-        array[i] = {0};
+        tiles[i] = 0u;
       }
+      rows = 0u;
     }
 
-  protected:
-    // Array for calculating average
-    UpdateArea_t array[N];
-
   private:
+    // Number of tiles in row and column
+    static const uint32_t TILES_CNT = (DISPLAY_MAX_BUF_LEN + T - 1u) / T;
+    // Dirty tiles, one bit per tile
+    uint64_t tiles[TILES_CNT];
+    // Rows that contain dirty tiles
+    uint64_t rows = 0u;
+    // Bounds of all pushed areas
+    UpdateArea_t bounds;
+
+    // *************************************************************************
+    // ***   Private: GetMask   ************************************************
+    // *************************************************************************
+    static uint64_t GetMask(uint32_t start, uint32_t end)
+    {
+      return ((end + 1u < 64u) ? ((1ull << (end + 1u)) - 1u) : ~0ull) & ~((1ull << start) - 1u);
+    }
+
+    // *************************************************************************
+    // ***   Private: GetFirstBit   ********************************************
+    // *************************************************************************
+    static uint32_t GetFirstBit(uint64_t value)
+    {
+      uint32_t n = 0u;
+      while((value & 1u) == 0u)
+      {
+        value >>= 1u;
+        n++;
+      }
+      return n;
+    }
 };
 
 #endif
@@ -200,6 +200,10 @@ Result VisList::AddVisObjectToList(VisObject* obj, uint32_t z)
     {
       SetActive(true); // Set active flag for the list
     }
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+    // List changed - objects for draw area have to be collected again
+    if(area != nullptr) area->is_valid = false;
+#endif
     // Give semaphore after changes
     display_drv->UnlockDisplayLine();
     // Set return status
@@ -244,6 +248,39 @@ Result VisList::DelVisObjectFromList(VisObject* obj)
     // Clear pointers in object
     obj->p_prev = nullptr;
     obj->p_next = nullptr;
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+    // List changed - objects for draw area have to be collected again
+    if(area != nullptr) area->is_valid = false;
+#endif
+    // Give semaphore after changes
+    display_drv->UnlockDisplayLine();
+    // Set return status
+    result = Result::RESULT_OK;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Shift Visual Object without invalidation   ********************
+// *****************************************************************************
+Result VisList::ShiftVisObject(VisObject* obj, int32_t dx, int32_t dy)
+{
+  Result result = Result::ERR_NULL_PTR;
+
+  if((obj != nullptr) && (obj->list == this))
+  {
+    // Take semaphore before move object
+    display_drv->LockDisplayLine();
+    // Move object in delta coordinates
+    obj->x_start += dx;
+    obj->y_start += dy;
+    obj->x_end += dx;
+    obj->y_end += dy;
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+    // Object moved - objects for draw area have to be collected again
+    if(area != nullptr) area->is_valid = false;
+#endif
     // Give semaphore after changes
     display_drv->UnlockDisplayLine();
     // Set return status
@@ -258,21 +295,107 @@ Result VisList::DelVisObjectFromList(VisObject* obj)
 // *****************************************************************************
 void VisList::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 {
+  // Draw objects without background
+  DrawObjectsInBufW(buf, n, line, start_x, nullptr);
+}
+
+// *****************************************************************************
+// ***   Put line in buffer with background   **********************************
+// *****************************************************************************
+void VisList::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x, color_t bkg_color)
+{
+  // Draw objects with background
+  DrawObjectsInBufW(buf, n, line, start_x, &bkg_color);
+}
+
+// *****************************************************************************
+// ***   Private: Draw objects with optional background   **********************
+// *****************************************************************************
+void VisList::DrawObjectsInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x, const color_t* bkg_color)
+{
+  // Flag to fill background before drawing objects
+  bool is_fill = (bkg_color != nullptr);
   // Draw object only if it fit list
   if((line >= y_start) && (line <= y_end))
   {
-    // Set pointer to first element
-    VisObject* p_obj = object_first;
     // Count
     int32_t cnt = ((start_x + n - 1) > x_end) ? (x_end - start_x + 1) : n;
-    // Do for all objects
-    while(p_obj != nullptr)
+    // Line and start x in list coordinates
+    int32_t l = line - y_start;
+    int32_t sx = start_x - x_start;
+    // End x in list coordinates
+    int32_t ex = sx + cnt - 1;
+    // Parts of line covered by opaque objects
+    Cover_t cover;
+    cover.cnt = 0;
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+    // Draw only objects present on the line if possible
+    if(IsAreaLine(l, sx, cnt))
     {
-      p_obj->DrawInBufW(buf, cnt, line - y_start, start_x - x_start);
-      // Set pointer to next object in list
-      p_obj = p_obj->p_next;
+      // Update objects present on the line
+      UpdateAreaObjects(l);
+      // Find visible part of each object from top one until whole line covered
+      int32_t first = area->active_cnt;
+      while((first > 0) && !IsCovered(cover, sx, ex))
+      {
+        first--;
+        VisObject* p_obj = area->obj[area->active[first]];
+        CoverObject(cover, p_obj, (l >= MIN(p_obj->y_start, p_obj->y_end)) && (l <= MAX(p_obj->y_start, p_obj->y_end)),
+                    MIN(p_obj->x_start, p_obj->x_end), MAX(p_obj->x_start, p_obj->x_end), sx, ex);
+      }
+      // Fill background that isn't covered
+      if(is_fill)
+      {
+        CoverFill(cover, buf, n, sx, *bkg_color);
+        is_fill = false;
+      }
+      // Draw visible parts of objects starting from lowest visible one
+      for(int32_t i = first; i < area->active_cnt; i++)
+      {
+        VisObject* p_obj = area->obj[area->active[i]];
+        if(p_obj->draw_start <= p_obj->draw_end)
+        {
+          DrawObjectInBufW(p_obj, buf + (p_obj->draw_start - sx), p_obj->draw_end - p_obj->draw_start + 1, l, p_obj->draw_start);
+        }
+      }
+    }
+    else
+#endif
+    {
+      // Find visible part of each object from top one until whole line covered
+      VisObject* p_first = nullptr;
+      VisObject* p_obj = object_last;
+      while((p_obj != nullptr) && !IsCovered(cover, sx, ex))
+      {
+        CoverObject(cover, p_obj, (l >= MIN(p_obj->y_start, p_obj->y_end)) && (l <= MAX(p_obj->y_start, p_obj->y_end)),
+                    MIN(p_obj->x_start, p_obj->x_end), MAX(p_obj->x_start, p_obj->x_end), sx, ex);
+        p_first = p_obj;
+        p_obj = p_obj->p_prev;
+      }
+      // Fill background that isn't covered
+      if(is_fill)
+      {
+        CoverFill(cover, buf, n, sx, *bkg_color);
+        is_fill = false;
+      }
+      // Draw visible parts of objects starting from lowest visible one
+      p_obj = p_first;
+      while(p_obj != nullptr)
+      {
+        if(p_obj->draw_start <= p_obj->draw_end)
+        {
+          DrawObjectInBufW(p_obj, buf + (p_obj->draw_start - sx), p_obj->draw_end - p_obj->draw_start + 1, l, p_obj->draw_start);
+        }
+        // Set pointer to next object in list
+        p_obj = p_obj->p_next;
+      }
     }
   }
+  // Fill background if line is outside of list
+  if(is_fill)
+  {
+    for(int32_t i = 0; i < n; i++) buf[i] = *bkg_color;
+  }
 }
 
 // *****************************************************************************
@@ -280,20 +403,410 @@ void VisList::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 // *****************************************************************************
 void VisList::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
+  // Draw objects without background
+  DrawObjectsInBufH(buf, n, row, start_y, nullptr);
+}
+
+// *****************************************************************************
+// ***   Put row in buffer with background   ***********************************
+// *****************************************************************************
+void VisList::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y, color_t bkg_color)
+{
+  // Draw objects with background
+  DrawObjectsInBufH(buf, n, row, start_y, &bkg_color);
+}
+
+// *****************************************************************************
+// ***   Private: Draw objects row with optional background   ******************
+// *****************************************************************************
+void VisList::DrawObjectsInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y, const color_t* bkg_color)
+{
+  // Flag to fill background before drawing objects
+  bool is_fill = (bkg_color != nullptr);
+  // Draw object only if it fit list
   if((row >= x_start) && (row <= x_end))
   {
-    // Set pointer to first element
-    VisObject* p_obj = object_first;
-    // Do for all objects
+    // Count
+    int32_t cnt = ((start_y + n - 1) > y_end) ? (y_end - start_y + 1) : n;
+    // Row and start y in list coordinates
+    int32_t r = row - x_start;
+    int32_t sy = start_y - y_start;
+    // End y in list coordinates
+    int32_t ey = sy + cnt - 1;
+    // Parts of row covered by opaque objects
+    Cover_t cover;
+    cover.cnt = 0;
+    // Find visible part of each object from top one until whole row covered
+    VisObject* p_first = nullptr;
+    VisObject* p_obj = object_last;
+    while((p_obj != nullptr) && !IsCovered(cover, sy, ey))
+    {
+      CoverObject(cover, p_obj, (r >= MIN(p_obj->x_start, p_obj->x_end)) && (r <= MAX(p_obj->x_start, p_obj->x_end)),
+                  MIN(p_obj->y_start, p_obj->y_end), MAX(p_obj->y_start, p_obj->y_end), sy, ey);
+      p_first = p_obj;
+      p_obj = p_obj->p_prev;
+    }
+    // Fill background that isn't covered
+    if(is_fill)
+    {
+      CoverFill(cover, buf, n, sy, *bkg_color);
+      is_fill = false;
+    }
+    // Draw visible parts of objects starting from lowest visible one
+    p_obj = p_first;
     while(p_obj != nullptr)
     {
-      p_obj->DrawInBufH(buf, n, row - x_start, start_y - y_start);
+      if(p_obj->draw_start <= p_obj->draw_end)
+      {
+        DrawObjectInBufH(p_obj, buf + (p_obj->draw_start - sy), p_obj->draw_end - p_obj->draw_start + 1, r, p_obj->draw_start);
+      }
       // Set pointer to next object in list
       p_obj = p_obj->p_next;
     }
   }
+  // Fill background if row is outside of list
+  if(is_fill)
+  {
+    for(int32_t i = 0; i < n; i++) buf[i] = *bkg_color;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Add interval to covered intervals   **************************
+// *****************************************************************************
+void VisList::CoverAdd(Cover_t& cover, int32_t start, int32_t end)
+{
+  // Skip intervals that end before new one
+  int32_t i = 0;
+  while((i < cover.cnt) && (cover.end[i] + 1 < start)) i++;
+  // Merge intervals that overlap or touch new one
+  int32_t j = i;
+  while((j < cover.cnt) && (cover.start[j] <= end + 1))
+  {
+    start = MIN(start, cover.start[j]);
+    end = MAX(end, cover.end[j]);
+    j++;
+  }
+  // Separate interval needs free slot, merged ones replaced by one interval
+  if((j > i) || (cover.cnt < COVER_MAX_CNT))
+  {
+    // Number of intervals added
+    int32_t shift = 1 - (j - i);
+    if(shift > 0)
+    {
+      for(int32_t k = cover.cnt; k > i; k--)
+      {
+        cover.start[k] = cover.start[k - 1];
+        cover.end[k] = cover.end[k - 1];
+      }
+    }
+    else if(shift < 0)
+    {
+      for(int32_t k = j; k < cover.cnt; k++)
+      {
+        cover.start[k + shift] = cover.start[k];
+        cover.end[k + shift] = cover.end[k];
+      }
+    }
+    else
+    {
+      ; // Interval replaced in place
+    }
+    cover.start[i] = start;
+    cover.end[i] = end;
+    cover.cnt += shift;
+  }
 }
 
+// *****************************************************************************
+// ***   Private: Set object part not covered by objects above   ***************
+// *****************************************************************************
+void VisList::CoverObject(Cover_t& cover, VisObject* obj, bool is_on_line, int32_t obj_start, int32_t obj_end, int32_t start, int32_t end)
+{
+  // Empty by default
+  int32_t draw_start = 0;
+  int32_t draw_end = -1;
+  // Object has to be on the line and intersect drawn part
+  if(is_on_line && (obj_start <= end) && (obj_end >= start))
+  {
+    // Clip object to drawn part
+    draw_start = MAX(obj_start, start);
+    draw_end = MIN(obj_end, end);
+    // Opaque object covers everything below it
+    bool is_opaque = obj->IsOpaque();
+    int32_t cover_start = draw_start;
+    int32_t cover_end = draw_end;
+    // Cut covered intervals from the start. Intervals are sorted, so one pass
+    // is enough.
+    for(int32_t i = 0; i < cover.cnt; i++)
+    {
+      if((cover.start[i] <= draw_start) && (cover.end[i] >= draw_start)) draw_start = cover.end[i] + 1;
+    }
+    // Cut covered intervals from the end
+    for(int32_t i = cover.cnt - 1; i >= 0; i--)
+    {
+      if((cover.start[i] <= draw_end) && (cover.end[i] >= draw_end)) draw_end = cover.start[i] - 1;
+    }
+    // Add visible opaque object to covered intervals
+    if(is_opaque && (draw_start <= draw_end))
+    {
+      CoverAdd(cover, cover_start, cover_end);
+    }
+  }
+  // Save visible part
+  obj->draw_start = draw_start;
+  obj->draw_end = draw_end;
+}
+
+// *****************************************************************************
+// ***   Private: Fill background outside of covered intervals   ***************
+// *****************************************************************************
+void VisList::CoverFill(const Cover_t& cover, color_t* buf, int32_t n, int32_t start, color_t color)
+{
+  int32_t i = 0;
+  // Fill gap before each interval and skip interval
+  for(int32_t k = 0; k < cover.cnt; k++)
+  {
+    for(; i < cover.start[k] - start; i++) buf[i] = color;
+    i = cover.end[k] - start + 1;
+  }
+  // Fill rest of buffer
+  for(; i < n; i++) buf[i] = color;
+}
+
+// *****************************************************************************
+// ***   Public: Check if there no objects on the part of line   ***************
+// *****************************************************************************
+bool VisList::IsLineEmpty(int32_t line, int32_t start_x, int32_t n)
+{
+  // Empty by default
+  bool is_empty = true;
+  // Only part of line inside list can contain objects
+  if((line >= y_start) && (line <= y_end) && (start_x <= x_end) && (start_x + n - 1 >= x_start))
+  {
+    // Count
+    int32_t cnt = ((start_x + n - 1) > x_end) ? (x_end - start_x + 1) : n;
+    // Line and start x in list coordinates
+    int32_t l = line - y_start;
+    int32_t sx = start_x - x_start;
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+    // Use objects present on the line if possible
+    if(IsAreaLine(l, sx, cnt))
+    {
+      UpdateAreaObjects(l);
+      is_empty = (area->active_cnt == 0u);
+    }
+    else
+#endif
+    {
+      // Find any object that intersects part of line
+      VisObject* p_obj = object_first;
+      while((p_obj != nullptr) && is_empty)
+      {
+        // Some objects(like Line) can have start coordinates greater than
+        // end ones
+        if(   (l >= MIN(p_obj->y_start, p_obj->y_end)) && (l <= MAX(p_obj->y_start, p_obj->y_end))
+           && (sx <= MAX(p_obj->x_start, p_obj->x_end)) && (sx + cnt - 1 >= MIN(p_obj->x_start, p_obj->x_end)))
+        {
+          is_empty = false;
+        }
+        // Set pointer to next object in list
+        p_obj = p_obj->p_next;
+      }
+    }
+  }
+  // Return result
+  return is_empty;
+}
+
+// *****************************************************************************
+// ***   Public: Check if there no objects on the part of row   ****************
+// *****************************************************************************
+bool VisList::IsRowEmpty(int32_t row, int32_t start_y, int32_t n)
+{
+  // Empty by default
+  bool is_empty = true;
+  // Only part of row inside list can contain objects
+  if((row >= x_start) && (row <= x_end) && (start_y <= y_end) && (start_y + n - 1 >= y_start))
+  {
+    // Count
+    int32_t cnt = ((start_y + n - 1) > y_end) ? (y_end - start_y + 1) : n;
+    // Row and start y in list coordinates
+    int32_t r = row - x_start;
+    int32_t sy = start_y - y_start;
+    // Find any object that intersects part of row
+    VisObject* p_obj = object_first;
+    while((p_obj != nullptr) && is_empty)
+    {
+      // Some objects(like Line) can have start coordinates greater than end
+      // ones
+      if(   (r >= MIN(p_obj->x_start, p_obj->x_end)) && (r <= MAX(p_obj->x_start, p_obj->x_end))
+         && (sy <= MAX(p_obj->y_start, p_obj->y_end)) && (sy + cnt - 1 >= MIN(p_obj->y_start, p_obj->y_end)))
+      {
+        is_empty = false;
+      }
+      // Set pointer to next object in list
+      p_obj = p_obj->p_next;
+    }
+  }
+  // Return result
+  return is_empty;
+}
+
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+// *****************************************************************************
+// ***   Public: SetAreaStorage   **********************************************
+// *****************************************************************************
+void VisList::SetAreaStorage(VisListArea_t* storage)
+{
+  // Save pointer to storage
+  area = storage;
+  // Objects have to be collected before use
+  if(area != nullptr)
+  {
+    area->is_valid = false;
+  }
+}
+
+// *****************************************************************************
+// ***   Public: SetDrawArea   *************************************************
+// *****************************************************************************
+void VisList::SetDrawArea(int32_t start_x, int32_t start_y, int32_t end_x, int32_t end_y)
+{
+  if(area != nullptr)
+  {
+    // Save area in list coordinates
+    area->start_x = start_x - x_start;
+    area->start_y = start_y - y_start;
+    area->end_x = end_x - x_start;
+    area->end_y = end_y - y_start;
+    // Objects will be collected at first line
+    area->is_valid = false;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Collect objects that intersect draw area   *******************
+// *****************************************************************************
+void VisList::CollectAreaObjects(int32_t line)
+{
+  // Clear area
+  area->cnt = 0u;
+  area->active_cnt = 0u;
+  area->next = 0u;
+  area->line = line;
+  area->is_overflow = false;
+
+  // Set pointer to first element
+  VisObject* p_obj = object_first;
+  // Do for all objects, objects in the list sorted by Z
+  while(p_obj != nullptr)
+  {
+    // Find object bounds. Some objects(like Line) can have start coordinates
+    // greater than end ones.
+    int32_t sx = MIN(p_obj->x_start, p_obj->x_end);
+    int32_t ex = MAX(p_obj->x_start, p_obj->x_end);
+    int32_t sy = MIN(p_obj->y_start, p_obj->y_end);
+    int32_t ey = MAX(p_obj->y_start, p_obj->y_end);
+    // Only visible objects that intersect area and not ended before current
+    // line
+    if(   (sx <= area->end_x) && (ex >= area->start_x)
+       && (sy <= area->end_y) && (ey >= area->start_y) && (ey >= line)
+       && IsObjectVisible(sx, sy, ex, ey))
+    {
+      // If there no space for object - whole list have to be processed
+      if(area->cnt >= DISPLAY_AREA_MAX_OBJECTS)
+      {
+        area->is_overflow = true;
+        break;
+      }
+      // Store object
+      area->obj[area->cnt] = p_obj;
+      area->start[area->cnt] = sy;
+      area->end[area->cnt] = ey;
+      // Insertion sort by start line. Objects with the same start line stay
+      // in Z order.
+      int32_t i = area->cnt;
+      while((i > 0) && (area->start[area->order[i - 1]] > sy))
+      {
+        area->order[i] = area->order[i - 1];
+        i--;
+      }
+      area->order[i] = area->cnt;
+      // Increase objects count
+      area->cnt++;
+    }
+    // Set pointer to next object in list
+    p_obj = p_obj->p_next;
+  }
+
+  // Objects collected
+  area->is_valid = true;
+}
+
+// *****************************************************************************
+// ***   Private: Check if collected objects can be used for the line   ********
+// *****************************************************************************
+bool VisList::IsAreaLine(int32_t line, int32_t start_x, int32_t n)
+{
+  // Can't be used by default
+  bool result = false;
+  // Collected objects can be used only if line is inside draw area
+  if(   (area != nullptr)
+     && (line >= area->start_y) && (line <= area->end_y)
+     && (start_x >= area->start_x) && (start_x + n - 1 <= area->end_x))
+  {
+    // Collect objects if list changed or new pass over the area started
+    if(!area->is_valid || (line < area->line))
+    {
+      CollectAreaObjects(line);
+    }
+    // All objects have to fit storage
+    result = area->is_valid && !area->is_overflow;
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: Update objects present on the line   *************************
+// *****************************************************************************
+void VisList::UpdateAreaObjects(int32_t line)
+{
+  // Remove objects that ended before this line
+  uint16_t cnt = 0u;
+  for(uint16_t i = 0u; i < area->active_cnt; i++)
+  {
+    if(area->end[area->active[i]] >= line)
+    {
+      area->active[cnt++] = area->active[i];
+    }
+  }
+  area->active_cnt = cnt;
+  // Add objects that start on this line. Active objects are kept in Z order.
+  while((area->next < area->cnt) && (area->start[area->order[area->next]] <= line))
+  {
+    // Get object index
+    uint16_t idx = area->order[area->next++];
+    // Skip objects that already ended
+    if(area->end[idx] >= line)
+    {
+      // Find position according to Z order
+      uint16_t i = area->active_cnt;
+      while((i > 0u) && (area->active[i - 1u] > idx))
+      {
+        area->active[i] = area->active[i - 1u];
+        i--;
+      }
+      area->active[i] = idx;
+      area->active_cnt++;
+    }
+  }
+  // Save processed line
+  area->line = line;
+}
+#endif
+
 // *****************************************************************************
 // ***   Public: Action   ******************************************************
 // *****************************************************************************
@@ -321,8 +834,8 @@ void VisList::Action(ActionType action, int32_t tx, int32_t ty, int32_t tpx, int
         // Do for all objects
         while(p_obj != nullptr)
         {
-          // If we found active object
-          if(p_obj->active)
+          // If we found active visible object
+          if(p_obj->active && IsObjectVisible(p_obj->GetStartX(), p_obj->GetStartY(), p_obj->GetEndX(), p_obj->GetEndY()))
           {
             // And touch in this object area
             if(   (tx >= p_obj->GetStartX()) && (tx <= p_obj->GetEndX())
@@ -354,8 +867,8 @@ void VisList::Action(ActionType action, int32_t tx, int32_t ty, int32_t tpx, int
         // Do for all objects
         while(p_obj != nullptr)
         {
-          // If we found active object
-          if(p_obj->active)
+          // If we found active visible object
+          if(p_obj->active && IsObjectVisible(p_obj->GetStartX(), p_obj->GetStartY(), p_obj->GetEndX(), p_obj->GetEndY()))
           {
             // And touch in this object area
             if(   (tpx >= p_obj->GetStartX()) && (tpx <= p_obj->GetEndX())
@@ -405,11 +918,27 @@ void VisList::Action(ActionType action, int32_t tx, int32_t ty, int32_t tpx, int
   }
 }
 
+// *****************************************************************************
+// ***   Private: Check if object is visible   *********************************
+// *****************************************************************************
+bool VisList::IsObjectVisible(int32_t start_x, int32_t start_y, int32_t end_x, int32_t end_y)
+{
+  // Only objects of root list have screen coordinates. Objects of nested
+  // lists are clipped by the list itself.
+  // Some objects(like Line) can have start coordinates greater than end ones.
+  return    (this != display_drv->GetVisList())
+         || display_drv->IsAreaVisible(MIN(start_x, end_x), MIN(start_y, end_y), MAX(start_x, end_x), MAX(start_y, end_y));
+}
+
 // *****************************************************************************
 // ***   Public: Invalidate Area   *********************************************
 // *****************************************************************************
 void VisList::InvalidateArea(int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y)
 {
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+  // Object changed - objects for draw area have to be collected again
+  if(area != nullptr) area->is_valid = false;
+#endif
 #if defined(UPDATE_AREA_ENABLED)
   // Find invalidate absolute coordinates
   int32_t sx = GetStartX() + start_x;
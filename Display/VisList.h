@@ -57,6 +57,7 @@
 // *****************************************************************************
 #include "DevCfg.h"
 #include "Display/VisObject.h"
+#include "Display/DisplayStats.h"
 #include "Framework/AppTask.h"
 
 // *****************************************************************************
@@ -64,6 +65,39 @@
 // *****************************************************************************
 class DisplayDrv;
 
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+// *****************************************************************************
+// ***   Objects that intersect draw area   ************************************
+// *****************************************************************************
+typedef struct
+{
+  // Objects that intersect area in Z order
+  VisObject* obj[DISPLAY_AREA_MAX_OBJECTS];
+  // First line of each object
+  int16_t start[DISPLAY_AREA_MAX_OBJECTS];
+  // Last line of each object
+  int16_t end[DISPLAY_AREA_MAX_OBJECTS];
+  // Object indexes sorted by start line
+  uint16_t order[DISPLAY_AREA_MAX_OBJECTS];
+  // Indexes of objects present on current line in Z order
+  uint16_t active[DISPLAY_AREA_MAX_OBJECTS];
+  // Number of objects
+  uint16_t cnt;
+  // Number of objects present on current line
+  uint16_t active_cnt;
+  // Index in order array of next object to enter current line
+  uint16_t next;
+  // Last processed line
+  int16_t line;
+  // Area bounds in list coordinates
+  int16_t start_x, start_y, end_x, end_y;
+  // Objects collected for area
+  bool is_valid;
+  // Area contains more objects than array can hold
+  bool is_overflow;
+} VisListArea_t;
+#endif
+
 // *****************************************************************************
 // ***   VisList class   *******************************************************
 // *****************************************************************************
@@ -105,6 +139,14 @@ class VisList : public VisObject
     // *************************************************************************
     Result DelVisObjectFromList(VisObject* obj);
 
+    // *************************************************************************
+    // ***   Shift Visual Object without invalidation   ************************
+    // *************************************************************************
+    // * Moves object in the list by delta without redraw of its area. Used
+    // * when content already drawn is moved by display itself(hardware
+    // * scroll). Objects for draw area are collected again.
+    Result ShiftVisObject(VisObject* obj, int32_t dx, int32_t dy);
+
     // *************************************************************************
     // ***   DrawInBufH   ******************************************************
     // *************************************************************************
@@ -119,6 +161,51 @@ class VisList : public VisObject
     // * Each derived class must implement this function.
     virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x =  0);
 
+    // *************************************************************************
+    // ***   DrawInBufW   ******************************************************
+    // *************************************************************************
+    // * Draw one vertical line of list with background. Background is filled
+    // * only if line isn't covered by opaque object.
+    void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x, color_t bkg_color);
+
+    // *************************************************************************
+    // ***   DrawInBufH   ******************************************************
+    // *************************************************************************
+    // * Draw one horizontal line of list with background. Background is filled
+    // * only if row isn't covered by opaque object.
+    void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y, color_t bkg_color);
+
+    // *************************************************************************
+    // ***   IsLineEmpty   *****************************************************
+    // *************************************************************************
+    // * Check if there no objects on the part of line, so DrawInBufW() with
+    // * background will fill it by background color only.
+    bool IsLineEmpty(int32_t line, int32_t start_x, int32_t n);
+
+    // *************************************************************************
+    // ***   IsRowEmpty   ******************************************************
+    // *************************************************************************
+    // * Check if there no objects on the part of row, so DrawInBufH() with
+    // * background will fill it by background color only.
+    bool IsRowEmpty(int32_t row, int32_t start_y, int32_t n);
+
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+    // *************************************************************************
+    // ***   SetAreaStorage   **************************************************
+    // *************************************************************************
+    // * Set storage for objects that intersect draw area. Without it list goes
+    // * trough all objects for every line. Usually only root list need it.
+    void SetAreaStorage(VisListArea_t* storage);
+
+    // *************************************************************************
+    // ***   SetDrawArea   *****************************************************
+    // *************************************************************************
+    // * Set area that will be drawn by following DrawInBufW() calls. Objects
+    // * that intersect the area collected in storage and for every line only
+    // * objects present on that line are drawn.
+    void SetDrawArea(int32_t start_x, int32_t start_y, int32_t end_x, int32_t end_y);
+#endif
+
     // *************************************************************************
     // ***   Action   **********************************************************
     // *************************************************************************
@@ -144,6 +231,118 @@ class VisList : public VisObject
     // Display driver instance
     DisplayDrv* display_drv = nullptr;
 
+    // *************************************************************************
+    // ***   Private: Draw objects with optional background   ******************
+    // *************************************************************************
+    void DrawObjectsInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x, const color_t* bkg_color);
+
+    // *************************************************************************
+    // ***   Private: Draw objects row with optional background   **************
+    // *************************************************************************
+    void DrawObjectsInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y, const color_t* bkg_color);
+
+    // Max number of separate intervals covered by opaque objects on the line
+    static const int32_t COVER_MAX_CNT = 8;
+
+    // *************************************************************************
+    // ***   Intervals of line covered by opaque objects   *********************
+    // *************************************************************************
+    // * Intervals are sorted and don't overlap or touch each other.
+    typedef struct
+    {
+      // Start of each interval
+      int32_t start[COVER_MAX_CNT];
+      // End of each interval
+      int32_t end[COVER_MAX_CNT];
+      // Number of intervals
+      int32_t cnt;
+    } Cover_t;
+
+    // *************************************************************************
+    // ***   Private: Add interval to covered intervals   **********************
+    // *************************************************************************
+    // * If there no free slot for separate interval, it isn't added. Covered
+    // * part is smaller than it can be, but drawing result is the same.
+    static void CoverAdd(Cover_t& cover, int32_t start, int32_t end);
+
+    // *************************************************************************
+    // ***   Private: Set object part not covered by objects above   ***********
+    // *************************************************************************
+    // * Object extent along the line is clipped to start..end and covered
+    // * intervals are cut from both sides. Result saved in draw_start and
+    // * draw_end of the object, empty if object isn't visible on the line.
+    // * If object is opaque, its extent added to covered intervals.
+    static void CoverObject(Cover_t& cover, VisObject* obj, bool is_on_line, int32_t obj_start, int32_t obj_end, int32_t start, int32_t end);
+
+    // *************************************************************************
+    // ***   Private: Check if whole interval is covered   *********************
+    // *************************************************************************
+    static inline bool IsCovered(const Cover_t& cover, int32_t start, int32_t end)
+    {
+      // Intervals are clipped to start..end, so it can be only first one
+      return (cover.cnt > 0) && (cover.start[0] <= start) && (cover.end[0] >= end);
+    }
+
+    // *************************************************************************
+    // ***   Private: Fill background outside of covered intervals   ***********
+    // *************************************************************************
+    static void CoverFill(const Cover_t& cover, color_t* buf, int32_t n, int32_t start, color_t color);
+
+    // *************************************************************************
+    // ***   Private: Draw object line and update object draw time   ***********
+    // *************************************************************************
+    static inline void DrawObjectInBufW(VisObject* obj, color_t* buf, int32_t n, int32_t line, int32_t start_x)
+    {
+#if defined(DISPLAY_STATS_OBJECTS)
+      uint32_t start = DisplayStats::GetTimestamp();
+      obj->DrawInBufW(buf, n, line, start_x);
+      obj->draw_time += DisplayStats::GetTimestamp() - start;
+#else
+      obj->DrawInBufW(buf, n, line, start_x);
+#endif
+    }
+
+    // *************************************************************************
+    // ***   Private: Draw object row and update object draw time   ************
+    // *************************************************************************
+    static inline void DrawObjectInBufH(VisObject* obj, color_t* buf, int32_t n, int32_t row, int32_t start_y)
+    {
+#if defined(DISPLAY_STATS_OBJECTS)
+      uint32_t start = DisplayStats::GetTimestamp();
+      obj->DrawInBufH(buf, n, row, start_y);
+      obj->draw_time += DisplayStats::GetTimestamp() - start;
+#else
+      obj->DrawInBufH(buf, n, row, start_y);
+#endif
+    }
+#if defined(DISPLAY_AREA_MAX_OBJECTS)
+    // Objects that intersect draw area
+    VisListArea_t* area = nullptr;
+
+    // *************************************************************************
+    // ***   Private: Collect objects that intersect draw area   ***************
+    // *************************************************************************
+    void CollectAreaObjects(int32_t line);
+
+    // *************************************************************************
+    // ***   Private: Check if collected objects can be used for the line   ****
+    // *************************************************************************
+    // * Objects collected again if list changed or new pass over the area
+    // * started.
+    bool IsAreaLine(int32_t line, int32_t start_x, int32_t n);
+
+    // *************************************************************************
+    // ***   Private: Update objects present on the line   *********************
+    // *************************************************************************
+    void UpdateAreaObjects(int32_t line);
+#endif
+
+    // *************************************************************************
+    // ***   Private: Check if object is visible   *****************************
+    // *************************************************************************
+    // * Objects outside of display visibility mask aren't drawn or touched.
+    bool IsObjectVisible(int32_t start_x, int32_t start_y, int32_t end_x, int32_t end_y);
+
     // VisObject is friend for access display_drv
     friend class VisObject;
 };
@@ -175,6 +175,25 @@ Result VisObject::Move(int32_t x, int32_t y, bool is_delta)
   return result;
 }
 
+// *****************************************************************************
+// ***   SetAlpha   ************************************************************
+// *****************************************************************************
+void VisObject::SetAlpha(uint8_t a)
+{
+  // Update object only if alpha changed
+  if(a != alpha)
+  {
+    // Lock object for changes
+    LockVisObject();
+    // Do changes
+    alpha = a;
+    // Invalidate area
+    InvalidateObjArea();
+    // Unlock object after changes
+    UnlockVisObject();
+  }
+}
+
 // *****************************************************************************
 // ***   Action   **************************************************************
 // *****************************************************************************
@@ -198,3 +217,18 @@ void VisObject::InvalidateObjArea(bool force)
   }
 #endif
 }
+
+// *****************************************************************************
+// ***   Invalidate part of Display Area   *************************************
+// *****************************************************************************
+void VisObject::InvalidateObjArea(int32_t start_x, int32_t start_y, int32_t end_x, int32_t end_y)
+{
+#if defined(UPDATE_AREA_ENABLED)
+  // Only if VisObject is show
+  if(IsShow())
+  {
+    // Invalidate area
+    list->InvalidateArea(start_x, start_y, end_x, end_y);
+  }
+#endif
+}
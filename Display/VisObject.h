@@ -156,6 +156,13 @@ class VisObject
     // * Each derived class must implement this function.
     virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0) = 0;
 
+    // *************************************************************************
+    // ***   IsOpaque   ********************************************************
+    // *************************************************************************
+    // * Object is opaque if it overwrites every pixel of its rectangle. Objects
+    // * under opaque one and background aren't drawn on lines it covers.
+    virtual bool IsOpaque(void) {return false;}
+
     // *************************************************************************
     // ***   Action   **********************************************************
     // *************************************************************************
@@ -206,11 +213,47 @@ class VisObject
     // *************************************************************************
     virtual void SetActive(bool is_active) {active = is_active;}
 
+    // *************************************************************************
+    // ***   SetAlpha   ********************************************************
+    // *************************************************************************
+    // * Set opacity of object: 0 - invisible, 255 - opaque(default). Objects
+    // * that support it blend own pixels with pixels under it: Box, ShadowBox
+    // * and Image(together with alpha map). Other objects, including String,
+    // * StringAligned, MultiLineString, Line, Circle, Triangle, ImagePalette,
+    // * ImageBitmap and ImageBinary, ignore alpha and always drawn opaque.
+    void SetAlpha(uint8_t a);
+
+    // *************************************************************************
+    // ***   GetAlpha   ********************************************************
+    // *************************************************************************
+    uint8_t GetAlpha(void) {return alpha;}
+
     // *************************************************************************
     // ***   Invalidate Object Area   ******************************************
     // *************************************************************************
     virtual void InvalidateObjArea(bool force = false);
 
+    // *************************************************************************
+    // ***   Invalidate part of Object Area   **********************************
+    // *************************************************************************
+    // * Coordinates are in the same space as object coordinates. Used by
+    // * objects that know which part of it changed.
+    void InvalidateObjArea(int32_t start_x, int32_t start_y, int32_t end_x, int32_t end_y);
+
+#if defined(DISPLAY_STATS_OBJECTS)
+    // *************************************************************************
+    // ***   Get time spent for drawing object   *******************************
+    // *************************************************************************
+    // * Cumulative time of DrawInBufW()/DrawInBufH() calls in DisplayStats
+    // * timestamp units.
+    uint32_t GetDrawTime(void) {return draw_time;}
+
+    // *************************************************************************
+    // ***   Clear time spent for drawing object   *****************************
+    // *************************************************************************
+    void ClearDrawTime(void) {draw_time = 0u;}
+#endif
+
   protected:
     // *************************************************************************
     // ***   Object parameters   ***********************************************
@@ -224,6 +267,8 @@ class VisObject
     int16_t width = 0, height = 0;
     // Object active
     bool active = false;
+    // Object opacity
+    uint8_t alpha = 255u;
 
   private:
     // *************************************************************************
@@ -241,6 +286,12 @@ class VisObject
     VisObject* p_prev = nullptr;
     // Current list for object
     VisList* list = nullptr;
+    // Part of current line not covered by opaque objects above, set by VisList
+    int16_t draw_start = 0, draw_end = -1;
+#if defined(DISPLAY_STATS_OBJECTS)
+    // Time spent for drawing object
+    uint32_t draw_time = 0u;
+#endif
 
     // Default list that used for all objects in case of multiple DisplayDrv
     // don't forget to set list manually for each VisObject
@@ -162,6 +162,31 @@ Result StHalSpi::Abort(void)
   return result;
 }
 
+// *****************************************************************************
+// ***   Public: Set callback for asynchronous transfer completion   ***********
+// *****************************************************************************
+Result StHalSpi::SetTransferCompleteCallback(ICallback* callback)
+{
+  // Save callback pointer
+  transfer_complete_callback = callback;
+  // Always Ok
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Public: Transfer complete handler   ***********************************
+// *****************************************************************************
+void StHalSpi::TransferCompleteHandler(void)
+{
+  // Copy pointer since it can be changed
+  ICallback* callback = transfer_complete_callback;
+  // Call callback if it is set
+  if(callback != nullptr)
+  {
+    callback->Callback(this);
+  }
+}
+
 #if defined(STM32F1) || defined(STM32F4)
 // *****************************************************************************
 // ***   Public: SetSpeed   ****************************************************
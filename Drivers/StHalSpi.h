@@ -133,6 +133,18 @@ class StHalSpi : public ISpi
     // *************************************************************************
     virtual Result Abort(void);
 
+    // *************************************************************************
+    // ***   Public: Set callback for asynchronous transfer completion   *******
+    // *************************************************************************
+    virtual Result SetTransferCompleteCallback(ICallback* callback);
+
+    // *************************************************************************
+    // ***   Public: Transfer complete handler   *******************************
+    // *************************************************************************
+    // * Should be called from HAL_SPI_TxCpltCallback() and
+    // * HAL_SPI_TxRxCpltCallback() for SPI handle used by this object.
+    void TransferCompleteHandler(void);
+
 #if defined(STM32F1) || defined(STM32F4)
     // *************************************************************************
     // ***   Public: SetSpeed   ************************************************
@@ -159,6 +171,9 @@ class StHalSpi : public ISpi
     // Reference to the SPI handle
     SPI_HandleTypeDef& hspi;
 
+    // Callback for asynchronous transfer completion
+    ICallback* volatile transfer_complete_callback = nullptr;
+
     // *************************************************************************
     // ***   Private: GetToDataSizeBytes   *************************************
     // *************************************************************************
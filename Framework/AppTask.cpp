@@ -196,7 +196,7 @@ Result AppTask::IntLoop()
       switch(ctrl_msg.type)
       {
         case CTRL_TIMER_MSG:
-          result = TimerExpired((uint32_t)ctrl_msg.ptr); // Call timer and pass time passed since last call
+          result = TimerExpired((uint32_t)(uintptr_t)ctrl_msg.ptr); // Call timer and pass time passed since last call
           break;
 
         case CTRL_CALLBACK_MSG:
@@ -329,7 +329,7 @@ void AppTask::TimerCallback(void* ptr)
     // Create control timer message
     CtrlQueueMsg timer_msg;
     timer_msg.type = CTRL_TIMER_MSG;
-    timer_msg.ptr = (void*)task.timer_skip_cnt; // Save timer skip counter as pointer
+    timer_msg.ptr = (void*)(uintptr_t)task.timer_skip_cnt; // Save timer skip counter as pointer
 
     // Send message to the control queue
     result = task.SendControlMessage(timer_msg, task.timer_priority);
@@ -91,6 +91,11 @@ class Rtos
     // *************************************************************************
     static inline void* GetCurrentTaskParam() {return (void*)xTaskGetApplicationTaskTag(xTaskGetCurrentTaskHandle());}
 
+    // *************************************************************************
+    // ***   GetCurrentTaskHandle   ********************************************
+    // *************************************************************************
+    static inline TaskHandle_t GetCurrentTaskHandle() {return xTaskGetCurrentTaskHandle();}
+
     // *************************************************************************
     // ***   Alloc   ***********************************************************
     // *************************************************************************
@@ -69,7 +69,7 @@ Result RtosQueue::Create()
     if(queue != nullptr)
     {
       // If name present - add to registry
-      if(queue_name[0] != '\0')
+      if((queue_name != nullptr) && (queue_name[0] != '\0'))
       {
         vQueueAddToRegistry(queue, queue_name);
       }
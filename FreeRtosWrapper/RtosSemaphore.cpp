@@ -87,18 +87,18 @@ Result RtosSemaphore::Take(TickType_t ticks_to_wait)
 
 
 // *****************************************************************************
-// ***   Take   ****************************************************************
+// ***   Give   ****************************************************************
 // *****************************************************************************
 Result RtosSemaphore::Give()
 {
   Result result;
   // Variable for check result
-  BaseType_t res = xSemaphoreGive(semaphore);
+  BaseType_t res = pdFALSE;
 
   // Check handler mode
   if(Rtos::IsInHandlerMode())
   {
-    BaseType_t task_woken;
+    BaseType_t task_woken = pdFALSE;
     // Give semaphore from ISR
     res = xSemaphoreGiveFromISR(semaphore, &task_woken);
     // Switch context if needed
@@ -56,6 +56,7 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include <DevCfg.h>
+#include "Interfaces/ICallback.h"
 
 // *****************************************************************************
 // ***   IDisplay   ************************************************************
@@ -75,6 +76,15 @@ class IDisplay
       ROTATION_CNT
     };
 
+    // *************************************************************************
+    // ***   Visible span of display line   ************************************
+    // *************************************************************************
+    struct Span
+    {
+      int16_t start;
+      int16_t end;
+    };
+
     // *************************************************************************
     // ***   Public: Constructor   *********************************************
     // *************************************************************************
@@ -101,6 +111,13 @@ class IDisplay
     // *************************************************************************
     virtual Result WriteDataStream(uint8_t* data, uint32_t n) = 0;
 
+    // *************************************************************************
+    // ***   Public: Write same color to output window   ***********************
+    // *************************************************************************
+    // * Sends n pixels of given color to window set by SetAddrWindow().
+    // * Blocking, transfer started by WriteDataStream() should be completed.
+    virtual Result WriteColor(color_t color, uint32_t n) {return Result::ERR_NOT_IMPLEMENTED;}
+
     // *************************************************************************
     // ***   Public: Check transfer status  ************************************
     // *************************************************************************
@@ -111,6 +128,13 @@ class IDisplay
     // *************************************************************************
     virtual Result StopTransfer(void) = 0;
 
+    // *************************************************************************
+    // ***   Public: Set callback for data stream transfer completion   ********
+    // *************************************************************************
+    // * Callback is called from interrupt context when transfer started by
+    // * WriteDataStream() is complete. Pass nullptr to remove callback.
+    virtual Result SetTransferCompleteCallback(ICallback* callback) {return Result::ERR_NOT_IMPLEMENTED;}
+
     // *************************************************************************
     // ***   Public: Set output window   ***************************************
     // *************************************************************************
@@ -156,6 +180,34 @@ class IDisplay
     // *************************************************************************
     virtual Result InvertDisplay(bool invert) {return Result::ERR_NOT_IMPLEMENTED;}
 
+    // *************************************************************************
+    // ***   Public: Set vertical scroll area   ********************************
+    // *************************************************************************
+    // * Lines from start to end(inclusive) are scrolled by display controller.
+    // * Lines are rows or columns of the screen depending on rotation, see
+    // * IsScrollAlongX(). Scroll offset is reset to zero.
+    virtual Result SetScrollArea(uint16_t start, uint16_t end) {return Result::ERR_NOT_IMPLEMENTED;}
+
+    // *************************************************************************
+    // ***   Public: Set vertical scroll offset   ******************************
+    // *************************************************************************
+    // * Line start + i of scroll area shows line start + (i + offset) % size
+    // * of display memory.
+    virtual Result SetScrollOffset(uint16_t offset) {return Result::ERR_NOT_IMPLEMENTED;}
+
+    // *************************************************************************
+    // ***   Public: Check if display scrolls along X axis   *******************
+    // *************************************************************************
+    virtual bool IsScrollAlongX(void) {return false;}
+
+    // *************************************************************************
+    // ***   Public: Get visibility mask   *************************************
+    // *************************************************************************
+    // * Returns visible span of each of GetHeight() lines in current rotation
+    // * or nullptr if whole rectangle is visible. Line with span start greater
+    // * than end isn't visible at all.
+    virtual const Span* GetVisibleMask(void) {return nullptr;}
+
     // *************************************************************************
     // ***   Return if data have to be prepared before send to display   *******
     // *************************************************************************
@@ -56,6 +56,7 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DevCfg.h"
+#include "Interfaces/ICallback.h"
 
 // *****************************************************************************
 // ***   SPI Driver Interface   ************************************************
@@ -134,6 +135,14 @@ class ISpi
     // *************************************************************************
     virtual Result Abort(void) {return Result::ERR_NOT_IMPLEMENTED;}
 
+    // *************************************************************************
+    // ***   Public: Set callback for asynchronous transfer completion   *******
+    // *************************************************************************
+    // * Callback is called from interrupt context when asynchronous transfer
+    // * is complete. Pointer to this ISpi object passed as callback parameter.
+    // * Pass nullptr to remove callback.
+    virtual Result SetTransferCompleteCallback(ICallback* callback) {return Result::ERR_NOT_IMPLEMENTED;}
+
     // *************************************************************************
     // ***   Public: SetSpeed   ************************************************
     // *************************************************************************
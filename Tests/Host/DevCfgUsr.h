@@ -0,0 +1,49 @@
+// *****************************************************************************
+// @file DevCfgUsr.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: User configuration for host build
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef DevCfgUsr_h
+#define DevCfgUsr_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <cstdlib>
+#include <chrono>
+
+// *****************************************************************************
+// ***   RTOS Wrapper   ********************************************************
+// *****************************************************************************
+#define FREERTOS_WRAPPER
+
+// *****************************************************************************
+// ***   Display Configuration   ***********************************************
+// *****************************************************************************
+
+// Host display is 320x240, color depth and other options set by Makefile
+#define DISPLAY_MAX_BUF_LEN 320u
+
+// Microseconds of host clock for display statistics
+#define DISPLAY_STATS_TIMESTAMP() ((uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count())
+
+// *****************************************************************************
+// ***   Break() macro   *******************************************************
+// *****************************************************************************
+
+// Errors should stop tests
+#define Break() abort()
+
+#endif
@@ -0,0 +1,319 @@
+// *****************************************************************************
+// @file GoldenTest.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Golden image test for host build
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// * Renders scenes by DisplayDrv into MemoryDisplay and compares CRC of each
+// * frame with CRC of known good image. Failed scene is saved as PPM file.
+// *
+// * Usage: GoldenTest [-u] [-l] [-p dir]
+// *   -u     print CRCs of current output to update golden table after
+// *          intended change of rendering(check PPM images first)
+// *   -l     draw by columns(UPDATE_LEFT_RIGHT), image have to be the same
+// *   -p dir save PPM of every scene to given directory(default - only failed
+// *          ones are saved to current directory)
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "Display/DisplayDrv.h"
+#include "Display/MemoryDisplay.h"
+#include "Display/Primitives.h"
+#include "Display/Image.h"
+#include "Display/Strng.h"
+#include "task.h"
+#include "Display/Fonts/Font_4x6.h"
+#include "Display/Fonts/Font_6x8.h"
+#include "Display/Fonts/Font_8x12.h"
+#include "Display/Fonts/Font_10x18.h"
+#include "Display/Fonts/Font_12x16.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// *****************************************************************************
+// ***   Test screen   *********************************************************
+// *****************************************************************************
+static const int32_t WIDTH = 320;
+static const int32_t HEIGHT = 240;
+static color_t screen[WIDTH * HEIGHT];
+static MemoryDisplay display(WIDTH, HEIGHT, screen);
+
+// *****************************************************************************
+// ***   Test images   *********************************************************
+// *****************************************************************************
+static const int32_t IMG_W = 48;
+static const int32_t IMG_H = 40;
+static color_t img_bitmap[IMG_W * IMG_H];
+static uint8_t img_palette[IMG_W * IMG_H];
+static color_t palette[16];
+static uint8_t img_binary[IMG_H * ((IMG_W + 7) / 8)];
+static uint8_t img_alpha[IMG_W * IMG_H];
+static ImageDesc img_desc;
+
+// *****************************************************************************
+// ***   Fill test images   ****************************************************
+// *****************************************************************************
+static void FillImages(void)
+{
+  static const color_t colors[] = {COLOR_BLACK, COLOR_RED, COLOR_YELLOW, COLOR_GREEN,
+                                   COLOR_CYAN, COLOR_BLUE, COLOR_MAGENTA, COLOR_WHITE};
+  for(uint32_t i = 0u; i < NumberOf(palette); i++)
+  {
+    palette[i] = colors[i % NumberOf(colors)];
+  }
+  for(int32_t y = 0; y < IMG_H; y++)
+  {
+    for(int32_t x = 0; x < IMG_W; x++)
+    {
+      img_bitmap[y * IMG_W + x] = colors[((x / 6) + (y / 5)) % NumberOf(colors)];
+      img_palette[y * IMG_W + x] = (uint8_t)((x * 3 + y * 5) % NumberOf(palette));
+      // Opacity falls from left to right
+      img_alpha[y * IMG_W + x] = (uint8_t)(255 - x * 255 / (IMG_W - 1));
+      // Checkerboard with diagonal
+      if((((x / 4) + (y / 4)) % 2u == 0u) || (x == y))
+      {
+        img_binary[y * ((IMG_W + 7) / 8) + x / 8] |= (uint8_t)(0x80u >> (x % 8));
+      }
+    }
+  }
+  // Palette image with alpha map
+  img_desc.width = IMG_W;
+  img_desc.height = IMG_H;
+  img_desc.bits_per_pixel = 8u;
+  img_desc.imgp = img_palette;
+  img_desc.palette = palette;
+  img_desc.alpha_map = img_alpha;
+}
+
+// *****************************************************************************
+// ***   Scene: primitives   ***************************************************
+// *****************************************************************************
+static void ScenePrimitives(std::vector<VisObject*>& objs)
+{
+  objs.push_back(new Box(0, 0, WIDTH, HEIGHT, COLOR_BLUE));
+  objs.push_back(new Box(10, 10, 60, 40, COLOR_RED));
+  objs.push_back(new Box(80, 10, 60, 40, COLOR_YELLOW, false));
+  objs.push_back(new Line(0, 0, WIDTH - 1, HEIGHT - 1, COLOR_WHITE));
+  objs.push_back(new Line(WIDTH - 1, 0, 0, HEIGHT - 1, COLOR_GREEN));
+  objs.push_back(new Line(20, 200, 300, 180, COLOR_CYAN));
+  objs.push_back(new Line(160, 5, 165, 235, COLOR_MAGENTA));
+  objs.push_back(new Circle(200, 60, 40, COLOR_GREEN, true));
+  objs.push_back(new Circle(260, 60, 30, COLOR_WHITE, false));
+  objs.push_back(new Circle(100, 120, 25, COLOR_CYAN, true, true));
+  objs.push_back(new Triangle(20, 230, 80, 130, 140, 220, COLOR_YELLOW, true));
+  objs.push_back(new Triangle(180, 230, 240, 130, 300, 220, COLOR_RED, false));
+}
+
+// *****************************************************************************
+// ***   Scene: text   *********************************************************
+// *****************************************************************************
+static void SceneText(std::vector<VisObject*>& objs)
+{
+  objs.push_back(new Box(0, 0, WIDTH, HEIGHT, COLOR_BLACK));
+  objs.push_back(new String("Font 4x6: The quick brown fox", 4, 4, COLOR_WHITE, Font_4x6::GetInstance()));
+  objs.push_back(new String("Font 6x8: jumps over the lazy dog", 4, 14, COLOR_YELLOW, Font_6x8::GetInstance()));
+  objs.push_back(new String("Font 8x12: 0123456789", 4, 26, COLOR_GREEN, COLOR_BLUE, Font_8x12::GetInstance()));
+  objs.push_back(new String("Font 10x18: ABCXYZ", 4, 42, COLOR_CYAN, Font_10x18::GetInstance()));
+  objs.push_back(new String("Font 12x16: !@#$%", 4, 64, COLOR_MAGENTA, COLOR_WHITE, Font_12x16::GetInstance()));
+  // Scaled text with and without background
+  String* s = new String("x2 opaque", 4, 90, COLOR_WHITE, COLOR_RED, Font_8x12::GetInstance());
+  s->SetScale(2u);
+  objs.push_back(s);
+  s = new String("x3", 4, 120, COLOR_YELLOW, Font_8x12::GetInstance());
+  s->SetScale(3u);
+  objs.push_back(s);
+  // Text clipped by screen edges
+  objs.push_back(new String("Clipped text at the right edge", 200, 180, COLOR_WHITE, Font_8x12::GetInstance()));
+  objs.push_back(new String("Clipped at the bottom", 4, 234, COLOR_GREEN, Font_8x12::GetInstance()));
+}
+
+// *****************************************************************************
+// ***   Scene: images   *******************************************************
+// *****************************************************************************
+static void SceneImages(std::vector<VisObject*>& objs)
+{
+  objs.push_back(new Box(0, 0, WIDTH, HEIGHT, COLOR_DARKGREY));
+  objs.push_back(new ImageBitmap(10, 10, IMG_W, IMG_H, img_bitmap));
+  objs.push_back(new ImagePalette(70, 10, IMG_W, IMG_H, img_palette, palette));
+  ImageBinary* b = new ImageBinary(130, 10, IMG_W, IMG_H, img_binary);
+  b->SetColor(COLOR_YELLOW);
+  objs.push_back(b);
+  // Images partially outside of the screen
+  objs.push_back(new ImageBitmap(-20, 120, IMG_W, IMG_H, img_bitmap));
+  objs.push_back(new ImagePalette(WIDTH - 20, 200, IMG_W, IMG_H, img_palette, palette));
+  // Overlapping images
+  objs.push_back(new ImageBitmap(150, 100, IMG_W, IMG_H, img_bitmap));
+  objs.push_back(new ImagePalette(170, 120, IMG_W, IMG_H, img_palette, palette));
+}
+
+// *****************************************************************************
+// ***   Scene: alpha   ********************************************************
+// *****************************************************************************
+static void SceneAlpha(std::vector<VisObject*>& objs)
+{
+  objs.push_back(new Box(0, 0, WIDTH, HEIGHT, COLOR_WHITE));
+  objs.push_back(new Box(20, 20, 200, 120, COLOR_RED));
+  Box* box = new Box(100, 60, 200, 120, COLOR_BLUE);
+  box->SetAlpha(128u);
+  objs.push_back(box);
+  Box* frame = new Box(40, 100, 100, 60, COLOR_GREEN, false);
+  frame->SetAlpha(64u);
+  objs.push_back(frame);
+  // Image with alpha map, alone and with object alpha
+  objs.push_back(new Image(200, 150, img_desc));
+  Image* img = new Image(250, 150, img_desc);
+  img->SetAlpha(128u);
+  objs.push_back(img);
+#if defined(COLOR_24BIT) || defined(COLOR_16BIT)
+  ShadowBox* shadow = new ShadowBox(30, 150, 120, 40);
+  shadow->SetAlpha(128u);
+  objs.push_back(shadow);
+#endif
+}
+
+// *****************************************************************************
+// ***   Scene: sparse   *******************************************************
+// *****************************************************************************
+// * No full screen object: lines without objects are sent as background color.
+static void SceneSparse(std::vector<VisObject*>& objs)
+{
+  objs.push_back(new Box(20, 10, 80, 30, COLOR_RED));
+  objs.push_back(new String("Sparse scene", 120, 20, COLOR_WHITE, Font_8x12::GetInstance()));
+  objs.push_back(new Circle(160, 120, 20, COLOR_GREEN, true));
+  objs.push_back(new Line(10, 180, 300, 181, COLOR_YELLOW));
+  objs.push_back(new Box(250, 200, 40, 30, COLOR_BLUE, false));
+}
+
+// *****************************************************************************
+// ***   Scenes   **************************************************************
+// *****************************************************************************
+typedef struct
+{
+  // Scene name, also used as PPM file name
+  const char* name;
+  // Function that creates scene objects
+  void (*build)(std::vector<VisObject*>& objs);
+  // CRC of known good image for current color depth
+  uint32_t golden_crc;
+} Scene;
+
+// Select CRC of known good image for color depth: 16 bit, 24 bit, 3 bit
+#if defined(COLOR_24BIT)
+  #define GOLDEN(crc16, crc24, crc3) crc24
+#elif defined(COLOR_16BIT)
+  #define GOLDEN(crc16, crc24, crc3) crc16
+#else
+  #define GOLDEN(crc16, crc24, crc3) crc3
+#endif
+
+static const Scene scenes[] =
+{
+  {"primitives", ScenePrimitives, GOLDEN(0x29E43BF8u, 0x54383646u, 0x61BBBDC8u)},
+  {"text",       SceneText,       GOLDEN(0xA30D39FDu, 0x695C6CE5u, 0x23F01A8Bu)},
+  {"images",     SceneImages,     GOLDEN(0x68A21306u, 0x6C588239u, 0x21398497u)},
+  {"alpha",      SceneAlpha,      GOLDEN(0x0B7BBC0Au, 0x6ED62A93u, 0xF5F965FFu)},
+  {"sparse",     SceneSparse,     GOLDEN(0x9DFB0DECu, 0xDBE5A788u, 0x90C9987Bu)}
+};
+
+// *****************************************************************************
+// ***   Render scene and return CRC of screen   *******************************
+// *****************************************************************************
+static uint32_t RenderScene(const Scene& scene)
+{
+  DisplayDrv& drv = DisplayDrv::GetInstance();
+  // Create objects and show them in order of creation
+  std::vector<VisObject*> objs;
+  scene.build(objs);
+  for(uint32_t i = 0u; i < objs.size(); i++)
+  {
+    objs[i]->Show(i);
+  }
+  // Draw one frame
+  display.ClearCounters();
+  drv.UpdateDisplay();
+  drv.Loop();
+  // Remove objects
+  for(uint32_t i = 0u; i < objs.size(); i++)
+  {
+    objs[i]->Hide();
+    delete objs[i];
+  }
+  // Return result
+  return display.GetCrc();
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  bool is_update = false;
+  bool is_left_right = false;
+  const char* ppm_dir = nullptr;
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-u") == 0) is_update = true;
+    else if(strcmp(argv[i], "-l") == 0) is_left_right = true;
+    else if((strcmp(argv[i], "-p") == 0) && (i + 1 < argc)) ppm_dir = argv[++i];
+    else
+    {
+      printf("Usage: %s [-u] [-l] [-p dir]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  FillImages();
+  // Display driver have to be set before scheduler started. Task itself is
+  // never run: frames are drawn by calling Loop().
+  DisplayDrv& drv = DisplayDrv::GetInstance();
+  drv.InitTask(display);
+#if defined(DISPLAY_TRANSFER_TASK)
+  // Transfer task created by Setup() runs in own thread
+  vHostTaskRun("DisplayTransfer");
+#endif
+  drv.Setup();
+  if(is_left_right) drv.SetUpdateMode(DisplayDrv::UPDATE_LEFT_RIGHT);
+
+  uint32_t failed = 0u;
+  for(uint32_t i = 0u; i < NumberOf(scenes); i++)
+  {
+    uint32_t crc = RenderScene(scenes[i]);
+    bool is_pass = (crc == scenes[i].golden_crc);
+    if(is_update)
+    {
+      printf("%-12s 0x%08Xu\n", scenes[i].name, crc);
+    }
+    else
+    {
+      printf("%-12s 0x%08X %s (%u transfers, %u bytes, %u windows)\n", scenes[i].name, crc,
+             is_pass ? "PASS" : "FAIL", display.GetTransfersCnt(), display.GetBytesCnt(), display.GetWindowsCnt());
+    }
+    // Save image of failed scene or all scenes if directory given
+    if(!is_pass || (ppm_dir != nullptr))
+    {
+      std::string file_name = std::string((ppm_dir != nullptr) ? ppm_dir : ".") + "/" + scenes[i].name + ".ppm";
+      display.SavePpm(file_name.c_str());
+    }
+    if(!is_pass) failed++;
+  }
+
+  if(!is_update) printf("%u of %u scenes failed\n", failed, (uint32_t)NumberOf(scenes));
+  return (failed == 0u) ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+// *****************************************************************************
+// @file FreeRTOS.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Host RTOS shim, FreeRTOS types and configuration
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// * Minimal replacement of FreeRTOS for host builds. Tasks are created, but
+// * not run: test calls Setup()/Loop() of the task itself. Task named by
+// * vHostTaskRun() runs in own thread. Blocking calls block with timeout like
+// * in FreeRTOS. Tick is millisecond of host monotonic clock.
+
+#ifndef FreeRTOS_h
+#define FreeRTOS_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include <stddef.h>
+
+// *****************************************************************************
+// ***   Types   ***************************************************************
+// *****************************************************************************
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void* TaskHandle_t;
+typedef void* QueueHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef void* TimerHandle_t;
+typedef struct {void* dummy[4];} StaticSemaphore_t;
+typedef void (*TaskFunction_t)(void*);
+typedef BaseType_t (*TaskHookFunction_t)(void*);
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t);
+
+// *****************************************************************************
+// ***   Configuration   *******************************************************
+// *****************************************************************************
+#define configMINIMAL_STACK_SIZE 128
+#define configTIMER_TASK_PRIORITY 6
+#define configMAX_PRIORITIES 7
+#define configSUPPORT_STATIC_ALLOCATION 1
+#define configUSE_RECURSIVE_MUTEXES 1
+#define tskIDLE_PRIORITY 0
+
+// *****************************************************************************
+// ***   Port   ****************************************************************
+// *****************************************************************************
+#define portBASE_TYPE long
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define portEND_SWITCHING_ISR(x) (void)(x)
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS 1
+#define pdFAIL 0
+#define errQUEUE_EMPTY 0
+#define errQUEUE_FULL 0
+
+// *****************************************************************************
+// ***   Memory   **************************************************************
+// *****************************************************************************
+void* pvPortMalloc(size_t size);
+void vPortFree(void* ptr);
+
+#endif
@@ -0,0 +1,382 @@
+// *****************************************************************************
+// @file HostRtos.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Host RTOS shim, implementation
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+// *****************************************************************************
+// ***   Queue object   ********************************************************
+// *****************************************************************************
+// * Semaphores and mutexes are queues with zero item size like in FreeRTOS.
+struct HostQueue
+{
+  // Maximum number of items
+  UBaseType_t len = 0u;
+  // Item size in bytes
+  UBaseType_t item_size = 0u;
+  // Items
+  std::deque<std::vector<uint8_t>> items;
+  // Mutex holder and recursive take count
+  TaskHandle_t holder = nullptr;
+  uint32_t recursive_cnt = 0u;
+  // Object is mutex
+  bool is_mutex = false;
+  // Object is deleted
+  bool is_deleted = false;
+};
+
+// *****************************************************************************
+// ***   Timer object   ********************************************************
+// *****************************************************************************
+struct HostTimer
+{
+  void* id = nullptr;
+  TickType_t period = 0u;
+  bool is_active = false;
+};
+
+// *****************************************************************************
+// ***   Task object   *********************************************************
+// *****************************************************************************
+struct HostTask
+{
+  TaskFunction_t func = nullptr;
+  void* param = nullptr;
+  TaskHookFunction_t tag = nullptr;
+  bool is_started = false;
+};
+
+// *****************************************************************************
+// ***   Shim state   **********************************************************
+// *****************************************************************************
+// Thread of program is "main" task
+static HostTask main_task;
+// Task of current thread
+static thread_local HostTask* current_task = &main_task;
+// Scheduler state
+static BaseType_t scheduler_state = taskSCHEDULER_NOT_STARTED;
+// * Objects below are created on first use, since queues are created by
+// * constructors of static objects too. They are never destroyed, so task
+// * threads still blocked at program exit don't use destroyed ones.
+// Lock for all queues
+static std::mutex& QueueLock(void) {static std::mutex* lock = new std::mutex(); return *lock;}
+// Condition for all queues
+static std::condition_variable& QueueCond(void) {static std::condition_variable* cond = new std::condition_variable(); return *cond;}
+// Lock for critical section
+static std::recursive_mutex& CriticalLock(void) {static std::recursive_mutex* lock = new std::recursive_mutex(); return *lock;}
+// Names of tasks to run
+static std::vector<std::string>& RunNames(void) {static std::vector<std::string>* names = new std::vector<std::string>(); return *names;}
+
+// *****************************************************************************
+// ***   Memory   **************************************************************
+// *****************************************************************************
+void* pvPortMalloc(size_t size) {return malloc(size);}
+void vPortFree(void* ptr) {free(ptr);}
+
+// *****************************************************************************
+// ***   Critical sections   ***************************************************
+// *****************************************************************************
+void vPortYield(void) {std::this_thread::yield();}
+void vPortEnterCritical(void) {CriticalLock().lock();}
+void vPortExitCritical(void) {CriticalLock().unlock();}
+
+// *****************************************************************************
+// ***   Tasks   ***************************************************************
+// *****************************************************************************
+BaseType_t xTaskCreate(TaskFunction_t func, const char* name, uint32_t stack, void* param, UBaseType_t prio, TaskHandle_t* handle)
+{
+  HostTask* task = new HostTask();
+  task->func = func;
+  task->param = param;
+  // Task is run only if its name was given to vHostTaskRun()
+  std::lock_guard<std::mutex> lock(QueueLock());
+  for(uint32_t i = 0u; (i < RunNames().size()) && !task->is_started; i++)
+  {
+    if((name != nullptr) && (RunNames()[i] == name))
+    {
+      task->is_started = true;
+      // Thread is never joined: task functions don't return
+      std::thread([task]() {current_task = task; task->func(task->param);}).detach();
+    }
+  }
+  if(handle != nullptr) *handle = task;
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+  // Running task isn't deleted since its thread uses it
+  if((task != nullptr) && (task != &main_task) && !((HostTask*)task)->is_started) delete (HostTask*)task;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+void vTaskDelayUntil(TickType_t* prev_wake, TickType_t ticks)
+{
+  *prev_wake += ticks;
+  TickType_t now = xTaskGetTickCount();
+  if((int32_t)(*prev_wake - now) > 0) vTaskDelay(*prev_wake - now);
+}
+
+void vTaskSetApplicationTaskTag(TaskHandle_t task, TaskHookFunction_t tag)
+{
+  if(task == nullptr) task = current_task;
+  ((HostTask*)task)->tag = tag;
+}
+
+TaskHookFunction_t xTaskGetApplicationTaskTag(TaskHandle_t task)
+{
+  if(task == nullptr) task = current_task;
+  return ((HostTask*)task)->tag;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {return current_task;}
+
+void vHostTaskRun(const char* name)
+{
+  std::lock_guard<std::mutex> lock(QueueLock());
+  RunNames().push_back(name);
+}
+
+// *****************************************************************************
+// ***   Scheduler   ***********************************************************
+// *****************************************************************************
+void vTaskStartScheduler(void) {scheduler_state = taskSCHEDULER_RUNNING;}
+BaseType_t xTaskGetSchedulerState(void) {return scheduler_state;}
+void vTaskSuspendAll(void) {}
+BaseType_t xTaskResumeAll(void) {return pdFALSE;}
+
+// *****************************************************************************
+// ***   Ticks   ***************************************************************
+// *****************************************************************************
+TickType_t xTaskGetTickCount(void)
+{
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (TickType_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+TickType_t xTaskGetTickCountFromISR(void) {return xTaskGetTickCount();}
+
+// *****************************************************************************
+// ***   Queues   **************************************************************
+// *****************************************************************************
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item_size)
+{
+  HostQueue* q = new HostQueue();
+  q->len = len;
+  q->item_size = item_size;
+  return q;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+  // Memory isn't freed: task thread still can wait for queue at program exit
+  std::lock_guard<std::mutex> lock(QueueLock());
+  ((HostQueue*)queue)->is_deleted = true;
+  ((HostQueue*)queue)->items.clear();
+}
+
+void vQueueAddToRegistry(QueueHandle_t queue, const char* name) {}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+  std::lock_guard<std::mutex> lock(QueueLock());
+  ((HostQueue*)queue)->items.clear();
+  QueueCond().notify_all();
+  return pdPASS;
+}
+
+// * Waits until ready() returns true or ticks passed, queue lock have to be
+// * taken.
+template<typename T> static bool WaitQueue(std::unique_lock<std::mutex>& lock, TickType_t ticks, T ready)
+{
+  bool result = true;
+  if(ticks == portMAX_DELAY) QueueCond().wait(lock, ready);
+  else                       result = QueueCond().wait_for(lock, std::chrono::milliseconds(ticks), ready);
+  return result;
+}
+
+static BaseType_t QueueSend(QueueHandle_t queue, const void* item, bool is_front, TickType_t ticks)
+{
+  BaseType_t result = pdFALSE;
+  HostQueue* q = (HostQueue*)queue;
+  std::unique_lock<std::mutex> lock(QueueLock());
+  if(WaitQueue(lock, ticks, [q]() {return !q->is_deleted && (q->items.size() < q->len);}))
+  {
+    std::vector<uint8_t> data(q->item_size);
+    if(q->item_size != 0u) memcpy(data.data(), item, q->item_size);
+    if(is_front) q->items.push_front(data);
+    else         q->items.push_back(data);
+    // Given mutex has no holder
+    if(q->is_mutex) q->holder = nullptr;
+    QueueCond().notify_all();
+    result = pdPASS;
+  }
+  return result;
+}
+
+static BaseType_t QueueReceive(QueueHandle_t queue, void* item, bool is_remove, TickType_t ticks)
+{
+  BaseType_t result = pdFALSE;
+  HostQueue* q = (HostQueue*)queue;
+  std::unique_lock<std::mutex> lock(QueueLock());
+  if(WaitQueue(lock, ticks, [q]() {return !q->is_deleted && !q->items.empty();}))
+  {
+    if(q->item_size != 0u) memcpy(item, q->items.front().data(), q->item_size);
+    if(is_remove)
+    {
+      q->items.pop_front();
+      // Taken mutex is held by current task
+      if(q->is_mutex) q->holder = current_task;
+      QueueCond().notify_all();
+    }
+    result = pdPASS;
+  }
+  return result;
+}
+
+static UBaseType_t QueueCount(QueueHandle_t queue)
+{
+  std::lock_guard<std::mutex> lock(QueueLock());
+  return ((HostQueue*)queue)->items.size();
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void* item, TickType_t ticks) {return QueueSend(queue, item, false, ticks);}
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticks) {return QueueSend(queue, item, true, ticks);}
+BaseType_t xQueueSendToBackFromISR(QueueHandle_t queue, const void* item, BaseType_t* woken) {return QueueSend(queue, item, false, 0u);}
+BaseType_t xQueueSendToFrontFromISR(QueueHandle_t queue, const void* item, BaseType_t* woken) {return QueueSend(queue, item, true, 0u);}
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {return QueueReceive(queue, item, true, ticks);}
+BaseType_t xQueueReceiveFromISR(QueueHandle_t queue, void* item, BaseType_t* woken) {return QueueReceive(queue, item, true, 0u);}
+BaseType_t xQueuePeek(QueueHandle_t queue, void* item, TickType_t ticks) {return QueueReceive(queue, item, false, ticks);}
+BaseType_t xQueuePeekFromISR(QueueHandle_t queue, void* item) {return QueueReceive(queue, item, false, 0u);}
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {return QueueCount(queue);}
+UBaseType_t uxQueueMessagesWaitingFromISR(QueueHandle_t queue) {return QueueCount(queue);}
+BaseType_t xQueueIsQueueEmptyFromISR(QueueHandle_t queue) {return (QueueCount(queue) == 0u);}
+BaseType_t xQueueIsQueueFullFromISR(QueueHandle_t queue) {return (QueueCount(queue) >= ((HostQueue*)queue)->len);}
+
+// *****************************************************************************
+// ***   Semaphores and mutexes   **********************************************
+// *****************************************************************************
+SemaphoreHandle_t xSemaphoreCreateBinary(void) {return xQueueCreate(1u, 0u);}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+  // Mutex is created given
+  HostQueue* q = (HostQueue*)xQueueCreate(1u, 0u);
+  q->is_mutex = true;
+  QueueSend(q, nullptr, false, 0u);
+  return q;
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void) {return xSemaphoreCreateMutex();}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic(StaticSemaphore_t* buf)
+{
+  // Static buffer isn't used, object is allocated as dynamic one
+  return xSemaphoreCreateMutex();
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {vQueueDelete(sem);}
+
+TaskHandle_t xSemaphoreGetMutexHolder(SemaphoreHandle_t sem)
+{
+  std::lock_guard<std::mutex> lock(QueueLock());
+  return ((HostQueue*)sem)->holder;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {return QueueSend(sem, nullptr, false, 0u);}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t* woken) {return xSemaphoreGive(sem);}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {return QueueReceive(sem, nullptr, true, ticks);}
+
+BaseType_t xSemaphoreTakeFromISR(SemaphoreHandle_t sem, BaseType_t* woken) {return xSemaphoreTake(sem, 0u);}
+
+// * Only holder changes recursive count, so it is used without lock.
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks)
+{
+  BaseType_t result = pdPASS;
+  HostQueue* q = (HostQueue*)sem;
+  // Holder can take mutex again
+  if(xSemaphoreGetMutexHolder(sem) != xTaskGetCurrentTaskHandle()) result = xSemaphoreTake(sem, ticks);
+  if(result == pdPASS) q->recursive_cnt++;
+  return result;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem)
+{
+  BaseType_t result = pdFALSE;
+  HostQueue* q = (HostQueue*)sem;
+  if((xSemaphoreGetMutexHolder(sem) == xTaskGetCurrentTaskHandle()) && (q->recursive_cnt > 0u))
+  {
+    q->recursive_cnt--;
+    if(q->recursive_cnt == 0u) xSemaphoreGive(sem);
+    result = pdPASS;
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Timers   **************************************************************
+// *****************************************************************************
+TimerHandle_t xTimerCreate(const char* name, TickType_t period, UBaseType_t reload, void* id, TimerCallbackFunction_t callback)
+{
+  HostTimer* t = new HostTimer();
+  t->id = id;
+  t->period = period;
+  return t;
+}
+
+void* pvTimerGetTimerID(TimerHandle_t timer) {return ((HostTimer*)timer)->id;}
+BaseType_t xTimerDelete(TimerHandle_t timer, TickType_t ticks) {delete (HostTimer*)timer; return pdPASS;}
+BaseType_t xTimerIsTimerActive(TimerHandle_t timer) {return ((HostTimer*)timer)->is_active;}
+BaseType_t xTimerReset(TimerHandle_t timer, TickType_t ticks) {((HostTimer*)timer)->is_active = true; return pdPASS;}
+BaseType_t xTimerResetFromISR(TimerHandle_t timer, BaseType_t* woken) {return xTimerReset(timer, 0u);}
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t ticks) {((HostTimer*)timer)->is_active = true; return pdPASS;}
+BaseType_t xTimerStartFromISR(TimerHandle_t timer, BaseType_t* woken) {return xTimerStart(timer, 0u);}
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t ticks) {((HostTimer*)timer)->is_active = false; return pdPASS;}
+BaseType_t xTimerStopFromISR(TimerHandle_t timer, BaseType_t* woken) {return xTimerStop(timer, 0u);}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t ticks)
+{
+  // Like in FreeRTOS, changing period starts timer
+  ((HostTimer*)timer)->period = period;
+  ((HostTimer*)timer)->is_active = true;
+  return pdPASS;
+}
+
+BaseType_t xTimerChangePeriodFromISR(TimerHandle_t timer, TickType_t period, BaseType_t* woken) {return xTimerChangePeriod(timer, period, 0u);}
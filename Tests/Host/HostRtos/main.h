@@ -0,0 +1,38 @@
+// *****************************************************************************
+// @file main.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Host RTOS shim, replacement of CubeMX main.h
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef main_h
+#define main_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <stdint.h>
+
+// *****************************************************************************
+// ***   CMSIS replacements   **************************************************
+// *****************************************************************************
+// * Host code never runs in interrupt handler
+static inline uint32_t __get_IPSR(void) {return 0u;}
+
+// *****************************************************************************
+// ***   HAL replacements   ****************************************************
+// *****************************************************************************
+// * Panel drivers are compiled, but never talk to hardware on host
+static inline void HAL_Delay(uint32_t ms) {}
+
+#endif
@@ -0,0 +1,27 @@
+// *****************************************************************************
+// @file portmacro.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Host RTOS shim, port macros
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef portmacro_h
+#define portmacro_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+// * Port macros are defined in FreeRTOS.h of the shim
+#include "FreeRTOS.h"
+
+#endif
@@ -0,0 +1,79 @@
+// *****************************************************************************
+// @file task.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Host RTOS shim, tasks
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef task_h
+#define task_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "FreeRTOS.h"
+
+// *****************************************************************************
+// ***   Scheduler states   ****************************************************
+// *****************************************************************************
+#define taskSCHEDULER_SUSPENDED   0
+#define taskSCHEDULER_NOT_STARTED 1
+#define taskSCHEDULER_RUNNING     2
+
+// *****************************************************************************
+// ***   Critical sections and interrupts   ************************************
+// *****************************************************************************
+// * Critical section is one global lock for all threads. Host code never runs
+// * in interrupt handler, so interrupts need nothing.
+#define taskYIELD() vPortYield()
+#define taskENTER_CRITICAL() vPortEnterCritical()
+#define taskEXIT_CRITICAL() vPortExitCritical()
+#define taskDISABLE_INTERRUPTS()
+#define taskENABLE_INTERRUPTS()
+
+void vPortYield(void);
+void vPortEnterCritical(void);
+void vPortExitCritical(void);
+
+// *****************************************************************************
+// ***   Tasks   ***************************************************************
+// *****************************************************************************
+BaseType_t xTaskCreate(TaskFunction_t func, const char* name, uint32_t stack, void* param, UBaseType_t prio, TaskHandle_t* handle);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t* prev_wake, TickType_t ticks);
+void vTaskSetApplicationTaskTag(TaskHandle_t task, TaskHookFunction_t tag);
+TaskHookFunction_t xTaskGetApplicationTaskTag(TaskHandle_t task);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+// * Host only: created tasks aren't run, program calls Loop() of its tasks
+// * itself. Task that have to run on its own(like DisplayTransfer) is named
+// * before it created, it runs in own thread right after creation.
+void vHostTaskRun(const char* name);
+
+// *****************************************************************************
+// ***   Scheduler   ***********************************************************
+// *****************************************************************************
+// * vTaskStartScheduler() only switches state to running and returns.
+void vTaskStartScheduler(void);
+BaseType_t xTaskGetSchedulerState(void);
+void vTaskSuspendAll(void);
+BaseType_t xTaskResumeAll(void);
+
+// *****************************************************************************
+// ***   Ticks   ***************************************************************
+// *****************************************************************************
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+
+#endif
@@ -0,0 +1,43 @@
+// *****************************************************************************
+// @file timers.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Host RTOS shim, software timers
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef timers_h
+#define timers_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "FreeRTOS.h"
+
+// *****************************************************************************
+// ***   Timers   **************************************************************
+// *****************************************************************************
+// * Timers are created and can be started, but callbacks are never called.
+TimerHandle_t xTimerCreate(const char* name, TickType_t period, UBaseType_t reload, void* id, TimerCallbackFunction_t callback);
+void* pvTimerGetTimerID(TimerHandle_t timer);
+BaseType_t xTimerDelete(TimerHandle_t timer, TickType_t ticks);
+BaseType_t xTimerIsTimerActive(TimerHandle_t timer);
+BaseType_t xTimerReset(TimerHandle_t timer, TickType_t ticks);
+BaseType_t xTimerResetFromISR(TimerHandle_t timer, BaseType_t* woken);
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t ticks);
+BaseType_t xTimerStartFromISR(TimerHandle_t timer, BaseType_t* woken);
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t ticks);
+BaseType_t xTimerStopFromISR(TimerHandle_t timer, BaseType_t* woken);
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t ticks);
+BaseType_t xTimerChangePeriodFromISR(TimerHandle_t timer, TickType_t period, BaseType_t* woken);
+
+#endif
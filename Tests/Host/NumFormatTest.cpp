@@ -0,0 +1,228 @@
+// *****************************************************************************
+// @file NumFormatTest.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: NumFormat test for host build
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// * Compares NumFormat functions with snprintf() on pseudo random values,
+// * widths, flags and buffer sizes:
+// *   - result string, including truncation to buffer size
+// *   - returned range of changed characters against previous string
+// *   - bytes after buffer size aren't touched
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "Display/NumFormat.h"
+
+#include <cstdio>
+#include <cstring>
+
+// *****************************************************************************
+// ***   Test parameters   *****************************************************
+// *****************************************************************************
+static const uint32_t ITERATIONS = 200000u;
+static const uint32_t MAX_N = 24u;
+static const uint32_t MAX_WIDTH = 20u;
+// Buffer size with guard after data
+static const uint32_t BUF_SIZE = MAX_N + 16u;
+
+// *****************************************************************************
+// ***   Function under test   *************************************************
+// *****************************************************************************
+typedef enum
+{
+  FUNC_INT,
+  FUNC_UINT,
+  FUNC_FIXED,
+  FUNC_HEX,
+  FUNC_CNT
+} Func;
+
+static const char* const func_names[FUNC_CNT] = {"Int", "Uint", "Fixed", "Hex"};
+
+// *****************************************************************************
+// ***   Pseudo random number   ************************************************
+// *****************************************************************************
+static uint32_t Random(void)
+{
+  static uint32_t seed = 12345u;
+  seed = seed * 1103515245u + 12345u;
+  uint32_t hi = seed >> 16u;
+  seed = seed * 1103515245u + 12345u;
+  return (hi << 16u) | (seed >> 16u);
+}
+
+// *****************************************************************************
+// ***   Reference: Format number with snprintf()   ****************************
+// *****************************************************************************
+static void Ref(char* out, uint32_t size, Func func, uint32_t value, uint8_t decimals, uint8_t width, uint8_t flags)
+{
+  // Conversion flags for printf
+  char fmt[16];
+  uint32_t len = 0u;
+  fmt[len++] = '%';
+  if(flags & NumFormat::LEFT) fmt[len++] = '-';
+  if(flags & NumFormat::SIGN) fmt[len++] = '+';
+  if(flags & NumFormat::ZERO_PAD) fmt[len++] = '0';
+  fmt[len++] = '*';
+  fmt[len] = '\0';
+
+  if((func == FUNC_INT) || (func == FUNC_UINT))
+  {
+    // Unsigned value printed as signed, so '+' works for it too
+    long long val = (func == FUNC_INT) ? (long long)(int32_t)value : (long long)value;
+    strcat(fmt, "lld");
+    snprintf(out, size, fmt, width, val);
+  }
+  else if(func == FUNC_FIXED)
+  {
+    // Double keeps all digits of 32-bit value, so printf rounding is exact
+    double div = 1.0;
+    for(uint8_t i = 0u; i < decimals; i++) div *= 10.0;
+    strcat(fmt, ".*f");
+    snprintf(out, size, fmt, width, decimals, (double)(int32_t)value / div);
+  }
+  else
+  {
+    const char* conv = (flags & NumFormat::LOWERCASE) ? "x" : "X";
+    // printf puts "0X" for uppercase and nothing for zero, so prefix is added
+    // here
+    if(flags & NumFormat::PREFIX)
+    {
+      char digits[16];
+      snprintf(digits, sizeof(digits), (flags & NumFormat::LOWERCASE) ? "0x%x" : "0x%X", value);
+      if((flags & NumFormat::ZERO_PAD) && !(flags & NumFormat::LEFT))
+      {
+        snprintf(out, size, (flags & NumFormat::LOWERCASE) ? "0x%0*x" : "0x%0*X", (width > 2u) ? (width - 2u) : 0u, value);
+      }
+      else
+      {
+        snprintf(out, size, (flags & NumFormat::LEFT) ? "%-*s" : "%*s", width, digits);
+      }
+    }
+    else
+    {
+      strcat(fmt, conv);
+      snprintf(out, size, fmt, width, value);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Report failure   ******************************************************
+// *****************************************************************************
+static uint32_t Fail(Func func, const char* what, uint32_t value, uint8_t decimals, uint8_t width, uint8_t flags, uint32_t n)
+{
+  printf("%s FAIL: %s, value 0x%08X, decimals %u, width %u, flags 0x%02X, n %u\n", func_names[func], what, value, decimals, width, flags, n);
+  return 1u;
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  uint32_t failed = 0u;
+  // Characters for previous strings, so some of them match new ones
+  static const char old_chars[] = "0123456789 +-.xABCDEFabcdef";
+
+  for(uint32_t it = 0u; it < ITERATIONS; it++)
+  {
+    Func func = (Func)(Random() % FUNC_CNT);
+    // Magnitudes of all sizes, so padding is used as well as full width
+    uint32_t value = Random() >> (Random() % 32u);
+    if((func == FUNC_INT) || (func == FUNC_FIXED))
+    {
+      if(Random() & 1u) value = 0u - value;
+    }
+    // Edge values
+    switch(Random() % 64u)
+    {
+      case 0u:  value = 0u;          break;
+      case 1u:  value = 0x7FFFFFFFu; break;
+      case 2u:  value = 0x80000000u; break;
+      case 3u:  value = 0xFFFFFFFFu; break;
+      default:                       break;
+    }
+    uint8_t decimals = (func == FUNC_FIXED) ? (uint8_t)(Random() % 10u) : 0u;
+    uint8_t width = (uint8_t)(Random() % (MAX_WIDTH + 1u));
+    uint8_t flags = (uint8_t)(Random() & (NumFormat::SIGN | NumFormat::ZERO_PAD | NumFormat::LEFT));
+    // printf ignores '+' for hexadecimal numbers
+    if(func == FUNC_HEX) flags = (uint8_t)((flags & ~NumFormat::SIGN) | (Random() & (NumFormat::PREFIX | NumFormat::LOWERCASE)));
+    uint32_t n = 1u + Random() % MAX_N;
+
+    // Previous string of random length, random bytes after it and guard
+    // pattern after buffer size
+    char buf[BUF_SIZE];
+    memset(buf, 0xA5, BUF_SIZE);
+    uint32_t old_len = Random() % n;
+    for(uint32_t i = 0u; i < n; i++) buf[i] = old_chars[Random() % (sizeof(old_chars) - 1u)];
+    buf[old_len] = '\0';
+    char old[BUF_SIZE];
+    memcpy(old, buf, BUF_SIZE);
+
+    // Function under test
+    NumFormat::Range range;
+    switch(func)
+    {
+      case FUNC_INT:   range = NumFormat::Int(buf, n, (int32_t)value, width, flags);             break;
+      case FUNC_UINT:  range = NumFormat::Uint(buf, n, value, width, flags);                     break;
+      case FUNC_FIXED: range = NumFormat::Fixed(buf, n, (int32_t)value, decimals, width, flags); break;
+      default:         range = NumFormat::Hex(buf, n, value, width, flags);                      break;
+    }
+
+    // Reference truncated to buffer size by snprintf() itself
+    char ref[64];
+    Ref(ref, n, func, value, decimals, width, flags);
+    if(strcmp(buf, ref) != 0)
+    {
+      failed += Fail(func, "string", value, decimals, width, flags, n);
+      printf("  result \"%s\", expected \"%s\"\n", buf, ref);
+    }
+
+    // Guard after buffer size
+    if(memcmp(&buf[n], &old[n], BUF_SIZE - n) != 0)
+    {
+      failed += Fail(func, "write after buffer", value, decimals, width, flags, n);
+    }
+
+    // Changed characters: differ from previous string or are between ends of
+    // previous and new string
+    uint32_t new_len = strlen(buf);
+    uint32_t min_len = (old_len < new_len) ? old_len : new_len;
+    uint32_t max_len = (old_len > new_len) ? old_len : new_len;
+    int32_t start = INT32_MAX;
+    int32_t end = -1;
+    for(uint32_t i = 0u; i < max_len; i++)
+    {
+      if((i >= min_len) || (buf[i] != old[i]))
+      {
+        if(start > (int32_t)i) start = i;
+        end = i;
+      }
+    }
+    bool is_empty = (start > end);
+    if(is_empty ? (range.start <= range.end) : ((range.start != start) || (range.end != end)))
+    {
+      failed += Fail(func, "range", value, decimals, width, flags, n);
+      printf("  range %d..%d, expected %d..%d\n", range.start, range.end, start, end);
+    }
+  }
+
+  printf("NumFormat: %u failures\n", failed);
+  return (failed == 0u) ? 0 : 1;
+}
@@ -0,0 +1,314 @@
+// *****************************************************************************
+// @file PanelDriverTest.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Panel driver SPI transaction test for host build
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// * Runs panel drivers against recording SPI and GPIO and checks number of SPI
+// * transactions and CS cycles for Init(), SetAddrWindow() and SetRotation().
+// * Command with parameters is sent by SendCommand() in one CS cycle: one
+// * transaction for command byte and one for all parameters. Bytes together
+// * with DC level of each byte are checked by CRC, so grouping of transactions
+// * can't change what panel receives. Numbers of drivers that sent every byte
+// * in own CS cycle(before WriteCommandList() and SendCommand()) are printed
+// * for comparison, their byte stream has the same CRC.
+// *
+// * Usage: PanelDriverTest [-u]
+// *   -u     print current values to update expected table
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "Display/ILI9341.h"
+#include "Display/ILI9488.h"
+#include "Display/ST7789.h"
+#include "Display/GC9A01.h"
+#include "Math/Crc32.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// *****************************************************************************
+// ***   Recorded bus state   **************************************************
+// *****************************************************************************
+typedef struct
+{
+  // Current CS and DC levels
+  bool cs;
+  bool dc;
+  // SPI transactions
+  uint32_t transactions;
+  // CS cycles: CS pulled down
+  uint32_t cs_cycles;
+  // Bytes sent while CS is high
+  uint32_t errors;
+  // DC level and value of every byte sent
+  std::vector<uint8_t> stream;
+} Bus;
+
+// *****************************************************************************
+// ***   Recording GPIO   ******************************************************
+// *****************************************************************************
+class RecordingGpio : public IGpio
+{
+  public:
+    // Pin function
+    enum Pin
+    {
+      PIN_CS,
+      PIN_DC,
+      PIN_RST
+    };
+
+    // *************************************************************************
+    // ***   Public: Constructor   *********************************************
+    // *************************************************************************
+    RecordingGpio(Bus& in_bus, Pin in_pin) : IGpio(OUTPUT), bus(in_bus), pin(in_pin) {};
+
+    // *************************************************************************
+    // ***   Public: Read   ****************************************************
+    // *************************************************************************
+    virtual State Read() {return state;}
+
+    // *************************************************************************
+    // ***   Public: Write   ***************************************************
+    // *************************************************************************
+    virtual void Write(State s)
+    {
+      if(pin == PIN_CS)
+      {
+        // Count CS cycles
+        if(state && !s) bus.cs_cycles++;
+        bus.cs = s;
+      }
+      else if(pin == PIN_DC)
+      {
+        bus.dc = s;
+      }
+      state = s;
+    }
+
+  private:
+    // Bus to record
+    Bus& bus;
+    // Pin function
+    Pin pin;
+    // Pin state, high after reset
+    State state = HIGH;
+};
+
+// *****************************************************************************
+// ***   Recording SPI   *******************************************************
+// *****************************************************************************
+class RecordingSpi : public ISpi
+{
+  public:
+    // *************************************************************************
+    // ***   Public: Constructor   *********************************************
+    // *************************************************************************
+    explicit RecordingSpi(Bus& in_bus) : bus(in_bus) {};
+
+    // *************************************************************************
+    // ***   Public: Init   ****************************************************
+    // *************************************************************************
+    virtual Result Init() {return Result::RESULT_OK;}
+
+    // *************************************************************************
+    // ***   Public: Write   ***************************************************
+    // *************************************************************************
+    virtual Result Write(uint8_t* tx_buf_ptr, uint32_t tx_size)
+    {
+      Record(tx_buf_ptr, tx_size);
+      return Result::RESULT_OK;
+    }
+
+    // *************************************************************************
+    // ***   Public: WriteAsync   **********************************************
+    // *************************************************************************
+    virtual Result WriteAsync(uint8_t* tx_buf_ptr, uint32_t tx_size)
+    {
+      Record(tx_buf_ptr, tx_size);
+      return Result::RESULT_OK;
+    }
+
+    // *************************************************************************
+    // ***   Public: Read   ****************************************************
+    // *************************************************************************
+    virtual Result Read(uint8_t* rx_buf_ptr, uint32_t rx_size)
+    {
+      memset(rx_buf_ptr, 0, rx_size);
+      bus.transactions++;
+      return Result::RESULT_OK;
+    }
+
+    // *************************************************************************
+    // ***   Public: Abort   ***************************************************
+    // *************************************************************************
+    virtual Result Abort(void) {return Result::RESULT_OK;}
+
+  private:
+    // Bus to record
+    Bus& bus;
+
+    // *************************************************************************
+    // ***   Private: Record transaction   *************************************
+    // *************************************************************************
+    void Record(const uint8_t* buf, uint32_t n)
+    {
+      bus.transactions++;
+      // CS is active low
+      if(bus.cs) bus.errors += n;
+      for(uint32_t i = 0u; i < n; i++)
+      {
+        bus.stream.push_back(bus.dc ? 1u : 0u);
+        bus.stream.push_back(buf[i]);
+      }
+    }
+};
+
+// *****************************************************************************
+// ***   Expected numbers for one operation   **********************************
+// *****************************************************************************
+typedef struct
+{
+  // SPI transactions
+  uint32_t transactions;
+  // CS cycles
+  uint32_t cs_cycles;
+  // CRC of bytes with DC level
+  uint32_t crc;
+  // Transactions and CS cycles when every byte was sent in own CS cycle
+  uint32_t transactions_before;
+  uint32_t cs_cycles_before;
+} Expected;
+
+// *****************************************************************************
+// ***   Driver under test   ***************************************************
+// *****************************************************************************
+typedef struct
+{
+  const char* name;
+  // Create driver
+  IDisplay* (*create)(ISpi& spi, IGpio& cs, IGpio& dc, IGpio& rst);
+  // Init(), SetAddrWindow(), SetRotation()
+  Expected init;
+  Expected window;
+  Expected rotation;
+} Driver;
+
+static IDisplay* CreateILI9341(ISpi& spi, IGpio& cs, IGpio& dc, IGpio& rst) {return new ILI9341(240, 320, spi, cs, dc, &rst);}
+static IDisplay* CreateILI9488(ISpi& spi, IGpio& cs, IGpio& dc, IGpio& rst) {return new ILI9488(320, 480, spi, cs, dc, &rst);}
+static IDisplay* CreateST7789(ISpi& spi, IGpio& cs, IGpio& dc, IGpio& rst)  {return new ST7789(240, 240, spi, cs, dc, rst);}
+static IDisplay* CreateGC9A01(ISpi& spi, IGpio& cs, IGpio& dc, IGpio& rst)  {return new GC9A01(240, 240, spi, cs, dc, &rst);}
+
+// ILI9488 sets pixel format for color depth in Init()
+#if defined(COLOR_3BIT)
+static const uint32_t ILI9488_INIT_CRC = 0xA8B3EE58u;
+#else
+static const uint32_t ILI9488_INIT_CRC = 0xF88FB004u;
+#endif
+
+static const Driver drivers[] =
+{
+  //                           Init                                  SetAddrWindow                       SetRotation
+  {"ILI9341", CreateILI9341, {41u, 22u, 0xDD4FDC72u,  87u,  87u}, {5u, 1u, 0xE9D6DD16u, 11u, 11u}, {2u, 1u, 0xFBDA7C6Du, 2u, 2u}},
+  {"ILI9488", CreateILI9488, {29u, 16u, ILI9488_INIT_CRC, 64u, 64u}, {5u, 1u, 0xE9D6DD16u, 11u, 11u}, {2u, 1u, 0x60BEBEDDu, 2u, 2u}},
+  {"ST7789",  CreateST7789,  {13u,  7u, 0x6949A5DAu,  19u,  19u}, {5u, 1u, 0x76A9B3F1u, 11u, 11u}, {2u, 1u, 0x83DDB5CFu, 2u, 2u}},
+  // Rotation isn't supported by GC9A01 driver
+  {"GC9A01",  CreateGC9A01,  {95u, 51u, 0x3F7FF79Fu, 186u, 186u}, {5u, 1u, 0xE9D6DD16u, 11u, 11u}, {0u, 0u, 0x00000000u, 0u, 0u}}
+};
+
+// *****************************************************************************
+// ***   Clear recorded bus   **************************************************
+// *****************************************************************************
+static void Clear(Bus& bus)
+{
+  bus.transactions = 0u;
+  bus.cs_cycles = 0u;
+  bus.errors = 0u;
+  bus.stream.clear();
+}
+
+// *****************************************************************************
+// ***   Check recorded operation against expected numbers   *******************
+// *****************************************************************************
+static uint32_t Check(const char* driver, const char* op, const Bus& bus, const Expected& exp, bool is_update)
+{
+  uint32_t failed = 0u;
+  uint32_t crc = Crc32(bus.stream.data(), bus.stream.size());
+  if(is_update)
+  {
+    printf("%-8s %-14s {%uu, %uu, 0x%08Xu}\n", driver, op, bus.transactions, bus.cs_cycles, crc);
+  }
+  else
+  {
+    bool is_pass = (bus.transactions == exp.transactions) && (bus.cs_cycles == exp.cs_cycles) &&
+                   (crc == exp.crc) && (bus.errors == 0u);
+    printf("%-8s %-14s %4u transactions, %4u CS cycles (before: %4u, %4u), %u bytes %s\n", driver, op,
+           bus.transactions, bus.cs_cycles, exp.transactions_before, exp.cs_cycles_before,
+           (uint32_t)bus.stream.size() / 2u, is_pass ? "PASS" : "FAIL");
+    if(bus.errors != 0u) printf("%-8s %-14s %u bytes sent without CS\n", driver, op, bus.errors);
+    if(!is_pass) failed++;
+  }
+  // Return result
+  return failed;
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  bool is_update = false;
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-u") == 0) is_update = true;
+    else
+    {
+      printf("Usage: %s [-u]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  uint32_t failed = 0u;
+  for(uint32_t d = 0u; d < NumberOf(drivers); d++)
+  {
+    Bus bus = {true, true, 0u, 0u, 0u};
+    RecordingSpi spi(bus);
+    RecordingGpio cs(bus, RecordingGpio::PIN_CS);
+    RecordingGpio dc(bus, RecordingGpio::PIN_DC);
+    RecordingGpio rst(bus, RecordingGpio::PIN_RST);
+    IDisplay* display = drivers[d].create(spi, cs, dc, rst);
+
+    Clear(bus);
+    display->Init();
+    failed += Check(drivers[d].name, "Init", bus, drivers[d].init, is_update);
+
+    Clear(bus);
+    display->SetAddrWindow(10u, 20u, 109u, 219u);
+    failed += Check(drivers[d].name, "SetAddrWindow", bus, drivers[d].window, is_update);
+
+    Clear(bus);
+    display->SetRotation(IDisplay::ROTATION_LEFT);
+    failed += Check(drivers[d].name, "SetRotation", bus, drivers[d].rotation, is_update);
+
+    delete display;
+  }
+
+  if(!is_update) printf("Panel drivers: %u failures\n", failed);
+  return (failed == 0u) ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+// *****************************************************************************
+// @file PixelConvertTest.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: PixelConvert test for host build
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// * Compares word at a time kernels of PixelConvert with byte at a time
+// * reference implementation:
+// *   - every RGB565 value in both pixels of a word
+// *   - every pair of bytes for 3-bit packing
+// *   - pixel counts 0..63 with buffer at four alignments
+// * Whole buffer is compared, so writes after the end of result are caught.
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "Display/PixelConvert.h"
+
+#include <cstdio>
+#include <cstring>
+
+// *****************************************************************************
+// ***   Test parameters   *****************************************************
+// *****************************************************************************
+static const uint32_t MAX_CNT = 64u;
+static const uint32_t ALIGNMENTS = 4u;
+// Biggest pixel is 4 bytes, plus alignment offset and guard after data
+static const uint32_t BUF_SIZE = MAX_CNT * 4u + ALIGNMENTS + 16u;
+
+// *****************************************************************************
+// ***   Reference: Expand RGB565 to RGB888   **********************************
+// *****************************************************************************
+static void RefRgb565ToRgb888(uint8_t* data, uint32_t n)
+{
+  for(uint32_t i = n; i != 0u;)
+  {
+    i--;
+    uint8_t hi = data[i*2u];
+    uint8_t lo = data[i*2u+1u];
+    data[i*3u+2u] = (lo & 0x1Fu) << 3u;
+    data[i*3u+1u] = ((hi & 0x07u) << 5u) | ((lo & 0xE0u) >> 3u);
+    data[i*3u+0u] = hi & 0xF8u;
+  }
+}
+
+// *****************************************************************************
+// ***   Reference: Pack 32-bit pixels to 24-bit   *****************************
+// *****************************************************************************
+static void RefRgb888xToRgb888(uint8_t* data, uint32_t n)
+{
+  for(uint32_t i = 0u; i < n; i++)
+  {
+    data[i*3u+0u] = data[i*4u+0u];
+    data[i*3u+1u] = data[i*4u+1u];
+    data[i*3u+2u] = data[i*4u+2u];
+  }
+}
+
+// *****************************************************************************
+// ***   Reference: Pack two 3-bit pixels in one byte   ************************
+// *****************************************************************************
+static void RefRgb3BitPack(uint8_t* data, uint32_t n)
+{
+  for(uint32_t i = 0u; i + 2u <= n; i += 2u)
+  {
+    data[i/2u] = ((data[i] & 0x07u) << 3u) | (data[i+1u] & 0x07u);
+  }
+}
+
+// *****************************************************************************
+// ***   Reference: Swap bytes of 16-bit pixels   ******************************
+// *****************************************************************************
+static void RefSwapBytes16(uint8_t* data, uint32_t n)
+{
+  for(uint32_t i = 0u; i < n; i++)
+  {
+    uint8_t tmp = data[i*2u];
+    data[i*2u] = data[i*2u+1u];
+    data[i*2u+1u] = tmp;
+  }
+}
+
+// *****************************************************************************
+// ***   Function under test and its reference   *******************************
+// *****************************************************************************
+typedef struct
+{
+  const char* name;
+  void (*func)(uint8_t* data, uint32_t n);
+  void (*ref)(uint8_t* data, uint32_t n);
+  // Bytes per source pixel
+  uint32_t pixel_size;
+} Kernel;
+
+static const Kernel kernels[] =
+{
+  {"Rgb565ToRgb888",  PixelConvert::Rgb565ToRgb888,  RefRgb565ToRgb888,  2u},
+  {"Rgb888xToRgb888", PixelConvert::Rgb888xToRgb888, RefRgb888xToRgb888, 4u},
+  {"Rgb3BitPack",     PixelConvert::Rgb3BitPack,     RefRgb3BitPack,     1u},
+  {"SwapBytes16",     PixelConvert::SwapBytes16,     RefSwapBytes16,     2u}
+};
+
+// *****************************************************************************
+// ***   Run kernel and reference on the same data and compare   ***************
+// *****************************************************************************
+// * Source is copied to buffer at given offset. Returns true if whole buffers
+// * are equal.
+static bool Check(const Kernel& k, const uint8_t* src, uint32_t n, uint32_t offset)
+{
+  // Word aligned buffers, offset makes data unaligned
+  static uint32_t buf_test[BUF_SIZE / 4u + 1u];
+  static uint32_t buf_ref[BUF_SIZE / 4u + 1u];
+  uint8_t* test = (uint8_t*)buf_test;
+  uint8_t* ref = (uint8_t*)buf_ref;
+  // Guard pattern around data
+  memset(test, 0xA5, BUF_SIZE);
+  // RGB888 result takes more bytes than source
+  memcpy(&test[offset], src, n * k.pixel_size);
+  memcpy(ref, test, BUF_SIZE);
+  k.func(&test[offset], n);
+  k.ref(&ref[offset], n);
+  // Return result
+  return (memcmp(test, ref, BUF_SIZE) == 0);
+}
+
+// *****************************************************************************
+// ***   Report failure   ******************************************************
+// *****************************************************************************
+static uint32_t Fail(const Kernel& k, const char* what, uint32_t val, uint32_t n, uint32_t offset)
+{
+  printf("%s FAIL: %s 0x%X, %u pixels at offset %u\n", k.name, what, val, n, offset);
+  return 1u;
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  uint32_t failed = 0u;
+  uint8_t src[MAX_CNT * 4u];
+
+  // All counts and alignments with pseudo random data
+  uint32_t seed = 12345u;
+  for(uint32_t k = 0u; k < NumberOf(kernels); k++)
+  {
+    for(uint32_t n = 0u; n < MAX_CNT; n++)
+    {
+      for(uint32_t offset = 0u; offset < ALIGNMENTS; offset++)
+      {
+        for(uint32_t i = 0u; i < sizeof(src); i++)
+        {
+          seed = seed * 1103515245u + 12345u;
+          src[i] = (uint8_t)(seed >> 16u);
+        }
+        if(!Check(kernels[k], src, n, offset)) failed += Fail(kernels[k], "count", n, n, offset);
+      }
+    }
+  }
+
+  // Every RGB565 value, high byte first. Blocks of odd size start at even and
+  // odd values, so each value is converted in both pixels of a word and as
+  // last odd pixel.
+  for(uint32_t shift = 0u; shift < 2u; shift++)
+  {
+    for(uint32_t base = shift; base < 0x10000u + shift; base += MAX_CNT - 1u)
+    {
+      for(uint32_t i = 0u; i < MAX_CNT - 1u; i++)
+      {
+        uint16_t val = (uint16_t)(base + i);
+        src[i*2u] = (uint8_t)(val >> 8u);
+        src[i*2u+1u] = (uint8_t)val;
+      }
+      for(uint32_t offset = 0u; offset < ALIGNMENTS; offset++)
+      {
+        if(!Check(kernels[0u], src, MAX_CNT - 1u, offset)) failed += Fail(kernels[0u], "block from", base, MAX_CNT - 1u, offset);
+      }
+    }
+  }
+
+  // Every pair of bytes for 3-bit packing, high bits have to be ignored. Pair
+  // is put at every even position of a block of eight pixels.
+  for(uint32_t pair = 0u; pair < 0x10000u; pair++)
+  {
+    for(uint32_t pos = 0u; pos < 8u; pos += 2u)
+    {
+      memset(src, 0xFF, 8u);
+      src[pos] = (uint8_t)(pair >> 8u);
+      src[pos+1u] = (uint8_t)pair;
+      for(uint32_t offset = 0u; offset < ALIGNMENTS; offset++)
+      {
+        if(!Check(kernels[2u], src, 8u, offset)) failed += Fail(kernels[2u], "pair", pair, 8u, offset);
+      }
+    }
+  }
+
+  printf("PixelConvert: %u failures\n", failed);
+  return (failed == 0u) ? 0 : 1;
+}
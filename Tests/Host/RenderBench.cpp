@@ -0,0 +1,441 @@
+// *****************************************************************************
+// @file RenderBench.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Rendering benchmark for host build
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// * Measures on host:
+// *   - DrawInBufW() time of each primitive for different object sizes
+// *   - frame time of DisplayDrv for different number of objects
+// *   - frame time for different update area sizes(with UPDATE_AREA_ENABLED)
+// *   - frame time with transfers as slow as SPI, with DISPLAY_TRANSFER_TASK
+// *     also time spent rendering against time spent waiting for buffers
+// * Transfers per frame are printed next to frame time, they don't depend on
+// * host. Absolute times depend on host CPU, use them to compare two builds.
+// *
+// * Usage: RenderBench [-l] [-f]
+// *   -l     draw by columns(UPDATE_LEFT_RIGHT)
+// *   -f     measure only frames, skip primitives
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "Display/DisplayDrv.h"
+#include "Display/MemoryDisplay.h"
+#include "Display/Primitives.h"
+#include "Display/Image.h"
+#include "Display/Strng.h"
+#include "task.h"
+#include "Display/Fonts/Font_8x12.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// *****************************************************************************
+// ***   Get time in nanoseconds   *********************************************
+// *****************************************************************************
+static int64_t GetTimeNs(void)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// *****************************************************************************
+// ***   Memory display with SPI transfer time   *******************************
+// *****************************************************************************
+// * Pixels are written at once, but transfer is complete only after time SPI
+// * with given clock needs to send them. Color fill is blocking like in panel
+// * drivers. Clock 0 makes transfers instant.
+class SpiMemoryDisplay : public MemoryDisplay
+{
+  public:
+    SpiMemoryDisplay(int32_t in_width, int32_t in_height, color_t* in_buf) : MemoryDisplay(in_width, in_height, in_buf) {};
+
+    void SetClock(uint32_t in_clock_mhz) {clock_mhz = in_clock_mhz;}
+
+    uint32_t GetClock(void) {return clock_mhz;}
+
+    virtual Result WriteDataStream(uint8_t* data, uint32_t n)
+    {
+      Result result = MemoryDisplay::WriteDataStream(data, n);
+      StartTransfer(n);
+      return result;
+    }
+
+    virtual Result WriteColor(color_t color, uint32_t n)
+    {
+      Result result = MemoryDisplay::WriteColor(color, n);
+      StartTransfer(n * sizeof(color_t));
+      while(!IsTransferComplete());
+      return result;
+    }
+
+    virtual bool IsTransferComplete(void) {return (GetTimeNs() >= end_ns);}
+
+  private:
+    // SPI clock in MHz
+    uint32_t clock_mhz = 0u;
+    // Time when current transfer ends
+    int64_t end_ns = 0;
+
+    void StartTransfer(uint32_t bytes)
+    {
+      if(clock_mhz != 0u) end_ns = GetTimeNs() + (int64_t)bytes * 8 * 1000 / clock_mhz;
+    }
+};
+
+// *****************************************************************************
+// ***   Test screen   *********************************************************
+// *****************************************************************************
+static const int32_t WIDTH = 320;
+static const int32_t HEIGHT = 240;
+static color_t screen[WIDTH * HEIGHT];
+static SpiMemoryDisplay display(WIDTH, HEIGHT, screen);
+
+// *****************************************************************************
+// ***   Test images   *********************************************************
+// *****************************************************************************
+static const int32_t IMG_SIZE = 256;
+static color_t img_bitmap[IMG_SIZE * IMG_SIZE];
+static uint8_t img_palette[IMG_SIZE * IMG_SIZE];
+static color_t palette[256];
+static uint8_t img_binary[IMG_SIZE * IMG_SIZE / 8];
+static char text[IMG_SIZE / 8 + 1];
+
+// *****************************************************************************
+// ***   Minimal time of one measurement in microseconds   *********************
+// *****************************************************************************
+static const int64_t MIN_TIME_US = 50000;
+
+// *****************************************************************************
+// ***   SPI clock and number of frames for transfer benchmark   ***************
+// *****************************************************************************
+static const uint32_t SPI_CLOCK_MHZ = 40u;
+static const uint32_t TRANSFER_FRAMES = 20u;
+
+// *****************************************************************************
+// ***   Fill test images   ****************************************************
+// *****************************************************************************
+static void FillImages(void)
+{
+  for(uint32_t i = 0u; i < NumberOf(palette); i++)
+  {
+    palette[i] = (color_t)(i * 0x9E3779B1u >> 16u);
+  }
+  for(int32_t i = 0; i < IMG_SIZE * IMG_SIZE; i++)
+  {
+    img_bitmap[i] = (color_t)(i * 0x9E3779B1u >> 16u);
+    img_palette[i] = (uint8_t)(i * 7u);
+  }
+  for(uint32_t i = 0u; i < NumberOf(img_binary); i++)
+  {
+    img_binary[i] = (uint8_t)(i * 0x5Bu);
+  }
+  for(uint32_t i = 0u; i < NumberOf(text) - 1u; i++)
+  {
+    text[i] = (char)('A' + i % 26u);
+  }
+}
+
+// *****************************************************************************
+// ***   Primitive under test   ************************************************
+// *****************************************************************************
+typedef struct
+{
+  // Name to print
+  const char* name;
+  // Create object of given size at 0, 0
+  VisObject* (*create)(int32_t size);
+} Primitive;
+
+static VisObject* CreateBoxFill(int32_t s)    {return new Box(0, 0, s, s, COLOR_RED, true);}
+static VisObject* CreateBoxFrame(int32_t s)   {return new Box(0, 0, s, s, COLOR_RED, false);}
+static VisObject* CreateBoxAlpha(int32_t s)   {Box* b = new Box(0, 0, s, s, COLOR_RED, true); b->SetAlpha(100u); return b;}
+static VisObject* CreateLine(int32_t s)       {return new Line(0, 0, s - 1, s / 3, COLOR_RED);}
+static VisObject* CreateCircleFill(int32_t s) {return new Circle(s / 2, s / 2, s / 2 - 1, COLOR_RED, true);}
+static VisObject* CreateCircle(int32_t s)     {return new Circle(s / 2, s / 2, s / 2 - 1, COLOR_RED, false);}
+static VisObject* CreateTriangle(int32_t s)   {return new Triangle(0, s - 1, s / 2, 0, s - 1, s - 1, COLOR_RED, true);}
+static VisObject* CreateBitmap(int32_t s)     {ImageBitmap* i = new ImageBitmap(0, 0, s, s, img_bitmap); return i;}
+static VisObject* CreatePalette(int32_t s)    {return new ImagePalette(0, 0, s, s, img_palette, palette);}
+static VisObject* CreateBinary(int32_t s)     {return new ImageBinary(0, 0, s, s, img_binary);}
+static VisObject* CreateText(int32_t s)       {text[s / 8] = '\0'; String* t = new String(text, 0, 0, COLOR_RED, Font_8x12::GetInstance()); text[s / 8] = 'A'; return t;}
+static VisObject* CreateTextBg(int32_t s)     {text[s / 8] = '\0'; String* t = new String(text, 0, 0, COLOR_RED, COLOR_BLUE, Font_8x12::GetInstance()); text[s / 8] = 'A'; return t;}
+
+static const Primitive primitives[] =
+{
+  {"Box",            CreateBoxFill},
+  {"Box frame",      CreateBoxFrame},
+  {"Box alpha",      CreateBoxAlpha},
+  {"Line",           CreateLine},
+  {"Circle fill",    CreateCircleFill},
+  {"Circle",         CreateCircle},
+  {"Triangle fill",  CreateTriangle},
+  {"ImageBitmap",    CreateBitmap},
+  {"ImagePalette",   CreatePalette},
+  {"ImageBinary",    CreateBinary},
+  {"String",         CreateText},
+  {"String opaque",  CreateTextBg}
+};
+
+// *****************************************************************************
+// ***   Benchmark DrawInBufW() of primitives   ********************************
+// *****************************************************************************
+static void BenchPrimitives(void)
+{
+  static const int32_t sizes[] = {16, 64, 256};
+  static color_t buf[DISPLAY_MAX_BUF_LEN];
+
+  printf("DrawInBufW(), ns per line\n");
+  printf("%-16s", "Object");
+  for(uint32_t s = 0u; s < NumberOf(sizes); s++) printf("%10dpx", sizes[s]);
+  printf("\n");
+
+  for(uint32_t p = 0u; p < NumberOf(primitives); p++)
+  {
+    printf("%-16s", primitives[p].name);
+    for(uint32_t s = 0u; s < NumberOf(sizes); s++)
+    {
+      VisObject* obj = primitives[p].create(sizes[s]);
+      int32_t lines = obj->GetEndY() + 1;
+      int64_t lines_cnt = 0;
+      int64_t start_ns = GetTimeNs();
+      int64_t time_ns = 0;
+      // Draw all lines of object until enough time passed
+      do
+      {
+        for(int32_t line = 0; line < lines; line++)
+        {
+          obj->DrawInBufW(buf, DISPLAY_MAX_BUF_LEN, line, 0);
+        }
+        lines_cnt += lines;
+        time_ns = GetTimeNs() - start_ns;
+      }
+      while(time_ns < MIN_TIME_US * 1000);
+      printf("%12.1f", (double)time_ns / (double)lines_cnt);
+      delete obj;
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
+
+// *****************************************************************************
+// ***   Draw frames until enough time passed and return us per frame   ********
+// *****************************************************************************
+// * Transfers of last frame are returned in transfers.
+static double MeasureFrame(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t& transfers)
+{
+  DisplayDrv& drv = DisplayDrv::GetInstance();
+  int64_t frames = 0;
+  int64_t start_ns = GetTimeNs();
+  int64_t time_ns = 0;
+  do
+  {
+#if defined(UPDATE_AREA_ENABLED)
+    drv.InvalidateArea(x, y, x + w - 1, y + h - 1);
+#endif
+    drv.UpdateDisplay();
+    drv.Loop();
+    frames++;
+    time_ns = GetTimeNs() - start_ns;
+  }
+  while(time_ns < MIN_TIME_US * 1000);
+  transfers = drv.GetFrameTransfers();
+  // Return result
+  return (double)time_ns / (double)frames / 1000.0;
+}
+
+// *****************************************************************************
+// ***   Benchmark frame time for number of objects   **************************
+// *****************************************************************************
+static void BenchObjectCount(void)
+{
+  static const uint32_t counts[] = {1u, 8u, 32u, 128u};
+
+  printf("Full frame %dx%d, us and transfers per frame\n", WIDTH, HEIGHT);
+  printf("%-16s%12s%10s%12s%10s\n", "Objects", "Boxes", "transfers", "Strings", "transfers");
+  for(uint32_t c = 0u; c < NumberOf(counts); c++)
+  {
+    printf("%-16u", counts[c]);
+    for(uint32_t type = 0u; type < 2u; type++)
+    {
+      std::vector<VisObject*> objs;
+      objs.push_back(new Box(0, 0, WIDTH, HEIGHT, COLOR_BLACK));
+      for(uint32_t i = 0u; i < counts[c]; i++)
+      {
+        // Objects scattered over screen
+        int32_t x = (int32_t)((i * 37u) % (WIDTH - 40));
+        int32_t y = (int32_t)((i * 53u) % (HEIGHT - 20));
+        if(type == 0u) objs.push_back(new Box(x, y, 40, 20, COLOR_RED));
+        else           objs.push_back(new String("Text", x, y, COLOR_WHITE, Font_8x12::GetInstance()));
+      }
+      for(uint32_t i = 0u; i < objs.size(); i++) objs[i]->Show(i);
+      uint32_t transfers = 0u;
+      double time_us = MeasureFrame(0, 0, WIDTH, HEIGHT, transfers);
+      printf("%12.1f%10u", time_us, transfers);
+      for(uint32_t i = 0u; i < objs.size(); i++)
+      {
+        objs[i]->Hide();
+        delete objs[i];
+      }
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
+
+// *****************************************************************************
+// ***   Benchmark frame time for update area size   ***************************
+// *****************************************************************************
+static void BenchAreaSize(void)
+{
+#if defined(UPDATE_AREA_ENABLED)
+  static const int32_t sizes[] = {8, 32, 128, 240};
+
+  std::vector<VisObject*> objs;
+  objs.push_back(new Box(0, 0, WIDTH, HEIGHT, COLOR_BLACK));
+  objs.push_back(new Circle(WIDTH / 2, HEIGHT / 2, 100, COLOR_GREEN, true));
+  objs.push_back(new String("Update area benchmark", 10, 10, COLOR_WHITE, COLOR_BLUE, Font_8x12::GetInstance()));
+  for(uint32_t i = 0u; i < objs.size(); i++) objs[i]->Show(i);
+  // Draw first frame to clear pending updates
+  uint32_t transfers = 0u;
+  MeasureFrame(0, 0, WIDTH, HEIGHT, transfers);
+
+  printf("Update area, us and transfers per frame\n");
+  for(uint32_t s = 0u; s < NumberOf(sizes); s++)
+  {
+    double time_us = MeasureFrame((WIDTH - sizes[s]) / 2, (HEIGHT - sizes[s]) / 2, sizes[s], sizes[s], transfers);
+    printf("%4dx%-11d%12.1f%10u\n", sizes[s], sizes[s], time_us, transfers);
+  }
+  printf("\n");
+
+  for(uint32_t i = 0u; i < objs.size(); i++)
+  {
+    objs[i]->Hide();
+    delete objs[i];
+  }
+#else
+  printf("Update area benchmark needs UPDATE_AREA_ENABLED\n\n");
+#endif
+}
+
+// *****************************************************************************
+// ***   Benchmark frames with SPI transfer time   *****************************
+// *****************************************************************************
+// * Average of frame values in ms. With DISPLAY_TRANSFER_TASK rendering goes
+// * in parallel with transfers and driver waits only if all buffers are in
+// * flight.
+static void BenchTransfer(void)
+{
+  static const uint32_t counts[] = {1u, 32u, 128u};
+  DisplayDrv& drv = DisplayDrv::GetInstance();
+
+  display.SetClock(SPI_CLOCK_MHZ);
+  printf("Full frame with %u MHz SPI, %u buffers, ms per frame\n", SPI_CLOCK_MHZ, (uint32_t)DISPLAY_BUF_CNT);
+#if defined(DISPLAY_TRANSFER_TASK)
+  printf("%-16s%12s%12s%12s%12s%12s\n", "Objects", "Frame", "Render", "Wait", "Transfer", "In flight");
+#else
+  printf("%-16s%12s\n", "Objects", "Frame");
+#endif
+  for(uint32_t c = 0u; c < NumberOf(counts); c++)
+  {
+    std::vector<VisObject*> objs;
+    objs.push_back(new Box(0, 0, WIDTH, HEIGHT, COLOR_BLACK));
+    for(uint32_t i = 0u; i < counts[c]; i++)
+    {
+      int32_t x = (int32_t)((i * 37u) % (WIDTH - 40));
+      int32_t y = (int32_t)((i * 53u) % (HEIGHT - 20));
+      objs.push_back(new String("Text", x, y, COLOR_WHITE, COLOR_BLUE, Font_8x12::GetInstance()));
+    }
+    for(uint32_t i = 0u; i < objs.size(); i++) objs[i]->Show(i);
+
+    uint32_t frame_ms = 0u;
+#if defined(DISPLAY_TRANSFER_TASK)
+    uint32_t render_ms = 0u;
+    uint32_t wait_ms = 0u;
+    uint32_t transfer_ms = 0u;
+    uint32_t max_in_flight = 0u;
+#endif
+    for(uint32_t f = 0u; f < TRANSFER_FRAMES; f++)
+    {
+#if defined(UPDATE_AREA_ENABLED)
+      drv.InvalidateArea(0, 0, WIDTH - 1, HEIGHT - 1);
+#endif
+      drv.UpdateDisplay();
+      drv.Loop();
+      frame_ms += drv.GetFrameTimeMs();
+#if defined(DISPLAY_TRANSFER_TASK)
+      render_ms += drv.GetFrameRenderTimeMs();
+      wait_ms += drv.GetFrameWaitTimeMs();
+      transfer_ms += drv.GetFrameTransferTimeMs();
+      if(drv.GetFrameMaxBuffersInFlight() > max_in_flight) max_in_flight = drv.GetFrameMaxBuffersInFlight();
+#endif
+    }
+    printf("%-16u%12.1f", counts[c], (double)frame_ms / TRANSFER_FRAMES);
+#if defined(DISPLAY_TRANSFER_TASK)
+    printf("%12.1f%12.1f%12.1f%12u", (double)render_ms / TRANSFER_FRAMES, (double)wait_ms / TRANSFER_FRAMES,
+           (double)transfer_ms / TRANSFER_FRAMES, max_in_flight);
+#endif
+    printf("\n");
+
+    for(uint32_t i = 0u; i < objs.size(); i++)
+    {
+      objs[i]->Hide();
+      delete objs[i];
+    }
+  }
+  printf("\n");
+  display.SetClock(0u);
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  bool is_left_right = false;
+  bool is_frames_only = false;
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-l") == 0) is_left_right = true;
+    else if(strcmp(argv[i], "-f") == 0) is_frames_only = true;
+    else
+    {
+      printf("Usage: %s [-l] [-f]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  FillImages();
+  // Display driver have to be set before scheduler started. Task itself is
+  // never run: frames are drawn by calling Loop().
+  DisplayDrv& drv = DisplayDrv::GetInstance();
+  drv.InitTask(display);
+#if defined(DISPLAY_TRANSFER_TASK)
+  // Transfer task created by Setup() runs in own thread
+  vHostTaskRun("DisplayTransfer");
+#endif
+  drv.Setup();
+  if(is_left_right) drv.SetUpdateMode(DisplayDrv::UPDATE_LEFT_RIGHT);
+
+  if(!is_frames_only) BenchPrimitives();
+  BenchObjectCount();
+  BenchAreaSize();
+  BenchTransfer();
+
+  return 0;
+}
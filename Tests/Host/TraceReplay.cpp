@@ -0,0 +1,441 @@
+// *****************************************************************************
+// @file TraceReplay.cpp
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Update area trace replay for host build
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+// *****************************************************************************
+// * Replays sequences of InvalidateArea() calls frame by frame and prints
+// * pixels and windows that would be sent to display and time spent in Push()
+// * and Pop() by:
+// *   - intersection merge(UpdateAreaProcessor before cost based merge)
+// *   - cost based merge(UpdateAreaProcessor)
+// *   - dirty tiles(UpdateAreaTiles)
+// * Every frame all areas of trace are pushed, then all areas are popped as
+// * DisplayDrv does. Popped areas are checked to cover all pushed pixels.
+// * Time is host time, use it to compare processors with each other.
+// *
+// * Built-in traces model typical screens. Recorded trace can be replayed from
+// * text file with one InvalidateArea() call per line:
+// *   frame start_x start_y end_x end_y
+// * Frames have to be in increasing order.
+// *
+// * Usage: TraceReplay [-s] [file]
+// *   -s     print only totals of each trace
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+
+// Replay needs multiple update areas and tiles regardless of build options.
+// They can't be used together by display driver, so defined after DevCfg.h to
+// bypass its checks: display driver itself isn't used here.
+#if !defined(MULTIPLE_UPDATE_AREAS)
+  #define MULTIPLE_UPDATE_AREAS 32
+#endif
+#if !defined(UPDATE_AREA_TILES)
+  #define UPDATE_AREA_TILES 16
+#endif
+
+#include "Display/DisplayDrv.h"
+#include "Display/UpdateAreaProcessor.h"
+#include "UpdateAreaProcessorOld.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// *****************************************************************************
+// ***   Screen size   *********************************************************
+// *****************************************************************************
+static const int32_t WIDTH = 320;
+static const int32_t HEIGHT = 240;
+
+// *****************************************************************************
+// ***   Get time in nanoseconds   *********************************************
+// *****************************************************************************
+static int64_t GetTimeNs(void)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// *****************************************************************************
+// ***   Trace: areas invalidated in each frame   ******************************
+// *****************************************************************************
+typedef std::vector<UpdateArea_t> Frame;
+typedef std::vector<Frame> Trace;
+
+// *****************************************************************************
+// ***   Result of one frame   *************************************************
+// *****************************************************************************
+typedef struct
+{
+  // Pixels sent to display
+  uint32_t pixels;
+  // Windows set
+  uint32_t windows;
+  // Time of Push() and Pop() calls in nanoseconds
+  int64_t time_ns;
+  // Pushed pixels not covered by popped areas
+  uint32_t missed;
+} Stats;
+
+// *****************************************************************************
+// ***   Add area to frame   ***************************************************
+// *****************************************************************************
+// * Area clipped to screen as InvalidateArea() does.
+static void Add(Frame& frame, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  int32_t start_x = MAX(x, 0);
+  int32_t start_y = MAX(y, 0);
+  int32_t end_x = MIN(x + w - 1, WIDTH - 1);
+  int32_t end_y = MIN(y + h - 1, HEIGHT - 1);
+  if((start_x <= end_x) && (start_y <= end_y))
+  {
+    UpdateArea_t area;
+    area.start_x = (uint16_t)start_x;
+    area.start_y = (uint16_t)start_y;
+    area.end_x = (uint16_t)end_x;
+    area.end_y = (uint16_t)end_y;
+    frame.push_back(area);
+  }
+}
+
+// *****************************************************************************
+// ***   Trace: clock   ********************************************************
+// *****************************************************************************
+// * HH:MM:SS with 24x32 digits, one frame per second: last digit changes every
+// * frame, colons blink, progress bar under clock grows.
+static void GenClock(Trace& trace, uint32_t frames)
+{
+  for(uint32_t f = 0u; f < frames; f++)
+  {
+    Frame frame;
+    uint32_t sec = 50u + f;
+    // Seconds
+    Add(frame, 232, 100, 24, 32);
+    if(sec % 10u == 0u) Add(frame, 208, 100, 24, 32);
+    // Minutes
+    if(sec % 60u == 0u)
+    {
+      Add(frame, 160, 100, 24, 32);
+      Add(frame, 136, 100, 24, 32);
+    }
+    // Colons
+    Add(frame, 124, 108, 8, 16);
+    Add(frame, 196, 108, 8, 16);
+    // Progress bar
+    Add(frame, 64 + (int32_t)(sec % 60u) * 3, 140, 3, 4);
+    trace.push_back(frame);
+  }
+}
+
+// *****************************************************************************
+// ***   Trace: sprites   ******************************************************
+// *****************************************************************************
+// * Six 24x24 sprites bounce over screen. Each move invalidates old and new
+// * position as VisObject::Move() does.
+static void GenSprites(Trace& trace, uint32_t frames)
+{
+  static const int32_t SIZE = 24;
+  int32_t x[6] = {10, 100, 200, 40, 250, 150};
+  int32_t y[6] = {20, 60, 30, 180, 150, 100};
+  int32_t vx[6] = {3, -4, 5, 2, -3, 6};
+  int32_t vy[6] = {2, 3, -2, -4, 5, -1};
+  for(uint32_t f = 0u; f < frames; f++)
+  {
+    Frame frame;
+    for(uint32_t i = 0u; i < NumberOf(x); i++)
+    {
+      Add(frame, x[i], y[i], SIZE, SIZE);
+      if((x[i] + vx[i] < 0) || (x[i] + vx[i] + SIZE > WIDTH)) vx[i] = -vx[i];
+      if((y[i] + vy[i] < 0) || (y[i] + vy[i] + SIZE > HEIGHT)) vy[i] = -vy[i];
+      x[i] += vx[i];
+      y[i] += vy[i];
+      Add(frame, x[i], y[i], SIZE, SIZE);
+    }
+    trace.push_back(frame);
+  }
+}
+
+// *****************************************************************************
+// ***   Trace: menu   *********************************************************
+// *****************************************************************************
+// * Selection moves one row down every frame: old and new rows are redrawn,
+// * scroll bar thumb follows selection.
+static void GenMenu(Trace& trace, uint32_t frames)
+{
+  static const int32_t ROWS = 12;
+  static const int32_t ROW_H = 18;
+  for(uint32_t f = 0u; f < frames; f++)
+  {
+    Frame frame;
+    int32_t old_row = (int32_t)(f % ROWS);
+    int32_t new_row = (old_row + 1) % ROWS;
+    Add(frame, 10, 10 + old_row * ROW_H, 290, ROW_H);
+    Add(frame, 10, 10 + new_row * ROW_H, 290, ROW_H);
+    Add(frame, 306, 10 + old_row * ROW_H, 6, 30);
+    Add(frame, 306, 10 + new_row * ROW_H, 6, 30);
+    trace.push_back(frame);
+  }
+}
+
+// *****************************************************************************
+// ***   Trace: typing   *******************************************************
+// *****************************************************************************
+// * One 8x12 character typed every frame, cursor moves after it. Status line
+// * with character counter is updated too.
+static void GenTyping(Trace& trace, uint32_t frames)
+{
+  for(uint32_t f = 0u; f < frames; f++)
+  {
+    Frame frame;
+    int32_t col = (int32_t)(f % 36u);
+    int32_t row = (int32_t)(f / 36u);
+    int32_t x = 16 + col * 8;
+    int32_t y = 40 + row * 14;
+    // Character and cursor
+    Add(frame, x, y, 8, 12);
+    Add(frame, x + 8, y, 2, 12);
+    // Counter in status line
+    Add(frame, 260, 224, 48, 12);
+    trace.push_back(frame);
+  }
+}
+
+// *****************************************************************************
+// ***   Trace: scattered   ****************************************************
+// *****************************************************************************
+// * Twenty small areas of random size at random positions every frame.
+static void GenScattered(Trace& trace, uint32_t frames)
+{
+  uint32_t seed = 12345u;
+  for(uint32_t f = 0u; f < frames; f++)
+  {
+    Frame frame;
+    for(uint32_t i = 0u; i < 20u; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      int32_t w = 4 + (int32_t)((seed >> 16u) % 44u);
+      int32_t h = 4 + (int32_t)((seed >> 24u) % 44u);
+      seed = seed * 1103515245u + 12345u;
+      int32_t x = (int32_t)((seed >> 8u) % (uint32_t)(WIDTH - w));
+      int32_t y = (int32_t)((seed >> 20u) % (uint32_t)(HEIGHT - h));
+      Add(frame, x, y, w, h);
+    }
+    trace.push_back(frame);
+  }
+}
+
+// *****************************************************************************
+// ***   Load recorded trace   *************************************************
+// *****************************************************************************
+static bool LoadTrace(Trace& trace, const char* file_name)
+{
+  bool result = false;
+  FILE* f = fopen(file_name, "r");
+  if(f != nullptr)
+  {
+    int frame_num = -1;
+    int frame;
+    int start_x, start_y, end_x, end_y;
+    while(fscanf(f, "%d %d %d %d %d", &frame, &start_x, &start_y, &end_x, &end_y) == 5)
+    {
+      // New frame
+      if(frame != frame_num)
+      {
+        trace.push_back(Frame());
+        frame_num = frame;
+      }
+      Add(trace.back(), start_x, start_y, end_x - start_x + 1, end_y - start_y + 1);
+    }
+    fclose(f);
+    result = !trace.empty();
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Replay one frame   ****************************************************
+// *****************************************************************************
+template <typename P> static Stats ReplayFrame(P& processor, const Frame& frame)
+{
+  // Pixels invalidated in frame: 1 - pushed, 2 - popped
+  static uint8_t map[WIDTH * HEIGHT];
+  // Popped areas, one per pixel is more than any processor can return
+  static UpdateArea_t popped[WIDTH * HEIGHT];
+  Stats stats = {0u, 0u, 0, 0u};
+  memset(map, 0, sizeof(map));
+
+  // Push all areas of frame
+  int64_t start_ns = GetTimeNs();
+  for(uint32_t i = 0u; i < frame.size(); i++)
+  {
+    UpdateArea_t area = frame[i];
+    processor.Push(area);
+  }
+  // Pop all areas
+  while(processor.Pop(popped[stats.windows]))
+  {
+    stats.windows++;
+  }
+  stats.time_ns = GetTimeNs() - start_ns;
+
+  // Mark pushed pixels
+  for(uint32_t i = 0u; i < frame.size(); i++)
+  {
+    const UpdateArea_t& area = frame[i];
+    for(uint32_t y = area.start_y; y <= area.end_y; y++)
+    {
+      memset(&map[y * WIDTH + area.start_x], 1, area.end_x - area.start_x + 1u);
+    }
+  }
+  // Count and mark popped pixels
+  for(uint32_t i = 0u; i < stats.windows; i++)
+  {
+    const UpdateArea_t& area = popped[i];
+    stats.pixels += (area.end_x - area.start_x + 1u) * (area.end_y - area.start_y + 1u);
+    for(uint32_t y = area.start_y; y <= area.end_y; y++)
+    {
+      memset(&map[y * WIDTH + area.start_x], 2, area.end_x - area.start_x + 1u);
+    }
+  }
+  // Pushed pixels that aren't popped
+  for(uint32_t i = 0u; i < sizeof(map); i++)
+  {
+    if(map[i] == 1u) stats.missed++;
+  }
+  // Return result
+  return stats;
+}
+
+// *****************************************************************************
+// ***   Processors to compare   ***********************************************
+// *****************************************************************************
+static const uint32_t PROCESSORS_CNT = 3u;
+static const char* const processor_names[PROCESSORS_CNT] = {"Old merge", "Cost merge", "Tiles"};
+
+// *****************************************************************************
+// ***   Replay trace   ********************************************************
+// *****************************************************************************
+// * Returns number of pixels that were invalidated, but not sent.
+static uint32_t Replay(const char* name, const Trace& trace, bool is_verbose)
+{
+  UpdateAreaProcessorOld<MULTIPLE_UPDATE_AREAS> old_areas;
+  UpdateAreaProcessor<MULTIPLE_UPDATE_AREAS> new_areas;
+  UpdateAreaTiles<UPDATE_AREA_TILES> tiles;
+  Stats total[PROCESSORS_CNT] = {};
+  uint32_t pushed = 0u;
+  uint32_t missed = 0u;
+
+  printf("%s: %u frames\n", name, (uint32_t)trace.size());
+  printf("%16s", "");
+  for(uint32_t p = 0u; p < PROCESSORS_CNT; p++) printf("%26s", processor_names[p]);
+  printf("\n%8s%8s", "Frame", "Areas");
+  for(uint32_t p = 0u; p < PROCESSORS_CNT; p++) printf("%10s%8s%8s", "pixels", "windows", "ns");
+  printf("\n");
+  for(uint32_t f = 0u; f < trace.size(); f++)
+  {
+    Stats stats[PROCESSORS_CNT];
+    stats[0u] = ReplayFrame(old_areas, trace[f]);
+    stats[1u] = ReplayFrame(new_areas, trace[f]);
+    stats[2u] = ReplayFrame(tiles, trace[f]);
+    if(is_verbose) printf("%8u%8u", f, (uint32_t)trace[f].size());
+    for(uint32_t p = 0u; p < PROCESSORS_CNT; p++)
+    {
+      if(is_verbose) printf("%10u%8u%8lld", stats[p].pixels, stats[p].windows, (long long)stats[p].time_ns);
+      total[p].pixels += stats[p].pixels;
+      total[p].windows += stats[p].windows;
+      total[p].time_ns += stats[p].time_ns;
+      total[p].missed += stats[p].missed;
+    }
+    if(is_verbose) printf("\n");
+    pushed += trace[f].size();
+  }
+  printf("%8s%8u", "Total", pushed);
+  for(uint32_t p = 0u; p < PROCESSORS_CNT; p++)
+  {
+    printf("%10u%8u%8lld", total[p].pixels, total[p].windows, (long long)total[p].time_ns);
+  }
+  // Cost of frame as cost based merge sees it
+  printf("\n%16s", "Cost");
+  for(uint32_t p = 0u; p < PROCESSORS_CNT; p++)
+  {
+    printf("%*s%10u", (p == 0u) ? 0 : 16, "", total[p].pixels + total[p].windows * (uint32_t)UPDATE_AREA_WINDOW_COST);
+  }
+  printf("\n");
+  for(uint32_t p = 0u; p < PROCESSORS_CNT; p++)
+  {
+    if(total[p].missed != 0u) printf("%s FAIL: %u pixels not sent\n", processor_names[p], total[p].missed);
+    missed += total[p].missed;
+  }
+  printf("\n");
+  // Return result
+  return missed;
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  static const uint32_t FRAMES = 32u;
+  bool is_verbose = true;
+  const char* file_name = nullptr;
+  uint32_t missed = 0u;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-s") == 0) is_verbose = false;
+    else                           file_name = argv[i];
+  }
+
+  printf("Update areas: %u, tile size: %u, window cost: %u pixels\n\n", (uint32_t)MULTIPLE_UPDATE_AREAS,
+         (uint32_t)UPDATE_AREA_TILES, (uint32_t)UPDATE_AREA_WINDOW_COST);
+  if(file_name != nullptr)
+  {
+    Trace trace;
+    if(LoadTrace(trace, file_name))
+    {
+      missed += Replay(file_name, trace, is_verbose);
+    }
+    else
+    {
+      printf("Can't load trace from %s\n", file_name);
+      missed++;
+    }
+  }
+  else
+  {
+    static const struct {const char* name; void (*gen)(Trace& trace, uint32_t frames);} traces[] =
+    {
+      {"Clock",     GenClock},
+      {"Sprites",   GenSprites},
+      {"Menu",      GenMenu},
+      {"Typing",    GenTyping},
+      {"Scattered", GenScattered}
+    };
+    for(uint32_t i = 0u; i < NumberOf(traces); i++)
+    {
+      Trace trace;
+      traces[i].gen(trace, FRAMES);
+      missed += Replay(traces[i].name, trace, is_verbose);
+    }
+  }
+
+  return (missed == 0u) ? 0 : 1;
+}
@@ -0,0 +1,242 @@
+// *****************************************************************************
+// @file UpdateAreaProcessorOld.h
+// @author Nicolai Shlapunov
+//
+// @details DevCore: Intersection merge update area processor for trace replay
+//
+// @copyright Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+//            All rights reserved.
+//
+// @section SUPPORT
+//
+//  Devtronic invests time and resources providing this open source code,
+//  please support Devtronic and open-source hardware/software by
+//  donations and/or purchasing products from Devtronic.
+//
+// *****************************************************************************
+
+#ifndef UpdateAreaProcessorOld_h
+#define UpdateAreaProcessorOld_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "Display/DisplayDrv.h"
+
+// *****************************************************************************
+// ***   Update Area Processor with intersection merge   ***********************
+// *****************************************************************************
+// * Copy of UpdateAreaProcessor before cost based merge, kept only to compare
+// * them in TraceReplay. Areas merged if they intersect, if array is full new
+// * area is added to the first one. All zero area means empty spot.
+template <int N> class UpdateAreaProcessorOld
+{
+  public:
+    // *************************************************************************
+    // ***   Public: UpdateAreaProcessorOld   **********************************
+    // *************************************************************************
+    UpdateAreaProcessorOld()
+    {
+      // Clear array
+      Clear();
+    }
+
+    // *************************************************************************
+    // ***   Public: Push   ****************************************************
+    // *************************************************************************
+    bool Push(UpdateArea_t& value)
+    {
+      // Find empty spot
+      uint32_t idx = GetFirstEmptySpot();
+      // Check if there an empty spot in the list
+      if(idx < N)
+      {
+        // Store new value in array
+        array[idx] = value;
+      }
+      else // otherwise
+      {
+        // Add new area to the first existing one
+        if(value.start_x < array[0].start_x) array[0].start_x = value.start_x;
+        if(value.start_y < array[0].start_y) array[0].start_y = value.start_y;
+        if(value.end_x > array[0].end_x) array[0].end_x = value.end_x;
+        if(value.end_y > array[0].end_y) array[0].end_y = value.end_y;
+      }
+      // Merge all areas
+      while(ReMerge());
+      // Eliminate empty spots between areas in list that can happen after the merge process
+      Compact();
+      // Return result
+      return true;
+    }
+
+    // *************************************************************************
+    // ***   Public: Pop   *****************************************************
+    // *************************************************************************
+    bool Pop(UpdateArea_t& val)
+    {
+      // False by default
+      bool result = false;
+      // Find filled spot
+      uint32_t idx = GetFirstFilledSpot();
+      // If we have one
+      if(idx < N)
+      {
+        // Store value
+        val = array[idx];
+        // Clear the spot
+        array[idx] = {0};
+        // Move other records to beginning
+        Compact();
+        // Set result
+        result = true;
+      }
+      // Return result
+      return result;
+    }
+
+    // *************************************************************************
+    // ***   Public: IsEmpty   *************************************************
+    // *************************************************************************
+    bool IsEmpty(void) {return (GetFirstFilledSpot() == N);}
+
+    // *************************************************************************
+    // ***   Public: GetItemsCnt   *********************************************
+    // *************************************************************************
+    uint32_t GetItemsCnt(void)
+    {
+      uint32_t n = 0u;
+      // Count filled spots
+      for(uint32_t i = 0u; i < N; i++)
+      {
+        if(!IsEmpty(i)) n++;
+      }
+      // Return result
+      return n;
+    }
+
+    // *************************************************************************
+    // ***   Public: Clear   ***************************************************
+    // *************************************************************************
+    void Clear(void)
+    {
+      // Clear array
+      for(uint32_t i = 0u; i < N; i++)
+      {
+        array[i] = {0};
+      }
+    }
+
+  private:
+    // Areas, all zero area is empty spot
+    UpdateArea_t array[N];
+
+    // *************************************************************************
+    // ***   Private: IsEmpty   ************************************************
+    // *************************************************************************
+    bool IsEmpty(uint32_t idx)
+    {
+      return ( (array[idx].start_x == 0) && (array[idx].start_y == 0) &&
+               (array[idx].end_x == 0) && (array[idx].end_y == 0) );
+    }
+
+    // *************************************************************************
+    // ***   Private: GetFirstEmptySpot   **************************************
+    // *************************************************************************
+    uint32_t GetFirstEmptySpot(void)
+    {
+      uint32_t idx = 0u;
+      // Find empty spot
+      for(; (idx < N) && !IsEmpty(idx); idx++);
+      // Return result
+      return idx;
+    }
+
+    // *************************************************************************
+    // ***   Private: GetFirstFilledSpot   *************************************
+    // *************************************************************************
+    uint32_t GetFirstFilledSpot(void)
+    {
+      uint32_t idx = 0u;
+      // Find filled spot
+      for(; (idx < N) && IsEmpty(idx); idx++);
+      // Return result
+      return idx;
+    }
+
+    // *************************************************************************
+    // ***   Private: ReMerge   ************************************************
+    // *************************************************************************
+    bool ReMerge(void)
+    {
+      // No merge happened
+      bool result = false;
+      // Check all filled spots
+      for(uint32_t idx = 0u; idx < N; idx++)
+      {
+        // If current record isn't empty
+        if(!IsEmpty(idx))
+        {
+          // Check the rest
+          for(uint32_t n = idx + 1u; n < N; n++)
+          {
+            // If we found isn't empty area - try to merge it
+            if(!IsEmpty(n))
+            {
+              // Check intersection
+              bool width_is_positive  = MIN(array[n].end_x, array[idx].end_x) > MAX(array[n].start_x, array[idx].start_x);
+              bool height_is_positive = MIN(array[n].end_y, array[idx].end_y) > MAX(array[n].start_y, array[idx].start_y);
+              // Merge areas if intersects
+              if(width_is_positive && height_is_positive)
+              {
+                // Add new area to existing one
+                if(array[n].start_x < array[idx].start_x) array[idx].start_x = array[n].start_x;
+                if(array[n].start_y < array[idx].start_y) array[idx].start_y = array[n].start_y;
+                if(array[n].end_x > array[idx].end_x) array[idx].end_x = array[n].end_x;
+                if(array[n].end_y > array[idx].end_y) array[idx].end_y = array[n].end_y;
+                // Clear merged record
+                array[n] = {0};
+                // Set result
+                result = true;
+                // Already merged, break the cycle
+                break;
+              }
+            }
+          }
+        }
+      }
+      // Return result
+      return result;
+    }
+
+    // *************************************************************************
+    // ***   Private: Compact   ************************************************
+    // *************************************************************************
+    void Compact(void)
+    {
+      // Count all records
+      for(uint32_t idx = 0u; idx < N; idx++)
+      {
+        // If current record is empty
+        if(IsEmpty(idx))
+        {
+          // Check the rest
+          for(uint32_t n = idx + 1u; n < N; n++)
+          {
+            // If we found isn't empty area - copy and clear it
+            if(!IsEmpty(n))
+            {
+              // Copy record closer to beginning of array
+              array[idx] = array[n];
+              // Clear merged record
+              array[n] = {0};
+              // Break cycle
+              break;
+            }
+          }
+        }
+      }
+    }
+};
+
+#endif
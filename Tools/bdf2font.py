@@ -0,0 +1,377 @@
+#!/usr/bin/env python3
+# *****************************************************************************
+# @file bdf2font.py
+# @author Nicolai Shlapunov
+#
+# @details DevCore: BDF font to FontPacked converter
+#
+# @section COPYRIGHT
+#
+#  Copyright (c) 2026, Devtronic & Nicolai Shlapunov
+#  All rights reserved.
+#
+# @section LICENSE
+#
+#  SPDX-License-Identifier: BSD-3-Clause
+#
+# @section USAGE
+#
+#  bdf2font.py font.bdf Font_Name [-r 32-126,160-255] [-o Display/Fonts]
+#              [--rle auto|never|always] [--default 63|none]
+#
+#  Generates Font_Name.h and Font_Name.cpp with class Font_Name derived from
+#  FontPacked. Glyphs are trimmed to pixels that are set, bitmap of each glyph
+#  is run-length encoded if it is smaller this way(--rle auto).
+#
+# *****************************************************************************
+
+import argparse
+import os
+import sys
+
+# Flags and constants, should be the same as in FontPacked.h
+GLYPH_RLE = 0x01
+NO_PAGE = 0xFFFF
+NO_GLYPH = 0xFFFF
+
+# *****************************************************************************
+# ***   Glyph   ***************************************************************
+# *****************************************************************************
+class Glyph:
+  def __init__(self, code, advance, x_offset, y_offset, rows):
+    self.code = code
+    self.advance = advance
+    # Rows of pixels: lists of 0/1, all rows have the same length
+    self.rows = rows
+    self.x_offset = x_offset
+    self.y_offset = y_offset
+    self.trim()
+
+  # Remove empty rows and columns around set pixels
+  def trim(self):
+    rows = [i for i, r in enumerate(self.rows) if any(r)]
+    cols = [i for i in range(len(self.rows[0]) if self.rows else 0) if any(r[i] for r in self.rows)]
+    if rows and cols:
+      self.rows = [r[cols[0]:cols[-1] + 1] for r in self.rows[rows[0]:rows[-1] + 1]]
+      self.x_offset += cols[0]
+      self.y_offset += rows[0]
+    else:
+      self.rows = []
+      self.x_offset = 0
+      self.y_offset = 0
+
+  @property
+  def width(self):
+    return len(self.rows[0]) if self.rows else 0
+
+  @property
+  def height(self):
+    return len(self.rows)
+
+  # Bitmap: width * height bits row after row, first pixel in bit 0 of byte
+  def bitmap(self):
+    bits = [p for r in self.rows for p in r]
+    data = bytearray((len(bits) + 7) // 8)
+    for i, p in enumerate(bits):
+      if p:
+        data[i // 8] |= 1 << (i % 8)
+    return bytes(data)
+
+  # Run-length encoded bitmap: for each row number of runs and runs, high
+  # nibble is number of clear pixels, low nibble is number of set pixels
+  def rle(self):
+    data = bytearray()
+    for r in self.rows:
+      runs = []
+      i = 0
+      while i < len(r):
+        clear = 0
+        while i < len(r) and not r[i]:
+          clear += 1
+          i += 1
+        set_cnt = 0
+        while i < len(r) and r[i]:
+          set_cnt += 1
+          i += 1
+        # Clear pixels at the end of row aren't stored
+        if set_cnt > 0:
+          while clear > 15:
+            runs.append(0xF0)
+            clear -= 15
+          while set_cnt > 15:
+            runs.append((clear << 4) | 15)
+            clear = 0
+            set_cnt -= 15
+          runs.append((clear << 4) | set_cnt)
+      if len(runs) > 255:
+        raise ValueError("too many runs in row of glyph U+%04X" % self.code)
+      data.append(len(runs))
+      data.extend(runs)
+    return bytes(data)
+
+# *****************************************************************************
+# ***   Parse BDF font   ******************************************************
+# *****************************************************************************
+def parse_bdf(path, codes):
+  props = {}
+  glyphs = []
+  ascent = descent = None
+  with open(path, "r", encoding="latin-1") as f:
+    lines = iter(f.read().splitlines())
+  for line in lines:
+    words = line.split()
+    if not words:
+      continue
+    if words[0] == "FONTBOUNDINGBOX":
+      props["height"] = int(words[2])
+      props["bottom"] = int(words[4])
+    elif words[0] == "FONT_ASCENT":
+      ascent = int(words[1])
+    elif words[0] == "FONT_DESCENT":
+      descent = int(words[1])
+    elif words[0] == "COPYRIGHT":
+      props["copyright"] = line.split(None, 1)[1].strip().strip('"')
+    elif words[0] == "STARTCHAR":
+      code = -1
+      advance = 0
+      bbx = (0, 0, 0, 0)
+      for line in lines:
+        words = line.split() or [""]
+        if words[0] == "ENCODING":
+          code = int(words[1])
+        elif words[0] == "DWIDTH":
+          advance = int(words[1])
+        elif words[0] == "BBX":
+          bbx = tuple(int(w) for w in words[1:5])
+        elif words[0] == "BITMAP":
+          rows = []
+          for line in lines:
+            if line.strip() == "ENDCHAR":
+              break
+            value = int(line.strip(), 16)
+            bits = len(line.strip()) * 4
+            rows.append([(value >> (bits - 1 - i)) & 1 for i in range(bbx[0])])
+          if code in codes:
+            glyphs.append((code, advance, bbx, rows))
+          break
+  # Font height and baseline
+  if ascent is None or descent is None:
+    ascent = props["height"] + props["bottom"]
+    descent = -props["bottom"]
+  height = ascent + descent
+  result = []
+  for code, advance, (w, h, xoff, yoff), rows in glyphs:
+    # Top of glyph from top of font, rows outside of font are dropped
+    top = ascent - (yoff + h)
+    while rows and top < 0:
+      rows.pop(0)
+      top += 1
+    while rows and top + len(rows) > height:
+      rows.pop()
+    if not rows:
+      rows = [[0] * w]
+    result.append(Glyph(code, advance, xoff, top, rows))
+  result.sort(key=lambda g: g.code)
+  return result, height, props.get("copyright")
+
+# *****************************************************************************
+# ***   Parse code point ranges   *********************************************
+# *****************************************************************************
+def parse_ranges(text):
+  codes = set()
+  for part in text.split(","):
+    first, _, last = part.partition("-")
+    first = int(first, 0)
+    last = int(last, 0) if last else first
+    codes.update(range(first, last + 1))
+  return codes
+
+# *****************************************************************************
+# ***   Build font tables   ***************************************************
+# *****************************************************************************
+def build(glyphs, rle_mode):
+  bitmap = bytearray()
+  table = []
+  rle_cnt = 0
+  for g in glyphs:
+    data = g.bitmap()
+    flags = 0
+    if rle_mode != "never" and g.rows:
+      rle = g.rle()
+      if rle_mode == "always" or len(rle) < len(data):
+        data = rle
+        flags |= GLYPH_RLE
+        rle_cnt += 1
+    if len(bitmap) > 0xFFFF:
+      raise ValueError("bitmap is larger than 64 KB, use smaller code point ranges")
+    for name, value, low, high in (("advance", g.advance, 0, 255), ("width", g.width, 0, 255),
+                                   ("height", g.height, 0, 255), ("x offset", g.x_offset, -128, 127),
+                                   ("y offset", g.y_offset, -128, 127)):
+      if not low <= value <= high:
+        raise ValueError("%s of glyph U+%04X is out of range" % (name, g.code))
+    table.append((len(bitmap), g.width, g.height, g.x_offset, g.y_offset, g.advance, flags, g.code))
+    bitmap.extend(data)
+  if len(glyphs) >= NO_GLYPH:
+    raise ValueError("too many glyphs")
+  # Two level index: 256 code points pages of 16 code points blocks
+  pages_cnt = (glyphs[-1].code >> 8) + 1
+  pages = [NO_PAGE] * pages_cnt
+  blocks = []
+  for idx, g in enumerate(glyphs):
+    page = g.code >> 8
+    if pages[page] == NO_PAGE:
+      pages[page] = len(blocks)
+      blocks.extend([[idx, 0] for _ in range(16)])
+    block = blocks[pages[page] + ((g.code >> 4) & 15)]
+    if block[1] == 0:
+      block[0] = idx
+    block[1] |= 1 << (g.code & 15)
+  return table, bytes(bitmap), pages, blocks, rle_cnt
+
+# *****************************************************************************
+# ***   Character for comment   ***********************************************
+# *****************************************************************************
+def char_comment(code):
+  text = "U+%04X" % code
+  if 0x20 <= code < 0x7F:
+    text += " '%c'" % code
+  return text
+
+# *****************************************************************************
+# ***   Write file with CRLF line endings   ***********************************
+# *****************************************************************************
+def write_file(path, lines):
+  with open(path, "w", encoding="ascii", newline="\r\n") as f:
+    f.write("\n".join(lines) + "\n")
+
+# *****************************************************************************
+# ***   File header   *********************************************************
+# *****************************************************************************
+def file_header(file_name, details, source, copyright):
+  lines = ["// " + "*" * 77,
+           "// @file %s" % file_name,
+           "// @author bdf2font.py",
+           "//",
+           "// @details DevCore: %s" % details,
+           "//",
+           "// @section SOURCE",
+           "//",
+           "//  Generated from %s" % os.path.basename(source)]
+  if copyright:
+    lines += ["//", "// @copyright %s" % copyright]
+  lines += ["//", "// " + "*" * 77, ""]
+  return lines
+
+# *****************************************************************************
+# ***   Banner comment   ******************************************************
+# *****************************************************************************
+def banner(text, indent=""):
+  line = "%s// ***   %s   " % (indent, text)
+  return [indent + "// " + "*" * (77 - len(indent)),
+          line + "*" * (80 - len(line)),
+          indent + "// " + "*" * (77 - len(indent))]
+
+# *****************************************************************************
+# ***   Generate header and source files   ************************************
+# *****************************************************************************
+def generate(name, out_dir, source, copyright, height, default, table, bitmap, pages, blocks):
+  min_x = min([0] + [t[3] for t in table if t[1] > 0])
+  overhang = max([0] + [t[3] + t[1] - t[5] for t in table if t[1] > 0])
+  max_advance = max(t[5] for t in table)
+
+  h = file_header(name + ".h", "%s packed font, header" % name, source, copyright)
+  h += ["#ifndef %s_h" % name, "#define %s_h" % name, ""]
+  h += banner("Includes")
+  h += ['#include "DevCfg.h"', '#include "Display/FontPacked.h"', ""]
+  h += banner("Font Class")
+  h += ["class %s : public FontPacked" % name, "{", "  public:"]
+  h += banner("Get Instance", "    ")
+  h += ["    static %s& GetInstance(void);" % name, "", "  private:",
+        "    // Font data declaration",
+        "    static const FontPacked::Glyph glyphs[%d];" % len(table),
+        "    static const uint8_t bitmap[%d];" % len(bitmap),
+        "    static const uint16_t pages[%d];" % len(pages),
+        "    static const FontPacked::Block blocks[%d];" % len(blocks),
+        "    static const FontPacked::Data data;", ""]
+  h += ["    // " + "*" * 73,
+        "    // ** Private constructor. Only GetInstance() allow to access this class. **",
+        "    // " + "*" * 73]
+  h += ["    explicit %s();" % name, "};", "", "#endif"]
+
+  c = file_header(name + ".cpp", "%s packed font, implementation" % name, source, copyright)
+  c += banner("Includes")
+  c += ['#include "%s.h"' % name, ""]
+  c += banner("Get Instance")
+  c += ["%s& %s::GetInstance(void)" % (name, name), "{",
+        "   static %s %s;" % (name, name.lower()),
+        "   return %s;" % name.lower(), "}", ""]
+  c += banner("Private: Constructor")
+  c += ["%s::%s() : FontPacked(data)" % (name, name), "{", "}", ""]
+  c += banner("Private: Font data")
+  c += ["const FontPacked::Data %s::data = {glyphs, bitmap, pages, blocks, %du, %s, %du, %du, %d, %du};"
+        % (name, len(pages), ("%du" % default) if default != NO_GLYPH else "FontPacked::NO_GLYPH",
+           height, max_advance, min_x, overhang), ""]
+  c += ["// Offset, width, height, x offset, y offset, advance, flags",
+        "const FontPacked::Glyph %s::glyphs[%d] = {" % (name, len(table))]
+  for i, t in enumerate(table):
+    sep = "," if i < len(table) - 1 else " "
+    c.append("  {%5du, %3du, %3du, %4d, %4d, %3du, 0x%02Xu}%s // %s" % (t[:7] + (sep, char_comment(t[7]))))
+  c += ["};", "", "const uint8_t %s::bitmap[%d] = {" % (name, len(bitmap))]
+  for i in range(0, len(bitmap), 16):
+    chunk = ", ".join("0x%02X" % b for b in bitmap[i:i + 16])
+    c.append("  " + chunk + ("," if i + 16 < len(bitmap) else ""))
+  c += ["};", "", "const uint16_t %s::pages[%d] = {" % (name, len(pages))]
+  for i in range(0, len(pages), 8):
+    chunk = ", ".join("0x%04Xu" % p for p in pages[i:i + 8])
+    c.append("  " + chunk + ("," if i + 8 < len(pages) else ""))
+  c += ["};", "", "// First glyph, mask of present code points",
+        "const FontPacked::Block %s::blocks[%d] = {" % (name, len(blocks))]
+  for i, b in enumerate(blocks):
+    sep = "," if i < len(blocks) - 1 else " "
+    c.append("  {%5du, 0x%04Xu}%s // U+%04X" % (b[0], b[1], sep, (pages.index(i - i % 16) << 8) | ((i % 16) << 4)))
+  c += ["};"]
+
+  write_file(os.path.join(out_dir, name + ".h"), h)
+  write_file(os.path.join(out_dir, name + ".cpp"), c)
+
+# *****************************************************************************
+# ***   Main   ****************************************************************
+# *****************************************************************************
+def main():
+  parser = argparse.ArgumentParser(description="Convert BDF font to DevCore FontPacked font")
+  parser.add_argument("bdf", help="BDF font file")
+  parser.add_argument("name", help="class and file name, for example Font_Sans12")
+  parser.add_argument("-r", "--ranges", default="32-126", help="code point ranges, default 32-126")
+  parser.add_argument("-o", "--out", default=".", help="output directory")
+  parser.add_argument("--rle", choices=("auto", "never", "always"), default="auto",
+                      help="run-length encode glyphs: if smaller(auto), never or always")
+  parser.add_argument("--default", default="63",
+                      help="code point drawn for missing characters or none, default 63('?')")
+  args = parser.parse_args()
+
+  try:
+    glyphs, height, copyright = parse_bdf(args.bdf, parse_ranges(args.ranges))
+    if not glyphs:
+      raise ValueError("no glyphs in given ranges")
+    table, bitmap, pages, blocks, rle_cnt = build(glyphs, args.rle)
+  except (OSError, ValueError, KeyError) as e:
+    sys.exit("bdf2font: %s" % e)
+
+  default = NO_GLYPH
+  if args.default != "none":
+    code = int(args.default, 0)
+    default = next((i for i, g in enumerate(glyphs) if g.code == code), NO_GLYPH)
+    if default == NO_GLYPH:
+      print("bdf2font: default code point %d isn't in font" % code, file=sys.stderr)
+
+  generate(args.name, args.out, args.bdf, copyright, height, default, table, bitmap, pages, blocks)
+
+  # Size of font data in flash
+  glyphs_size = len(table) * 8
+  index_size = len(pages) * 2 + len(blocks) * 4
+  print("%s: %d glyphs(%d RLE), height %d" % (args.name, len(table), rle_cnt, height))
+  print("  glyphs %d + bitmap %d + index %d + header 24 = %d bytes"
+        % (glyphs_size, len(bitmap), index_size, glyphs_size + len(bitmap) + index_size + 24))
+
+if __name__ == "__main__":
+  main()
@@ -296,8 +296,53 @@ void UiButton::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x
 // *****************************************************************************
 void UiButton::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
-  // TODO
-  string.DrawInBufH(buf, n, row, start_y);
+  // Draw only if needed
+  if((row >= x_start) && (row <= x_end))
+  {
+    // Find start y position
+    int32_t start = y_start - start_y;
+    // Prevent write in memory before buffer
+    if(start < 0) start = 0;
+    // Find end y position
+    int32_t end = y_end - start_y;
+    // Prevent buffer overflow
+    if(end >= n) end = n - 1;
+    if(end >= 0)
+    {
+      // Color variable
+      color_t c1 = (is_pressed || draw_pressed) ? COLOR_BLACK    : COLOR_WHITE;
+      color_t c2 = (is_pressed || draw_pressed) ? COLOR_DARKGREY : COLOR_GREY;
+      color_t c3 = (is_pressed || draw_pressed) ? COLOR_GREY     : COLOR_DARKGREY;
+      color_t c4 = (is_pressed || draw_pressed) ? COLOR_WHITE    : COLOR_BLACK;
+      color_t cb = (active) ? COLOR_GREY : COLOR_LIGHTGREY;
+
+      // Left and right borders are drawn between top and bottom ones
+      if(row == x_start) cb = c1;
+      else if(row == x_start + 1) cb = c2;
+      else if(row == x_end - 1) cb = c3;
+      else if(row == x_end) cb = c4;
+      else cb = cb;
+
+      // Fill buffer with background color
+      for(int32_t i = start; i <= end; i++) buf[i] = cb;
+
+      // Top and bottom borders of button
+      if(y_start - start_y >= 0)
+      {
+        buf[start] = c1;
+        if((x_start + 1 < row) && (row < x_end - 1) && (start < end)) buf[start + 1] = c2;
+      }
+      if(y_end - start_y < n)
+      {
+        buf[end] = c4;
+        if((x_start + 1 < row) && (row < x_end - 1) && (start < end)) buf[end - 1] = c3;
+      }
+    }
+    // Draw shadow if button is disabled
+    if(!active) string_shadow.DrawInBufH(buf, n, row, start_y);
+    // Draw button text
+    string.DrawInBufH(buf, n, row, start_y);
+  }
 }
 
 // *****************************************************************************
@@ -92,7 +92,21 @@ void UiCheckbox::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start
 // *****************************************************************************
 void UiCheckbox::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
-  // FIX ME: implement for Vertical Update Mode too 
+  // Draw only if needed
+  if((row >= x_start) && (row <= x_end))
+  {
+    // Find start y position
+    int32_t start = y_start - start_y;
+    // Prevent write in memory before buffer
+    if(start < 0) start = 0;
+    // Find end y position
+    int32_t end = y_end - start_y;
+    // Prevent buffer overflow
+    if(end >= n) end = n - 1;
+    // Checkbox is filled by color of its state
+    color_t color = checked ? COLOR_YELLOW : COLOR_MAGENTA;
+    for(int32_t i = start; i <= end; i++) buf[i] = color;
+  }
 }
 
 // *****************************************************************************
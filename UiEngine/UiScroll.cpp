@@ -194,7 +194,79 @@ void UiScroll::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x
 // *****************************************************************************
 void UiScroll::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
-  // FIX ME: implement for Vertical Update Mode too 
+  // FIX ME: TEMPORARY COLOR !!!
+  color_t color = COLOR_YELLOW;
+  // Draw only if needed
+  if((row >= x_start) && (row <= x_end))
+  {
+    // Find start y position
+    int32_t start = y_start - start_y;
+    // Prevent write in memory before buffer
+    if(start < 0) start = 0;
+    // Find end y position
+    int32_t end = y_end - start_y;
+    // Prevent buffer overflow
+    if(end >= n) end = n - 1;
+
+    // Have sense draw only if end pointer in buffer
+    if(end >= 0)
+    {
+      // Draw border of scroll
+      if((row == x_start) || (row == x_end))
+      {
+        for(int32_t i = start; i <= end; i++) buf[i] = color;
+      }
+      else if(    (has_buttons == true) && (vertical == false)
+              && ((row == x_start + height) || (row == x_end - height)) )
+      {
+        for(int32_t i = start; i <= end; i++) buf[i] = color;
+      }
+      else
+      {
+        if(y_start - start_y >= 0) buf[start] = color;
+        if(y_end - start_y < n)    buf[end]   = color;
+
+        if(has_buttons && vertical)
+        {
+          int32_t top = y_start + width - start_y;
+          int32_t bottom = y_end - width + 1 - start_y;
+          if((top >= 0) && (top < n))       buf[top] = color;
+          if((bottom >= 0) && (bottom < n)) buf[bottom] = color;
+        }
+      }
+      // Find start of bar position
+      int32_t bar_start = bar_shift;
+      // Add bar additional shift
+      bar_start += (empty_len * cnt) / (total_cnt - 1);
+      if(vertical)
+      {
+        // Bar is drawn between left and right borders
+        if((row != x_start) && (row != x_end))
+        {
+          bar_start += y_start - start_y;
+          // Prevent write in memory before buffer
+          if(bar_start < 0) bar_start = 0;
+          // Find end of bar
+          int32_t bar_end = bar_start + bar_len;
+          // Prevent buffer overflow
+          if(bar_end > n) bar_end = n;
+          // Draw row
+          for(int32_t i = bar_start; i < bar_end; i++) buf[i] = COLOR_MAGENTA;
+        }
+      }
+      else
+      {
+        bar_start += x_start;
+        // Draw bar row between top and bottom borders
+        if((row >= bar_start) && (row < bar_start + bar_len))
+        {
+          int32_t bar_top = (y_start + 1 - start_y < 0) ? 0 : (y_start + 1 - start_y);
+          int32_t bar_bottom = (y_end - 1 - start_y >= n) ? (n - 1) : (y_end - 1 - start_y);
+          for(int32_t i = bar_top; i <= bar_bottom; i++) buf[i] = COLOR_MAGENTA;
+        }
+      }
+    }
+  }
 }
 
 // *****************************************************************************